@@ -0,0 +1,296 @@
+/**
+  * @file bus.c
+  * @brief Define the message bus that carries sensor blocks, scores, lid changes and flipper moves between threads.
+  *        Every topic is a ring of fixed-size slots with one publishing thread. The publisher reserves the next
+  *        slot, fills it in place and publishes it; every subscriber reads the slots in place through its own
+  *        read index and releases them, so payloads are never copied. Each index has one writer, so no locks are
+  *        needed, only memory barriers. A slot is reused once every subscriber has released it; until then the
+  *        publisher's reservations fail and are counted as dropped. A subscriber may give a notify function,
+  *        called by the publisher when messages arrive while the subscriber was idle.
+  *        Define GLCD_SOFT to build for the host, where the publishers and subscribers can be pthreads.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stddef.h>
+#include "bus.h"
+#include "platform.h"
+#ifdef GLCD_SOFT
+#define BUS_BARRIER() __sync_synchronize()
+#else
+#include "stm32f7xx_hal.h"
+#define BUS_BARRIER() __DMB()
+#endif
+
+/**
+  * @brief Words of a slot holding a payload, slots are 8-byte aligned.
+  */
+#define SLOT_WORDS(type) ((sizeof(type) + 7) / 8)
+
+/**
+  * @brief Slots of each topic. Sensor blocks are written while averaging, so they stay in the DTCM
+  *        where the averages were kept before.
+  */
+DTCM_DATA static uint64_t sensorSlots[BUS_SENSOR_DEPTH][SLOT_WORDS(busSensorBlock)];
+static uint64_t scoreSlots[BUS_SCORE_DEPTH][SLOT_WORDS(busScore)];
+static uint64_t lidSlots[BUS_LID_DEPTH][SLOT_WORDS(busLid)];
+static uint64_t flipper1Slots[BUS_FLIPPER_DEPTH][SLOT_WORDS(busFlipper)];
+static uint64_t flipper2Slots[BUS_FLIPPER_DEPTH][SLOT_WORDS(busFlipper)];
+
+/**
+  * @brief A struct containing a subscriber of a topic. tail and notified are written by the subscriber,
+  *        notified is also set by the publisher, and cleared again when the notification could not be delivered.
+  */
+typedef struct{
+	volatile bool active;
+	volatile uint32_t tail;
+	volatile bool notified;
+	bool (*notify)(enum busTopic topic);
+	}subscription;
+
+/**
+  * @brief A struct containing a topic. head counts the messages published and is written by the publisher only.
+  */
+typedef struct{
+	uint8_t* slots;
+	uint32_t slotSize;
+	uint32_t depth;
+	volatile uint32_t head;
+	subscription subscribers[BUS_SUBSCRIBERS];
+	uint32_t published;
+	uint32_t dropped;
+	uint32_t highWater;
+	}topicRing;
+
+/**
+  * @brief The topics, indexed by enum busTopic.
+  */
+static topicRing topics[TopicCount] = {
+	{(uint8_t*)sensorSlots, sizeof(sensorSlots[0]), BUS_SENSOR_DEPTH},
+	{(uint8_t*)scoreSlots, sizeof(scoreSlots[0]), BUS_SCORE_DEPTH},
+	{(uint8_t*)lidSlots, sizeof(lidSlots[0]), BUS_LID_DEPTH},
+	{(uint8_t*)flipper1Slots, sizeof(flipper1Slots[0]), BUS_FLIPPER_DEPTH},
+	{(uint8_t*)flipper2Slots, sizeof(flipper2Slots[0]), BUS_FLIPPER_DEPTH}
+};
+
+/**
+  * @brief Returns the messages the slowest subscriber of a topic has not released.
+  * @param ring The topic.
+  * @returns Number of messages, 0 without subscribers.
+  */
+static uint32_t waiting(const topicRing* ring){
+	uint32_t head = ring->head;
+	uint32_t most = 0;
+	uint32_t lag;
+	int i;
+
+	for(i = 0; i < BUS_SUBSCRIBERS; i++){
+		if(ring->subscribers[i].active){
+			lag = head - ring->subscribers[i].tail;
+			if(lag > most){
+				most = lag;
+			}
+		}
+	}
+	return most;
+}
+
+/**
+  * @brief Returns a slot of a topic.
+  * @param ring The topic.
+  * @param index Message count, wrapped to the depth.
+  * @returns The slot.
+  */
+static uint8_t* slot(const topicRing* ring, uint32_t index){
+	return ring->slots + (index & (ring->depth - 1)) * ring->slotSize;
+}
+
+/**
+  * @brief Empties every topic, drops every subscriber and clears the statistics.
+  *        Call before any thread uses the bus.
+  * @param None.
+  * @returns Void.
+  */
+void busInitialize(void){
+	int i;
+	int j;
+
+	for(i = 0; i < TopicCount; i++){
+		topics[i].head = 0;
+		for(j = 0; j < BUS_SUBSCRIBERS; j++){
+			topics[i].subscribers[j].active = false;
+			topics[i].subscribers[j].tail = 0;
+			topics[i].subscribers[j].notified = false;
+			topics[i].subscribers[j].notify = NULL;
+		}
+		topics[i].published = 0;
+		topics[i].dropped = 0;
+		topics[i].highWater = 0;
+	}
+}
+
+/**
+  * @brief Subscribes to a topic. The subscriber sees the messages published from now on.
+  *        Only one thread may subscribe to a topic at a time.
+  * @param topic The topic.
+  * @param notify Called from the publishing thread when a message arrives while the subscriber had read
+  *        everything, NULL to poll instead. It must not block, and returns false if the subscriber could not
+  *        be told, so the next message tries again.
+  * @returns Subscriber number for busPeek and busRelease, -1 if the topic has BUS_SUBSCRIBERS already.
+  */
+int busSubscribe(enum busTopic topic, bool (*notify)(enum busTopic topic)){
+	topicRing* ring;
+	int i;
+
+	if((unsigned int)topic >= TopicCount){
+		return -1;
+	}
+	ring = &topics[topic];
+	for(i = 0; i < BUS_SUBSCRIBERS; i++){
+		subscription* s = &ring->subscribers[i];
+		if(!s->active){
+			s->tail = ring->head;
+			s->notified = false;
+			s->notify = notify;
+			// The publisher must see the index before it counts the subscriber
+			BUS_BARRIER();
+			s->active = true;
+			return i;
+		}
+	}
+	return -1;
+}
+
+/**
+  * @brief Reserves the next slot of a topic for the publisher to fill in place. Never blocks.
+  * @param topic The topic.
+  * @returns The slot, to be cast to the payload type of the topic, NULL if the slowest subscriber is
+  *          a whole depth behind, which is counted as a dropped message.
+  */
+void* busReserve(enum busTopic topic){
+	topicRing* ring;
+
+	if((unsigned int)topic >= TopicCount){
+		return NULL;
+	}
+	ring = &topics[topic];
+	if(waiting(ring) >= ring->depth){
+		ring->dropped++;
+		return NULL;
+	}
+	return slot(ring, ring->head);
+}
+
+/**
+  * @brief Publishes the slot busReserve returned and notifies the idle subscribers.
+  * @param topic The topic.
+  * @returns Void.
+  */
+void busPublish(enum busTopic topic){
+	topicRing* ring;
+	uint32_t count;
+	int i;
+
+	if((unsigned int)topic >= TopicCount){
+		return;
+	}
+	ring = &topics[topic];
+	// The payload must be visible before the subscribers see the new head
+	BUS_BARRIER();
+	ring->head = ring->head + 1;
+	BUS_BARRIER();
+	ring->published++;
+	count = waiting(ring);
+	if(count > ring->highWater){
+		ring->highWater = count;
+	}
+	for(i = 0; i < BUS_SUBSCRIBERS; i++){
+		subscription* s = &ring->subscribers[i];
+		if(s->active && s->notify != NULL && !s->notified){
+			s->notified = true;
+			if(!s->notify(topic)){
+				s->notified = false;
+			}
+		}
+	}
+}
+
+/**
+  * @brief Returns the oldest message a subscriber has not released, read in place.
+  *        Finding nothing re-arms the notify function of the subscriber.
+  * @param topic The topic.
+  * @param subscriber Number from busSubscribe.
+  * @returns The payload, NULL if there is no message.
+  */
+const void* busPeek(enum busTopic topic, int subscriber){
+	topicRing* ring;
+	subscription* s;
+
+	if((unsigned int)topic >= TopicCount || subscriber < 0 || subscriber >= BUS_SUBSCRIBERS){
+		return NULL;
+	}
+	ring = &topics[topic];
+	s = &ring->subscribers[subscriber];
+	if(s->tail == ring->head){
+		// Look again after re-arming, so a message published in between is not left without a notification
+		s->notified = false;
+		BUS_BARRIER();
+		if(s->tail == ring->head){
+			return NULL;
+		}
+	}
+	BUS_BARRIER();
+	return slot(ring, s->tail);
+}
+
+/**
+  * @brief Releases the message busPeek returned, handing its slot back to the publisher once every
+  *        subscriber has released it.
+  * @param topic The topic.
+  * @param subscriber Number from busSubscribe.
+  * @returns Void.
+  */
+void busRelease(enum busTopic topic, int subscriber){
+	subscription* s;
+
+	if((unsigned int)topic >= TopicCount || subscriber < 0 || subscriber >= BUS_SUBSCRIBERS){
+		return;
+	}
+	s = &topics[topic].subscribers[subscriber];
+	// The payload must be read before the publisher may reuse the slot
+	BUS_BARRIER();
+	s->tail = s->tail + 1;
+}
+
+/**
+  * @brief Copies the traffic of a topic.
+  * @param topic The topic.
+  * @param stats Filled in, all zero for an unknown topic.
+  * @returns Void.
+  */
+void busGetStats(enum busTopic topic, busStats* stats){
+	const topicRing* ring;
+	int i;
+
+	stats->published = 0;
+	stats->dropped = 0;
+	stats->highWater = 0;
+	stats->waiting = 0;
+	stats->depth = 0;
+	stats->subscribers = 0;
+	if((unsigned int)topic >= TopicCount){
+		return;
+	}
+	ring = &topics[topic];
+	stats->published = ring->published;
+	stats->dropped = ring->dropped;
+	stats->highWater = ring->highWater;
+	stats->waiting = waiting(ring);
+	stats->depth = ring->depth;
+	for(i = 0; i < BUS_SUBSCRIBERS; i++){
+		if(ring->subscribers[i].active){
+			stats->subscribers++;
+		}
+	}
+}
@@ -0,0 +1,94 @@
+/**
+  * @file bus.h
+  * @brief Header file of the bus.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef BUS_H
+#define BUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+  * @brief Messages each topic holds until its slowest subscriber reads them, a power of two.
+  */
+#define BUS_SENSOR_DEPTH 4
+#define BUS_SCORE_DEPTH 8
+#define BUS_LID_DEPTH 4
+#define BUS_FLIPPER_DEPTH 8
+
+/**
+  * @brief Subscribers each topic can have.
+  */
+#define BUS_SUBSCRIBERS 4
+
+/**
+  * @brief An enum containing the topics. Each topic has one publishing thread, so each player's flipper has its own.
+  */
+enum busTopic{
+	TopicSensor,
+	TopicScore,
+	TopicLid,
+	TopicFlipper1,
+	TopicFlipper2,
+	TopicCount
+};
+
+/**
+  * @brief Payload of TopicSensor: one round of sensor averages, published by the analog thread.
+  */
+typedef struct{
+	int player1;
+	int player2;
+	int light;
+	uint32_t time;
+	}busSensorBlock;
+
+/**
+  * @brief Payload of TopicScore: the player who scored, 1 or 2.
+  */
+typedef struct{
+	int player;
+	}busScore;
+
+/**
+  * @brief Payload of TopicLid: the new lid state.
+  */
+typedef struct{
+	bool open;
+	}busLid;
+
+/**
+  * @brief Payload of TopicFlipper1 and TopicFlipper2: a flipper of a player going up or back down.
+  */
+typedef struct{
+	int player;
+	bool pressed;
+	}busFlipper;
+
+/**
+  * @brief A struct containing the traffic of a topic since busInitialize.
+  *        dropped counts messages the publisher could not place because a subscriber lagged a whole depth behind,
+  *        highWater the most messages ever waiting for the slowest subscriber.
+  */
+typedef struct{
+	uint32_t published;
+	uint32_t dropped;
+	uint32_t highWater;
+	uint32_t waiting;
+	uint32_t depth;
+	uint32_t subscribers;
+	}busStats;
+
+void busInitialize(void);
+int busSubscribe(enum busTopic topic, bool (*notify)(enum busTopic topic));
+void* busReserve(enum busTopic topic);
+void busPublish(enum busTopic topic);
+const void* busPeek(enum busTopic topic, int subscriber);
+void busRelease(enum busTopic topic, int subscriber);
+void busGetStats(enum busTopic topic, busStats* stats);
+
+#endif
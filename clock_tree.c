@@ -0,0 +1,225 @@
+/**
+  * @file clock_tree.c
+  * @brief Define the performance profiles and the clock tree arithmetic behind them:
+  *        bus frequencies, flash wait states, the limits of each voltage scale, and the prescalers and
+  *        counts of the peripherals that follow the clock. No registers are touched, so the file
+  *        also builds for the host; platformSetProfile applies a profile on the target.
+  *        Limits are those of the STM32F746 datasheet for a 2.7 V to 3.6 V supply.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stddef.h>
+#include "clock_tree.h"
+
+/**
+  * @brief Settings of each profile, indexed by enum clockProfile. pllm stays 25 in every profile:
+  *        it is shared with the PLLSAI that makes the LCD pixel clock, and the USB clock stays at 48 MHz.
+  */
+static const clockTree profiles[ClockProfileCount] = {
+	// 216 MHz needs voltage scale 1 with over-drive
+	{"max", 25, 432, 2, 9, 1, true, 1, 4, 2},
+	{"balanced", 25, 336, 2, 7, 2, false, 1, 4, 2},
+	{"low-power", 25, 192, 4, 4, 3, false, 1, 2, 1}
+};
+
+/**
+  * @brief Returns the settings of a profile.
+  * @param profile The profile.
+  * @returns The settings, NULL if there is no such profile.
+  */
+const clockTree* clockProfileTree(enum clockProfile profile){
+	if((unsigned int)profile >= ClockProfileCount){
+		return NULL;
+	}
+	return &profiles[profile];
+}
+
+/**
+  * @brief Returns the frequency of the PLL's voltage controlled oscillator.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+static uint32_t vco(const clockTree* tree){
+	return (uint32_t)((uint64_t)CLOCK_HSE_HZ * tree->plln / tree->pllm);
+}
+
+/**
+  * @brief Returns the core clock.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+uint32_t clockSysclk(const clockTree* tree){
+	return vco(tree) / tree->pllp;
+}
+
+/**
+  * @brief Returns the AHB clock, which also clocks the core, the DMA2D and the SDRAM controller.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+uint32_t clockHclk(const clockTree* tree){
+	return clockSysclk(tree) / tree->ahbDivider;
+}
+
+/**
+  * @brief Returns the APB1 clock.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+uint32_t clockPclk1(const clockTree* tree){
+	return clockHclk(tree) / tree->apb1Divider;
+}
+
+/**
+  * @brief Returns the APB2 clock, which also clocks the ADC prescaler.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+uint32_t clockPclk2(const clockTree* tree){
+	return clockHclk(tree) / tree->apb2Divider;
+}
+
+/**
+  * @brief Returns the clock of the APB1 timers, among them TIM3 and TIM12 of the servos.
+  *        The timers run at twice the bus clock whenever the bus is divided.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+uint32_t clockApb1TimerClock(const clockTree* tree){
+	return (tree->apb1Divider == 1) ? clockPclk1(tree) : clockPclk1(tree) * 2;
+}
+
+/**
+  * @brief Returns the 48 MHz clock of the USB controller.
+  * @param tree The clock tree.
+  * @returns Frequency in Hz.
+  */
+uint32_t clockUsb(const clockTree* tree){
+	return vco(tree) / tree->pllq;
+}
+
+/**
+  * @brief Returns the fastest core clock a voltage scale allows.
+  * @param voltageScale 1, 2 or 3.
+  * @param overDrive true with the over-drive on, which only scales 1 and 2 have.
+  * @returns Frequency in Hz, 0 for an unknown scale.
+  */
+uint32_t clockMaxSysclk(uint8_t voltageScale, bool overDrive){
+	switch(voltageScale){
+		case 1:
+			return overDrive ? 216000000 : 180000000;
+		case 2:
+			return overDrive ? 180000000 : 168000000;
+		case 3:
+			return 144000000;
+		default:
+			return 0;
+	}
+}
+
+/**
+  * @brief Returns the flash wait states the AHB clock needs, one per started 30 MHz.
+  * @param hclk AHB clock in Hz.
+  * @returns Wait states, 0 to 7, the value of FLASH_LATENCY_n.
+  */
+uint32_t clockFlashLatency(uint32_t hclk){
+	uint32_t waitStates = (hclk + 29999999) / 30000000;
+	return (waitStates > 0) ? waitStates - 1 : 0;
+}
+
+/**
+  * @brief Checks a clock tree against the limits of the part.
+  * @param tree The clock tree.
+  * @returns 0 if it is valid, otherwise the enum clockError bits of every broken limit.
+  */
+uint32_t clockValidate(const clockTree* tree){
+	uint32_t errors = 0;
+	uint32_t input;
+	uint32_t apb1Max = tree->overDrive ? 54000000 : 45000000;
+	uint32_t apb2Max = tree->overDrive ? 108000000 : 90000000;
+
+	if(tree->pllm < 2 || tree->pllm > 63 || tree->plln < 50 || tree->plln > 432
+			|| tree->pllq < 2 || tree->pllq > 15 || (tree->pllp != 2 && tree->pllp != 4 && tree->pllp != 6 && tree->pllp != 8)){
+		// The frequencies below would be meaningless
+		return ClockErrorDivider;
+	}
+	input = CLOCK_HSE_HZ / tree->pllm;
+	if(input < 950000 || input > 2100000){
+		errors |= ClockErrorPllInput;
+	}
+	if(vco(tree) < 100000000 || vco(tree) > 432000000){
+		errors |= ClockErrorPllOutput;
+	}
+	if(tree->ahbDivider == 0 || tree->apb1Divider == 0 || tree->apb2Divider == 0
+			|| (tree->ahbDivider & (tree->ahbDivider - 1)) != 0 || tree->ahbDivider > 512 || tree->ahbDivider == 32
+			|| (tree->apb1Divider & (tree->apb1Divider - 1)) != 0 || tree->apb1Divider > 16
+			|| (tree->apb2Divider & (tree->apb2Divider - 1)) != 0 || tree->apb2Divider > 16){
+		return errors | ClockErrorDivider;
+	}
+	if(clockSysclk(tree) > clockMaxSysclk(tree->voltageScale, tree->overDrive) || (tree->overDrive && tree->voltageScale == 3)){
+		errors |= ClockErrorSysclk;
+	}
+	if(clockPclk1(tree) > apb1Max){
+		errors |= ClockErrorApb1;
+	}
+	if(clockPclk2(tree) > apb2Max){
+		errors |= ClockErrorApb2;
+	}
+	// The USB controller allows 0.25 %
+	if(clockUsb(tree) < 47880000 || clockUsb(tree) > 48120000){
+		errors |= ClockErrorUsb;
+	}
+	return errors;
+}
+
+/**
+  * @brief Returns the prescaler register value that makes a timer count closest to a rate.
+  * @param timerClock Clock of the timer in Hz.
+  * @param tickHz The count rate wanted.
+  * @returns Prescaler register value, the clock is divided by one more than it.
+  */
+uint32_t clockTimerPrescaler(uint32_t timerClock, uint32_t tickHz){
+	uint32_t divider = (timerClock + tickHz / 2) / tickHz;
+	if(divider == 0){
+		return 0;
+	}
+	return (divider > 65536) ? 65535 : divider - 1;
+}
+
+/**
+  * @brief Returns the smallest ADC clock divider that keeps the ADC within CLOCK_ADC_MAX_HZ.
+  * @param pclk2 APB2 clock in Hz.
+  * @returns 2, 4, 6 or 8, 0 if even 8 is not enough.
+  */
+uint32_t clockAdcDivider(uint32_t pclk2){
+	uint32_t divider;
+	for(divider = 2; divider <= 8; divider += 2){
+		if(pclk2 / divider <= CLOCK_ADC_MAX_HZ){
+			return divider;
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief Returns the SDRAM refresh timer count for an AHB clock. The SDRAM clock is half the AHB clock.
+  * @param hclk AHB clock in Hz.
+  * @returns Value of the COUNT field of FMC_SDRTR.
+  */
+uint32_t clockSdramRefreshCount(uint32_t hclk){
+	uint32_t cycles = (uint32_t)((uint64_t)(hclk / 2) * CLOCK_SDRAM_REFRESH_NS / 1000000000);
+	// The controller adds 20 cycles of margin for commands in progress
+	return (cycles > 41) ? cycles - 20 : 41;
+}
+
+/**
+  * @brief Returns the SysTick reload value for a kernel tick rate.
+  * @param hclk AHB clock in Hz, the SysTick runs from it.
+  * @param tickHz Ticks per second.
+  * @returns Reload register value.
+  */
+uint32_t clockSysTickReload(uint32_t hclk, uint32_t tickHz){
+	return hclk / tickHz - 1;
+}
@@ -0,0 +1,96 @@
+/**
+  * @file clock_tree.h
+  * @brief Header file of the clock_tree.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef CLOCK_TREE_H
+#define CLOCK_TREE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+  * @brief Frequency of the crystal on the HSE input of the discovery board.
+  */
+#define CLOCK_HSE_HZ 25000000
+
+/**
+  * @brief Kernel tick rate, the same as OS_TICK in RTX_Conf_CM.c.
+  */
+#define CLOCK_TICK_HZ 1000
+
+/**
+  * @brief Count rate of the servo PWM timers. PWM_LOW, PWM_HIGH and the period are counted in it,
+  *        it is what a prescaler of 2550 gave from the 84 MHz timer clock of the original 168 MHz set-up.
+  */
+#define CLOCK_SERVO_TICK_HZ 32928
+
+/**
+  * @brief Fastest ADC clock at 2.4 V to 3.6 V.
+  */
+#define CLOCK_ADC_MAX_HZ 36000000
+
+/**
+  * @brief Time between two SDRAM auto-refresh commands in nanoseconds: 64 ms over 4096 rows, less a margin.
+  */
+#define CLOCK_SDRAM_REFRESH_NS 14430
+
+/**
+  * @brief An enum containing the performance profiles.
+  */
+enum clockProfile{
+	ClockMaxPerformance,
+	ClockBalanced,
+	ClockLowPower,
+	ClockProfileCount
+};
+
+/**
+  * @brief Errors clockValidate reports, one bit each.
+  */
+enum clockError{
+	ClockErrorPllInput = 1,
+	ClockErrorPllOutput = 2,
+	ClockErrorDivider = 4,
+	ClockErrorSysclk = 8,
+	ClockErrorApb1 = 16,
+	ClockErrorApb2 = 32,
+	ClockErrorUsb = 64
+};
+
+/**
+  * @brief A struct containing the settings of the clock tree for one profile.
+  *        The PLL runs from the HSE: VCO = HSE / pllm * plln, SYSCLK = VCO / pllp, 48 MHz clock = VCO / pllq.
+  */
+typedef struct{
+	const char* name;
+	uint16_t pllm;
+	uint16_t plln;
+	uint8_t pllp;
+	uint8_t pllq;
+	uint8_t voltageScale;
+	bool overDrive;
+	uint16_t ahbDivider;
+	uint8_t apb1Divider;
+	uint8_t apb2Divider;
+	}clockTree;
+
+const clockTree* clockProfileTree(enum clockProfile profile);
+uint32_t clockSysclk(const clockTree* tree);
+uint32_t clockHclk(const clockTree* tree);
+uint32_t clockPclk1(const clockTree* tree);
+uint32_t clockPclk2(const clockTree* tree);
+uint32_t clockApb1TimerClock(const clockTree* tree);
+uint32_t clockUsb(const clockTree* tree);
+uint32_t clockMaxSysclk(uint8_t voltageScale, bool overDrive);
+uint32_t clockFlashLatency(uint32_t hclk);
+uint32_t clockValidate(const clockTree* tree);
+uint32_t clockTimerPrescaler(uint32_t timerClock, uint32_t tickHz);
+uint32_t clockAdcDivider(uint32_t pclk2);
+uint32_t clockSdramRefreshCount(uint32_t hclk);
+uint32_t clockSysTickReload(uint32_t hclk, uint32_t tickHz);
+
+#endif
@@ -0,0 +1,1044 @@
+/**
+  * @file cmsis_os_soft.c
+  * @brief Host implementation of the part of the CMSIS-RTOS v1 API the firmware uses, on POSIX threads.
+  *        Links in place of RTX so main.c, screens.c and setup.c run on a Linux host, like glcd_soft.c for the display.
+  *        Each thread is a pthread, but like on the single core of the board only one of them runs at a time:
+  *        the kernel hands the CPU to the highest-priority ready thread, and threads of the same priority take turns
+  *        every OS_SOFT_ROBIN_TICKS. A pthread cannot be stopped from outside, so a thread made ready by the tick
+  *        or an interrupt takes over at the next kernel call of the running thread rather than at once.
+  *        Calls from pthreads the kernel did not create, which stand in for interrupts, never block.
+  *        The tick is a pthread of its own that counts os_time in real milliseconds; timer callbacks run in a
+  *        timer thread, as in RTX. Every switch is passed to traceSwitch, and every stack is painted for the stack watch.
+  *        With OS_SOFT_VIRTUAL_TIME there is no tick thread: time stands still while a thread runs, and once every
+  *        thread waits it jumps straight to the next timeout or timer. Threads then only switch where they wait, in
+  *        an order that depends on nothing but the program, so a run repeats exactly and takes as long as its
+  *        threads compute rather than as long as they sleep. Inputs should come from a thread too, not a pthread
+  *        of its own, or the runs no longer repeat.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cmsis_os_soft.h"
+#include "stack_watch.h"
+#include "trace.h"
+
+/**
+  * @brief Message queues and timers that can exist at once.
+  */
+#define OS_SOFT_QUEUES 4
+#define OS_SOFT_TIMERS 4
+
+/**
+  * @brief An enum containing the states of a thread.
+  */
+enum threadState{
+	ThreadInactive,
+	ThreadReady,
+	ThreadRunning,
+	ThreadWaiting
+};
+
+/**
+  * @brief An enum containing what a waiting thread waits for.
+  */
+enum waitType{
+	WaitDelay,
+	WaitSignal,
+	WaitMessage,
+	WaitSpace,
+	WaitTimer
+};
+
+/**
+  * @brief A struct containing a thread. The state is guarded by the kernel lock.
+  */
+struct os_thread_cb{
+	pthread_t thread;
+	pthread_cond_t wake;
+	os_pthread function;
+	void* argument;
+	osPriority priority;
+	enum threadState state;
+	uint32_t readyOrder;
+	uint32_t sliceStart;
+	enum waitType wait;
+	bool timed;
+	uint32_t timeout;
+	int32_t signals;
+	int32_t waitSignals;
+	osMessageQId queue;
+	uint32_t message;
+	osEvent result;
+	void* stack;
+	uint32_t stackSize;
+	uint32_t runCost;
+	};
+
+/**
+  * @brief A struct containing a message queue, its messages are kept in the memory of its osMessageQDef.
+  */
+struct os_messageQ_cb{
+	uint32_t* slots;
+	uint32_t size;
+	uint32_t first;
+	uint32_t count;
+	};
+
+/**
+  * @brief A struct containing a timer. remaining counts down the ticks until it fires.
+  */
+struct os_timer_cb{
+	bool used;
+	bool active;
+	bool pending;
+	os_ptimer callback;
+	void* argument;
+	os_timer_type type;
+	uint32_t load;
+	uint32_t remaining;
+	};
+
+/**
+  * @brief The kernel lock, held while the state of any thread, queue or timer changes.
+  */
+static pthread_mutex_t kernel = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+  * @brief The threads, message queues and timers.
+  */
+static struct os_thread_cb threads[OS_SOFT_THREADS];
+static int threadCount = 0;
+static struct os_messageQ_cb queues[OS_SOFT_QUEUES];
+static int queueCount = 0;
+static struct os_timer_cb timers[OS_SOFT_TIMERS];
+
+/**
+  * @brief The thread holding the CPU, NULL while the kernel idles.
+  */
+static osThreadId running = NULL;
+
+/**
+  * @brief The thread the calling pthread is, NULL for pthreads the kernel did not create.
+  */
+static __thread osThreadId self = NULL;
+
+/**
+  * @brief Counts the times threads became ready, so threads of the same priority run in turn.
+  */
+static uint32_t readyCount = 0;
+
+/**
+  * @brief Set by osKernelStart, threads are only switched from then on.
+  */
+static bool started = false;
+
+/**
+  * @brief Stands in for the idle demon in the trace.
+  */
+static const char idleMarker = 0;
+
+/**
+  * @brief The timer thread and the tick.
+  */
+static osThreadId timerThread = NULL;
+#ifndef OS_SOFT_VIRTUAL_TIME
+static pthread_t tickThread;
+#endif
+
+/**
+  * @brief Counters for osSoftGetStats, and the real time at osKernelStart.
+  */
+static uint32_t switches = 0;
+static uint32_t jumps = 0;
+static struct timespec startTime;
+
+#ifdef OS_SOFT_VIRTUAL_TIME
+/**
+  * @brief Virtual microseconds, os_time plus the run costs charged beyond it, read by the trace.
+  */
+static uint64_t virtualMicros = 0;
+#endif
+
+uint32_t os_time = 0;
+
+static void update(void);
+#ifdef OS_SOFT_VIRTUAL_TIME
+static osThreadId jumpTime(void);
+#endif
+
+/**
+  * @brief Returns the ready thread that should run next: the highest priority, the longest ready among equals.
+  * @param None.
+  * @returns The thread, NULL if none is ready.
+  */
+static osThreadId highestReady(void){
+	osThreadId best = NULL;
+	int i;
+
+	for(i = 0; i < threadCount; i++){
+		osThreadId t = &threads[i];
+		if(t->state == ThreadReady && (best == NULL || t->priority > best->priority ||
+				(t->priority == best->priority && (int32_t)(t->readyOrder - best->readyOrder) < 0))){
+			best = t;
+		}
+	}
+	return best;
+}
+
+/**
+  * @brief Hands the CPU to a thread. Its pthread runs once the kernel lock is released.
+  *        In virtual time the kernel only idles if nothing is due; otherwise time moves on until a thread is ready.
+  * @param next The thread, NULL to idle.
+  * @returns Void.
+  */
+static void switchTo(osThreadId next){
+#ifdef OS_SOFT_VIRTUAL_TIME
+	if(running != NULL && started){
+		// The thread giving up the CPU ran for its cost
+		virtualMicros += running->runCost;
+	}
+	if(next == NULL && started){
+		// The time jumped over is idle time in the trace
+		traceSwitch(&idleMarker);
+		next = jumpTime();
+	}
+#endif
+	running = next;
+	if(next != NULL){
+		switches++;
+		next->state = ThreadRunning;
+		next->sliceStart = os_time;
+		traceSwitch(next);
+		pthread_cond_signal(&next->wake);
+	}else{
+		traceSwitch(&idleMarker);
+	}
+}
+
+/**
+  * @brief Makes a thread ready, and runs it if the kernel is idle.
+  * @param t The thread.
+  * @returns Void.
+  */
+static void makeReady(osThreadId t){
+	t->state = ThreadReady;
+	t->readyOrder = readyCount++;
+	if(started && running == NULL){
+		switchTo(highestReady());
+	}
+}
+
+/**
+  * @brief Gives up the CPU and sleeps until the kernel hands it back. The caller sets its own state first.
+  * @param t The calling thread.
+  * @returns Void.
+  */
+static void suspend(osThreadId t){
+	switchTo(highestReady());
+	while(running != t){
+		pthread_cond_wait(&t->wake, &kernel);
+	}
+}
+
+/**
+  * @brief Gives the CPU to a ready thread of higher priority, or of the same priority once the time slice is over.
+  *        Called at the end of every kernel call, the only points where the host can switch threads.
+  * @param t The calling thread, NULL from an interrupt.
+  * @returns Void.
+  */
+static void preempt(osThreadId t){
+	osThreadId next = highestReady();
+
+	if(t == NULL || !started || next == NULL){
+		return;
+	}
+	if(next->priority > t->priority ||
+			(next->priority == t->priority && os_time - t->sliceStart >= OS_SOFT_ROBIN_TICKS)){
+		makeReady(t);
+		suspend(t);
+	}
+}
+
+/**
+  * @brief Ends the wait of a thread if what it waits for has happened or its time is up, filling in its result.
+  * @param t The waiting thread.
+  * @returns True if the wait is over.
+  */
+static bool complete(osThreadId t){
+	osMessageQId q = t->queue;
+	int i;
+
+	switch(t->wait){
+		case WaitSignal:
+			if((t->waitSignals == 0 && t->signals != 0) ||
+					(t->waitSignals != 0 && (t->signals & t->waitSignals) == t->waitSignals)){
+				t->result.status = osEventSignal;
+				t->result.value.signals = t->signals;
+				t->signals &= (t->waitSignals == 0) ? 0 : ~t->waitSignals;
+				return true;
+			}
+			break;
+		case WaitMessage:
+			if(q->count > 0){
+				t->result.status = osEventMessage;
+				t->result.value.v = q->slots[q->first];
+				t->result.def.message_id = q;
+				q->first = (q->first + 1) % q->size;
+				q->count--;
+				return true;
+			}
+			break;
+		case WaitSpace:
+			if(q->count < q->size){
+				q->slots[(q->first + q->count) % q->size] = t->message;
+				q->count++;
+				t->result.status = osOK;
+				return true;
+			}
+			break;
+		case WaitTimer:
+			for(i = 0; i < OS_SOFT_TIMERS; i++){
+				if(timers[i].pending){
+					t->result.status = osOK;
+					return true;
+				}
+			}
+			break;
+		default:
+			break;
+	}
+	if(t->timed && (int32_t)(os_time - t->timeout) >= 0){
+		t->result.status = (t->wait == WaitSpace) ? osErrorTimeoutResource : osEventTimeout;
+		return true;
+	}
+	return false;
+}
+
+/**
+  * @brief Makes ready every thread whose wait is over, after anything changed.
+  * @param None.
+  * @returns Void.
+  */
+static void update(void){
+	bool changed = true;
+	int i;
+
+	// A message taken or given may end another wait, so look again until nothing changes
+	while(changed){
+		changed = false;
+		for(i = 0; i < threadCount; i++){
+			if(threads[i].state == ThreadWaiting && complete(&threads[i])){
+				makeReady(&threads[i]);
+				changed = true;
+			}
+		}
+	}
+}
+
+/**
+  * @brief Waits in the calling thread until what it waits for happens or the time is up.
+  *        The caller fills in the details of the wait first.
+  * @param t The calling thread, NULL from an interrupt, which never waits.
+  * @param wait What it waits for.
+  * @param millisec Time to wait, osWaitForever to wait without one.
+  * @param none Result if there is nothing and no time to wait.
+  * @returns The result of the wait.
+  */
+static osEvent waitFor(osThreadId t, enum waitType wait, uint32_t millisec, osStatus none){
+	osEvent result;
+
+	result.status = none;
+	if(t == NULL){
+		return result;
+	}
+	t->wait = wait;
+	t->timed = (millisec != osWaitForever);
+	t->timeout = os_time + millisec / OS_SOFT_TICK_MS;
+	t->result.status = none;
+	if(complete(t)){
+		// Took what it waited for without sleeping, the others may now take over
+		result = t->result;
+		preempt(t);
+		return result;
+	}
+	if(millisec == 0){
+		return result;
+	}
+	t->state = ThreadWaiting;
+	suspend(t);
+	return t->result;
+}
+
+/**
+  * @brief Body of every thread: waits for the CPU, runs the thread function and ends the thread when it returns.
+  * @param argument The thread.
+  * @returns NULL.
+  */
+static void* threadEntry(void* argument){
+	osThreadId t = (osThreadId)argument;
+
+	self = t;
+	pthread_mutex_lock(&kernel);
+	while(running != t){
+		pthread_cond_wait(&t->wake, &kernel);
+	}
+	pthread_mutex_unlock(&kernel);
+	t->function(t->argument);
+	pthread_mutex_lock(&kernel);
+	t->state = ThreadInactive;
+	switchTo(highestReady());
+	pthread_mutex_unlock(&kernel);
+	return NULL;
+}
+
+/**
+  * @brief Body of the timer thread: runs the callback of every timer that fired.
+  * @param argument Unused.
+  * @returns Void.
+  */
+static void timerTask(void const* argument){
+	int i;
+
+	pthread_mutex_lock(&kernel);
+	for(;;){
+		waitFor(self, WaitTimer, osWaitForever, osOK);
+		for(i = 0; i < OS_SOFT_TIMERS; i++){
+			if(timers[i].pending){
+				timers[i].pending = false;
+				pthread_mutex_unlock(&kernel);
+				timers[i].callback(timers[i].argument);
+				pthread_mutex_lock(&kernel);
+			}
+		}
+	}
+}
+
+/**
+  * @brief Moves the time on, firing the timers and ending the waits that timed out.
+  *        Never moves past a timer, so none is due more than once on the way.
+  * @param ticks Ticks to move on by.
+  * @returns Void.
+  */
+static void advanceTime(uint32_t ticks){
+	int i;
+
+	os_time += ticks;
+	for(i = 0; i < OS_SOFT_TIMERS; i++){
+		if(timers[i].active){
+			timers[i].remaining -= ticks;
+			if(timers[i].remaining == 0){
+				timers[i].pending = true;
+				timers[i].remaining = timers[i].load;
+				timers[i].active = (timers[i].type == osTimerPeriodic);
+			}
+		}
+	}
+	update();
+}
+
+#ifdef OS_SOFT_VIRTUAL_TIME
+
+/**
+  * @brief Returns the ticks until the next timeout or timer.
+  * @param None.
+  * @returns The ticks, 0 if nothing is due.
+  */
+static uint32_t nextDue(void){
+	uint32_t due = 0;
+	uint32_t left;
+	int i;
+
+	for(i = 0; i < threadCount; i++){
+		if(threads[i].state == ThreadWaiting && threads[i].timed){
+			left = threads[i].timeout - os_time;
+			// complete() ends waits whose time is up, so any left here are in the future
+			if(due == 0 || left < due){
+				due = left;
+			}
+		}
+	}
+	for(i = 0; i < OS_SOFT_TIMERS; i++){
+		if(timers[i].active && (due == 0 || timers[i].remaining < due)){
+			due = timers[i].remaining;
+		}
+	}
+	return due;
+}
+
+/**
+  * @brief Jumps the time to each next timeout or timer until a thread is ready. Called as the kernel would idle.
+  * @param None.
+  * @returns The thread to run, NULL if nothing is due and only an outside pthread can wake a thread.
+  */
+static osThreadId jumpTime(void){
+	osThreadId next = NULL;
+	uint32_t due;
+
+	while(next == NULL && (due = nextDue()) != 0){
+		jumps++;
+		// No thread runs, so makeReady must not start one from inside the jump
+		started = false;
+		advanceTime(due);
+		started = true;
+		next = highestReady();
+	}
+	// The threads' costs fill the time jumped over first, idle has what is left
+	if(virtualMicros < (uint64_t)os_time * OS_SOFT_TICK_MS * 1000){
+		virtualMicros = (uint64_t)os_time * OS_SOFT_TICK_MS * 1000;
+	}
+	return next;
+}
+
+#else
+
+/**
+  * @brief The tick: moves the time on every millisecond.
+  * @param argument Unused.
+  * @returns NULL.
+  */
+static void* tickTask(void* argument){
+	struct timespec next;
+
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for(;;){
+		next.tv_nsec += OS_SOFT_TICK_MS * 1000000L;
+		if(next.tv_nsec >= 1000000000L){
+			next.tv_nsec -= 1000000000L;
+			next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		pthread_mutex_lock(&kernel);
+		advanceTime(1);
+		pthread_mutex_unlock(&kernel);
+	}
+	return NULL;
+}
+
+#endif
+
+/**
+  * @brief Creates a thread in the kernel, not yet started.
+  * @param function The thread function, NULL for the calling pthread.
+  * @param argument Passed to the function.
+  * @param priority The priority.
+  * @param size Stack size the thread asks for in bytes, 0 for the default.
+  * @returns The thread, NULL if OS_SOFT_THREADS exist already or the pthread could not be created.
+  */
+static osThreadId createThread(os_pthread function, void* argument, osPriority priority, uint32_t size){
+	osThreadId t;
+	pthread_attr_t attributes;
+	void* stack;
+
+	if(threadCount >= OS_SOFT_THREADS){
+		return NULL;
+	}
+	t = &threads[threadCount];
+	memset(t, 0, sizeof(*t));
+	pthread_cond_init(&t->wake, NULL);
+	t->function = function;
+	t->argument = argument;
+	t->priority = priority;
+	t->state = ThreadInactive;
+	t->runCost = OS_SOFT_RUN_COST_US;
+	if(function == NULL){
+		t->thread = pthread_self();
+		threadCount++;
+		return t;
+	}
+	if(size == 0){
+		size = STACK_WATCH_DEFAULT_SIZE;
+	}
+	if(size < OS_SOFT_STACK_MIN){
+		size = OS_SOFT_STACK_MIN;
+	}
+	if(posix_memalign(&stack, 4096, size) != 0){
+		return NULL;
+	}
+	// The thread finds its stack with stackWatchAddCurrent, as on the target
+	stackWatchPaint(stack, size);
+	pthread_attr_init(&attributes);
+	pthread_attr_setstack(&attributes, stack, size);
+	if(pthread_create(&t->thread, &attributes, threadEntry, t) != 0){
+		pthread_attr_destroy(&attributes);
+		free(stack);
+		return NULL;
+	}
+	pthread_attr_destroy(&attributes);
+	t->stack = stack;
+	t->stackSize = size;
+	threadCount++;
+	makeReady(t);
+	return t;
+}
+
+/**
+  * @brief Returns the stack of the calling thread, painted for the stack watch when the thread was created.
+  * @param base Set to the lowest address of the stack.
+  * @param size Set to the bytes in the stack.
+  * @returns 0 on success, -1 for the main thread and pthreads the kernel did not create, which have stacks of their own.
+  */
+int osSoftThreadStack(void** base, uint32_t* size){
+	if(self == NULL || self->stack == NULL){
+		return -1;
+	}
+	*base = self->stack;
+	*size = self->stackSize;
+	return 0;
+}
+
+/**
+  * @brief Sets the virtual microseconds a thread is charged for each run, in place of OS_SOFT_RUN_COST_US.
+  *        The costs only move the clock of the trace on, never os_time, so a run repeats as without them.
+  * @param thread_id The thread.
+  * @param micros Microseconds per run, 0 for a thread that stands for no work of the firmware.
+  * @returns osOK, osErrorParameter for an unknown thread.
+  */
+osStatus osSoftSetRunCost(osThreadId thread_id, uint32_t micros){
+	if(thread_id == NULL){
+		return osErrorParameter;
+	}
+	pthread_mutex_lock(&kernel);
+	thread_id->runCost = micros;
+	pthread_mutex_unlock(&kernel);
+	return osOK;
+}
+
+/**
+  * @brief Reads the virtual clock of the trace. In virtual time it is os_time in microseconds plus whatever the
+  *        runs of the threads cost beyond it, so the trace gives each thread its share of the CPU. Otherwise it is
+  *        the real time.
+  * @param None.
+  * @returns Microseconds, wrapping every 2^32.
+  */
+uint32_t osSoftMicros(void){
+#ifdef OS_SOFT_VIRTUAL_TIME
+	return (uint32_t)virtualMicros;
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)((uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000);
+#endif
+}
+
+/**
+  * @brief Makes the calling pthread the main thread, of normal priority, and creates the timer thread.
+  * @param None.
+  * @returns osOK, osErrorOS if called twice.
+  */
+osStatus osKernelInitialize(void){
+	pthread_mutex_lock(&kernel);
+	if(threadCount != 0){
+		pthread_mutex_unlock(&kernel);
+		return osErrorOS;
+	}
+	self = createThread(NULL, NULL, osPriorityNormal, 0);
+	running = self;
+	self->state = ThreadRunning;
+	timerThread = createThread(timerTask, NULL, OS_SOFT_TIMER_PRIORITY, 0);
+	traceName(&idleMarker, "idle");
+	traceName(timerThread, "timer");
+	traceSwitch(self);
+	pthread_mutex_unlock(&kernel);
+	return osOK;
+}
+
+/**
+  * @brief Called by osKernelStart before any thread runs. Does nothing unless a host test defines its own,
+  *        which can create the threads that drive the test.
+  * @param None.
+  * @returns Void.
+  */
+__attribute__((weak)) void osSoftStarting(void){
+}
+
+/**
+  * @brief Starts the tick and switching threads. The caller carries on as the main thread once no ready
+  *        thread has a higher priority.
+  * @param None.
+  * @returns osOK, osErrorOS if osKernelInitialize was not called or the tick could not be started.
+  */
+osStatus osKernelStart(void){
+	osSoftStarting();
+	pthread_mutex_lock(&kernel);
+	if(self == NULL || started){
+		pthread_mutex_unlock(&kernel);
+		return osErrorOS;
+	}
+#ifndef OS_SOFT_VIRTUAL_TIME
+	if(pthread_create(&tickThread, NULL, tickTask, NULL) != 0){
+		pthread_mutex_unlock(&kernel);
+		return osErrorOS;
+	}
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+	started = true;
+	// Threads of higher priority created before the start run first
+	preempt(self);
+	pthread_mutex_unlock(&kernel);
+	return osOK;
+}
+
+/**
+  * @brief Returns whether the kernel has started.
+  * @param None.
+  * @returns 1 once osKernelStart was called, 0 before.
+  */
+int32_t osKernelRunning(void){
+	return started ? 1 : 0;
+}
+
+/**
+  * @brief Reads the kernel timer, counting at OS_SOFT_CLOCK like the SysTick counts at the core clock.
+  *        In virtual time it only counts whole ticks.
+  * @param None.
+  * @returns The count, wrapping every 2^32 counts.
+  */
+uint32_t osKernelSysTick(void){
+#ifdef OS_SOFT_VIRTUAL_TIME
+	return (uint32_t)((uint64_t)os_time * (OS_SOFT_CLOCK / 1000) * OS_SOFT_TICK_MS);
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)(((uint64_t)now.tv_sec * 1000000000 + now.tv_nsec) * (OS_SOFT_CLOCK / 1000000) / 1000);
+#endif
+}
+
+/**
+  * @brief Creates a thread, which runs once it is the highest-priority ready thread.
+  * @param thread_def Definition from osThreadDef.
+  * @param argument Passed to the thread function.
+  * @returns The thread, NULL if it could not be created.
+  */
+osThreadId osThreadCreate(const osThreadDef_t* thread_def, void* argument){
+	osThreadId t;
+
+	if(thread_def == NULL || thread_def->pthread == NULL){
+		return NULL;
+	}
+	pthread_mutex_lock(&kernel);
+	t = createThread(thread_def->pthread, argument, thread_def->tpriority, thread_def->stacksize);
+	preempt(self);
+	pthread_mutex_unlock(&kernel);
+	return t;
+}
+
+/**
+  * @brief Returns the calling thread.
+  * @param None.
+  * @returns The thread, NULL from an interrupt.
+  */
+osThreadId osThreadGetId(void){
+	return self;
+}
+
+/**
+  * @brief Hands the CPU to the next ready thread of the same priority.
+  * @param None.
+  * @returns osOK, osErrorISR from an interrupt.
+  */
+osStatus osThreadYield(void){
+	osThreadId next;
+
+	if(self == NULL){
+		return osErrorISR;
+	}
+	pthread_mutex_lock(&kernel);
+	next = highestReady();
+	if(started && next != NULL && next->priority >= self->priority){
+		makeReady(self);
+		suspend(self);
+	}
+	pthread_mutex_unlock(&kernel);
+	return osOK;
+}
+
+/**
+  * @brief Changes the priority of a thread.
+  * @param thread_id The thread.
+  * @param priority The new priority.
+  * @returns osOK, osErrorParameter for an unknown thread.
+  */
+osStatus osThreadSetPriority(osThreadId thread_id, osPriority priority){
+	if(thread_id == NULL){
+		return osErrorParameter;
+	}
+	pthread_mutex_lock(&kernel);
+	thread_id->priority = priority;
+	preempt(self);
+	pthread_mutex_unlock(&kernel);
+	return osOK;
+}
+
+/**
+  * @brief Returns the priority of a thread.
+  * @param thread_id The thread.
+  * @returns The priority, osPriorityError for an unknown thread.
+  */
+osPriority osThreadGetPriority(osThreadId thread_id){
+	return (thread_id != NULL) ? thread_id->priority : osPriorityError;
+}
+
+/**
+  * @brief Sleeps the calling thread for a number of ticks. The time the thread is in counts to the first.
+  * @param millisec Time to sleep.
+  * @returns osEventTimeout, osErrorISR from an interrupt.
+  */
+osStatus osDelay(uint32_t millisec){
+	osEvent result;
+
+	if(self == NULL){
+		return osErrorISR;
+	}
+	pthread_mutex_lock(&kernel);
+	result = waitFor(self, WaitDelay, millisec, osEventTimeout);
+	pthread_mutex_unlock(&kernel);
+	return result.status;
+}
+
+/**
+  * @brief Sets signals of a thread, waking it if it waits for them. Callable from interrupts.
+  * @param thread_id The thread.
+  * @param signals The signals to set.
+  * @returns The signals before, 0x80000000 for an unknown thread.
+  */
+int32_t osSignalSet(osThreadId thread_id, int32_t signals){
+	int32_t before;
+
+	if(thread_id == NULL){
+		return (int32_t)0x80000000;
+	}
+	pthread_mutex_lock(&kernel);
+	before = thread_id->signals;
+	thread_id->signals |= signals;
+	update();
+	preempt(self);
+	pthread_mutex_unlock(&kernel);
+	return before;
+}
+
+/**
+  * @brief Clears signals of a thread.
+  * @param thread_id The thread.
+  * @param signals The signals to clear.
+  * @returns The signals before, 0x80000000 for an unknown thread.
+  */
+int32_t osSignalClear(osThreadId thread_id, int32_t signals){
+	int32_t before;
+
+	if(thread_id == NULL){
+		return (int32_t)0x80000000;
+	}
+	pthread_mutex_lock(&kernel);
+	before = thread_id->signals;
+	thread_id->signals &= ~signals;
+	pthread_mutex_unlock(&kernel);
+	return before;
+}
+
+/**
+  * @brief Waits for signals of the calling thread and clears them.
+  * @param signals The signals to wait for all of, 0 for any.
+  * @param millisec Time to wait, osWaitForever to wait without one.
+  * @returns osEventSignal with the signals set before clearing, osEventTimeout, osOK if none were set and
+  *          millisec is 0, osErrorISR from an interrupt.
+  */
+osEvent osSignalWait(int32_t signals, uint32_t millisec){
+	osEvent result;
+
+	if(self == NULL){
+		result.status = osErrorISR;
+		return result;
+	}
+	pthread_mutex_lock(&kernel);
+	self->waitSignals = signals;
+	result = waitFor(self, WaitSignal, millisec, osOK);
+	pthread_mutex_unlock(&kernel);
+	return result;
+}
+
+/**
+  * @brief Creates a message queue in the memory of its definition.
+  * @param queue_def Definition from osMessageQDef.
+  * @param thread_id Unused, as in RTX.
+  * @returns The queue, NULL if OS_SOFT_QUEUES exist already.
+  */
+osMessageQId osMessageCreate(const osMessageQDef_t* queue_def, osThreadId thread_id){
+	osMessageQId q = NULL;
+
+	if(queue_def == NULL || queue_def->queue_sz == 0){
+		return NULL;
+	}
+	pthread_mutex_lock(&kernel);
+	if(queueCount < OS_SOFT_QUEUES){
+		q = &queues[queueCount++];
+		// Skips the words RTX keeps its own state in
+		q->slots = (uint32_t*)queue_def->pool + 4;
+		q->size = queue_def->queue_sz;
+		q->first = 0;
+		q->count = 0;
+	}
+	pthread_mutex_unlock(&kernel);
+	return q;
+}
+
+/**
+  * @brief Puts a message in a queue, waiting for room if it is full. Callable from interrupts with a millisec of 0.
+  * @param queue_id The queue.
+  * @param info The message.
+  * @param millisec Time to wait for room.
+  * @returns osOK, osErrorResource if full and millisec is 0, osErrorTimeoutResource if still full after millisec.
+  */
+osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec){
+	osEvent result;
+
+	if(queue_id == NULL){
+		return osErrorParameter;
+	}
+	pthread_mutex_lock(&kernel);
+	if(queue_id->count < queue_id->size){
+		queue_id->slots[(queue_id->first + queue_id->count) % queue_id->size] = info;
+		queue_id->count++;
+		result.status = osOK;
+		update();
+		preempt(self);
+	}else if(self == NULL){
+		result.status = osErrorResource;
+	}else{
+		self->queue = queue_id;
+		self->message = info;
+		result = waitFor(self, WaitSpace, millisec, osErrorResource);
+	}
+	pthread_mutex_unlock(&kernel);
+	return result.status;
+}
+
+/**
+  * @brief Takes the oldest message of a queue, waiting for one if it is empty.
+  * @param queue_id The queue.
+  * @param millisec Time to wait for a message.
+  * @returns osEventMessage with the message, osEventTimeout, or osOK if empty and millisec is 0.
+  */
+osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec){
+	osEvent result;
+
+	if(queue_id == NULL){
+		result.status = osErrorParameter;
+		return result;
+	}
+	pthread_mutex_lock(&kernel);
+	if(self == NULL){
+		// An interrupt only takes a message that is there
+		result.status = osOK;
+		if(queue_id->count > 0){
+			result.status = osEventMessage;
+			result.value.v = queue_id->slots[queue_id->first];
+			result.def.message_id = queue_id;
+			queue_id->first = (queue_id->first + 1) % queue_id->size;
+			queue_id->count--;
+			update();
+		}
+	}else{
+		self->queue = queue_id;
+		result = waitFor(self, WaitMessage, millisec, osOK);
+		// Room was made for a thread waiting to put
+		update();
+		preempt(self);
+	}
+	pthread_mutex_unlock(&kernel);
+	return result;
+}
+
+/**
+  * @brief Creates a timer, stopped.
+  * @param timer_def Definition from osTimerDef.
+  * @param type osTimerOnce or osTimerPeriodic.
+  * @param argument Passed to the callback.
+  * @returns The timer, NULL if OS_SOFT_TIMERS exist already.
+  */
+osTimerId osTimerCreate(const osTimerDef_t* timer_def, os_timer_type type, void* argument){
+	osTimerId timer = NULL;
+	int i;
+
+	if(timer_def == NULL || timer_def->ptimer == NULL){
+		return NULL;
+	}
+	pthread_mutex_lock(&kernel);
+	for(i = 0; i < OS_SOFT_TIMERS && timer == NULL; i++){
+		if(!timers[i].used){
+			timer = &timers[i];
+			memset(timer, 0, sizeof(*timer));
+			timer->used = true;
+			timer->callback = timer_def->ptimer;
+			timer->argument = argument;
+			timer->type = type;
+		}
+	}
+	pthread_mutex_unlock(&kernel);
+	return timer;
+}
+
+/**
+  * @brief Starts or restarts a timer.
+  * @param timer_id The timer.
+  * @param millisec Time until it fires, and between firings of a periodic timer.
+  * @returns osOK, osErrorParameter for an unknown timer or a millisec of 0.
+  */
+osStatus osTimerStart(osTimerId timer_id, uint32_t millisec){
+	if(timer_id == NULL || millisec / OS_SOFT_TICK_MS == 0){
+		return osErrorParameter;
+	}
+	pthread_mutex_lock(&kernel);
+	timer_id->load = millisec / OS_SOFT_TICK_MS;
+	timer_id->remaining = timer_id->load;
+	timer_id->active = true;
+	pthread_mutex_unlock(&kernel);
+	return osOK;
+}
+
+/**
+  * @brief Stops a timer. A callback already due still runs.
+  * @param timer_id The timer.
+  * @returns osOK, osErrorResource if it was not running.
+  */
+osStatus osTimerStop(osTimerId timer_id){
+	osStatus status;
+
+	if(timer_id == NULL){
+		return osErrorParameter;
+	}
+	pthread_mutex_lock(&kernel);
+	status = timer_id->active ? osOK : osErrorResource;
+	timer_id->active = false;
+	pthread_mutex_unlock(&kernel);
+	return status;
+}
+
+/**
+  * @brief Copies the counters since osKernelStart. In virtual time, simulatedPerReal is the benchmark of the
+  *        scheduler: simulated seconds per real second.
+  * @param stats Filled in.
+  * @returns Void.
+  */
+void osSoftGetStats(osSoftStats* stats){
+	struct timespec now;
+	uint64_t real;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	pthread_mutex_lock(&kernel);
+	real = ((uint64_t)(now.tv_sec - startTime.tv_sec) * 1000000000 + now.tv_nsec - startTime.tv_nsec) / 1000000;
+	stats->simulatedMillis = started ? os_time * OS_SOFT_TICK_MS : 0;
+	stats->realMillis = started ? (uint32_t)real : 0;
+	stats->simulatedPerReal = (stats->realMillis != 0) ? stats->simulatedMillis / stats->realMillis : 0;
+	stats->switches = switches;
+	stats->jumps = jumps;
+	pthread_mutex_unlock(&kernel);
+}
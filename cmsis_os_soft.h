@@ -0,0 +1,76 @@
+/**
+  * @file cmsis_os_soft.h
+  * @brief Header file of the cmsis_os_soft.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef CMSIS_OS_SOFT_H
+#define CMSIS_OS_SOFT_H
+
+#include <stdint.h>
+#include "cmsis_os.h"
+
+/**
+  * @brief Runs the kernel in virtual time: the time jumps to the next timeout whenever every thread waits,
+  *        so runs repeat exactly and take no longer than the threads compute. Comment out to tick in real time.
+  */
+#define OS_SOFT_VIRTUAL_TIME
+
+/**
+  * @brief Kernel tick in milliseconds, OS_TICK of RTX_Conf_CM.c, and the rate osKernelSysTick counts at, OS_CLOCK.
+  */
+#define OS_SOFT_TICK_MS 1
+#define OS_SOFT_CLOCK 216000000
+
+/**
+  * @brief Ticks a thread runs before a ready thread of the same priority takes over, OS_ROBINTOUT.
+  */
+#define OS_SOFT_ROBIN_TICKS 5
+
+/**
+  * @brief Priority of the thread that runs the timer callbacks, OS_TIMERPRIO.
+  */
+#define OS_SOFT_TIMER_PRIORITY osPriorityHigh
+
+/**
+  * @brief Smallest stack a host thread gets in bytes, host code needs more stack than the target's.
+  */
+#define OS_SOFT_STACK_MIN (64 * 1024)
+
+/**
+  * @brief Threads that can exist at once, OS_TASKCNT plus the main and timer threads.
+  */
+#define OS_SOFT_THREADS 8
+
+/**
+  * @brief Virtual microseconds a thread is charged for each run in virtual time, unless osSoftSetRunCost gives it
+  *        another cost: the work a firmware thread does between two waits on the board.
+  */
+#define OS_SOFT_RUN_COST_US 50
+
+/**
+  * @brief A struct containing the counters of the kernel since osKernelStart.
+  *        simulatedPerReal is simulatedMillis / realMillis, rounded down.
+  */
+typedef struct{
+	uint32_t simulatedMillis;
+	uint32_t realMillis;
+	uint32_t simulatedPerReal;
+	uint32_t switches;
+	uint32_t jumps;
+	}osSoftStats;
+
+/**
+  * @brief Kernel ticks since osKernelStart, kept by RTX on the target.
+  */
+extern uint32_t os_time;
+
+int osSoftThreadStack(void** base, uint32_t* size);
+osStatus osSoftSetRunCost(osThreadId thread_id, uint32_t micros);
+uint32_t osSoftMicros(void);
+void osSoftGetStats(osSoftStats* stats);
+void osSoftStarting(void);
+
+#endif
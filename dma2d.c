@@ -0,0 +1,257 @@
+/**
+  * @file dma2d.c
+  * @brief Define functions that copy and fill pixel rectangles with the DMA2D, or the CPU when it is not available.
+  *        Transfers are started without waiting, so the CPU can prepare the next one;
+  *        call dma2dWait before reading or drawing over the destination.
+  *        The data cache is kept coherent here: sources are cleaned before a transfer starts,
+  *        and the destination is cleaned before and invalidated once dma2dWait sees the transfer done.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdbool.h>
+#include <string.h>
+#include "dma2d.h"
+#include "platform.h"
+#ifndef GLCD_SOFT
+#include "stm32f7xx_hal.h"
+#endif
+
+#if defined(GLCD_SOFT)
+#undef DMA2D_ENABLED
+#endif
+
+#ifdef DMA2D_ENABLED
+
+/**
+  * @brief DMA2D transfer modes.
+  */
+#define DMA2D_MODE_M2M       0
+#define DMA2D_MODE_M2M_BLEND 2
+#define DMA2D_MODE_R2M       3
+
+/**
+  * @brief DMA2D colour modes, the copy takes its bytes per pixel from them.
+  */
+#define DMA2D_FORMAT_RGB565 2
+#define DMA2D_FORMAT_L8     5
+#define DMA2D_FORMAT_A4     10
+
+/**
+  * @brief Set once the DMA2D clock is on.
+  */
+static bool clockEnabled = false;
+
+/**
+  * @brief Destination of the running transfer, dropped from the data cache when it is done.
+  */
+static void* outputStart;
+static uint32_t outputBytes = 0;
+
+/**
+  * @brief Returns the bytes from the first to the last pixel of a rectangle.
+  * @param pitch Row length in pixels.
+  * @param width,height Size of the rectangle in pixels.
+  * @param bytesPerPixel Bytes of one pixel.
+  * @returns Bytes.
+  */
+static uint32_t areaBytes(uint32_t pitch, uint32_t width, uint32_t height, uint32_t bytesPerPixel){
+	return (height == 0) ? 0 : ((height - 1) * pitch + width) * bytesPerPixel;
+}
+
+/**
+  * @brief Makes memory coherent for a transfer and starts it.
+  * @param src,srcBytes Area the transfer reads, NULL for none.
+  * @param dst,dstBytes Area the transfer writes.
+  * @returns Void.
+  */
+static void dma2dStart(const void* src, uint32_t srcBytes, void* dst, uint32_t dstBytes){
+	if(src != NULL){
+		cacheClean(src, srcBytes);
+	}
+	// Dirty lines written back later would overwrite the transfer's output
+	cacheCleanInvalidate(dst, dstBytes);
+	outputStart = dst;
+	outputBytes = dstBytes;
+	DMA2D->CR |= DMA2D_CR_START;
+}
+
+/**
+  * @brief Waits for the running transfer and prepares the DMA2D for the next one.
+  * @param mode The transfer mode of the next transfer.
+  * @returns Void.
+  */
+static void dma2dPrepare(uint32_t mode){
+	if(!clockEnabled){
+		__HAL_RCC_DMA2D_CLK_ENABLE();
+		clockEnabled = true;
+	}
+	dma2dWait();
+	DMA2D->CR = mode << DMA2D_CR_MODE_Pos;
+}
+
+#else
+
+/**
+  * @brief Weight out of 32 of the foreground for each 4-bit coverage, so full coverage is exactly the foreground.
+  */
+static const uint8_t coverageWeight[16] = {
+	0, 2, 4, 6, 9, 11, 13, 15, 17, 19, 21, 23, 26, 28, 30, 32
+};
+
+/**
+  * @brief Blends a foreground over one RGB565 pixel, with green moved to the top half-word
+  *        so the three channels are weighted in one multiply.
+  * @param spreadColor Foreground with green moved up: (color | color << 16) & 0x07E0F81F.
+  * @param below The pixel blended over.
+  * @param weight Weight of the foreground, 0 to 32.
+  * @returns RGB565 colour.
+  */
+static uint16_t blendSpread(uint32_t spreadColor, uint16_t below, uint32_t weight){
+	uint32_t spreadBelow = (below | ((uint32_t)below << 16)) & 0x07E0F81F;
+	uint32_t mixed = ((((spreadColor - spreadBelow) * weight) >> 5) + spreadBelow) & 0x07E0F81F;
+	return (uint16_t)(mixed | (mixed >> 16));
+}
+
+#endif
+
+/**
+  * @brief Copies a rectangle of pixels.
+  * @param dst,dstPitch First destination pixel and destination row length in pixels.
+  * @param src,srcPitch First source pixel and source row length in pixels.
+  * @param width,height Size of the rectangle in pixels.
+  * @param bytesPerPixel 2 for RGB565, 1 for palette indices.
+  * @returns Void.
+  */
+void dma2dCopy(void* dst, uint32_t dstPitch, const void* src, uint32_t srcPitch,
+		uint32_t width, uint32_t height, uint32_t bytesPerPixel){
+#ifdef DMA2D_ENABLED
+	uint32_t format = (bytesPerPixel == 1) ? DMA2D_FORMAT_L8 : DMA2D_FORMAT_RGB565;
+	dma2dPrepare(DMA2D_MODE_M2M);
+	DMA2D->FGMAR = (uint32_t)src;
+	DMA2D->FGOR = srcPitch - width;
+	DMA2D->FGPFCCR = format;
+	DMA2D->OPFCCR = format;
+	DMA2D->OMAR = (uint32_t)dst;
+	DMA2D->OOR = dstPitch - width;
+	DMA2D->NLR = (width << DMA2D_NLR_PL_Pos) | height;
+	dma2dStart(src, areaBytes(srcPitch, width, height, bytesPerPixel),
+			dst, areaBytes(dstPitch, width, height, bytesPerPixel));
+#else
+	uint8_t* to = (uint8_t*)dst;
+	const uint8_t* from = (const uint8_t*)src;
+	for(; height > 0; height--){
+		memcpy(to, from, width * bytesPerPixel);
+		to += dstPitch * bytesPerPixel;
+		from += srcPitch * bytesPerPixel;
+	}
+#endif
+}
+
+/**
+  * @brief Fills a rectangle of pixels with one value.
+  * @param dst,dstPitch First destination pixel and destination row length in pixels.
+  * @param width,height Size of the rectangle in pixels.
+  * @param value The RGB565 colour or palette index to fill with.
+  * @param bytesPerPixel 2 for RGB565, 1 for palette indices.
+  * @returns Void.
+  */
+void dma2dFill(void* dst, uint32_t dstPitch, uint32_t width, uint32_t height,
+		uint32_t value, uint32_t bytesPerPixel){
+	uint8_t* row = (uint8_t*)dst;
+	uint16_t* pixel;
+	uint32_t i;
+#ifdef DMA2D_ENABLED
+	// The register-to-memory mode cannot write 8-bit pixels
+	if(bytesPerPixel == 2){
+		dma2dPrepare(DMA2D_MODE_R2M);
+		DMA2D->OPFCCR = DMA2D_FORMAT_RGB565;
+		DMA2D->OCOLR = value;
+		DMA2D->OMAR = (uint32_t)dst;
+		DMA2D->OOR = dstPitch - width;
+		DMA2D->NLR = (width << DMA2D_NLR_PL_Pos) | height;
+		dma2dStart(NULL, 0, dst, areaBytes(dstPitch, width, height, 2));
+		return;
+	}
+	dma2dWait();
+#endif
+	for(; height > 0; height--, row += dstPitch * bytesPerPixel){
+		if(bytesPerPixel == 1){
+			memset(row, (int)value, width);
+		}else{
+			for(pixel = (uint16_t*)row, i = 0; i < width; i++){
+				pixel[i] = (uint16_t)value;
+			}
+		}
+	}
+}
+
+/**
+  * @brief Blends one colour over a rectangle of RGB565 pixels through a 4-bit coverage mask.
+  * @param dst,dstPitch First destination pixel and destination row length in pixels.
+  * @param alpha Coverage, two pixels per byte with the left pixel in the low nibble, rows packed without padding.
+  * @param width,height Size of the rectangle in pixels, width even.
+  * @param color RGB565 colour drawn where the coverage is 15.
+  * @returns Void.
+  */
+void dma2dBlendA4(void* dst, uint32_t dstPitch, const uint8_t* alpha,
+		uint32_t width, uint32_t height, uint16_t color){
+#ifdef DMA2D_ENABLED
+	// The foreground colour register takes RGB888
+	uint32_t rgb888 = ((uint32_t)(color & 0xF800) << 8) | ((uint32_t)(color & 0x07E0) << 5) | ((color & 0x1F) << 3);
+	dma2dPrepare(DMA2D_MODE_M2M_BLEND);
+	DMA2D->FGMAR = (uint32_t)alpha;
+	DMA2D->FGOR = 0;
+	DMA2D->FGPFCCR = DMA2D_FORMAT_A4;
+	DMA2D->FGCOLR = rgb888;
+	DMA2D->BGMAR = (uint32_t)dst;
+	DMA2D->BGOR = dstPitch - width;
+	DMA2D->BGPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OPFCCR = DMA2D_FORMAT_RGB565;
+	DMA2D->OMAR = (uint32_t)dst;
+	DMA2D->OOR = dstPitch - width;
+	DMA2D->NLR = (width << DMA2D_NLR_PL_Pos) | height;
+	// The background is the destination, cleaned with it
+	dma2dStart(alpha, width * height / 2, dst, areaBytes(dstPitch, width, height, 2));
+#else
+	uint32_t spreadColor = (color | ((uint32_t)color << 16)) & 0x07E0F81F;
+	uint32_t colorPair = color | ((uint32_t)color << 16);
+	uint16_t* row = (uint16_t*)dst;
+	uint32_t i;
+	uint8_t pair;
+
+	for(; height > 0; height--, row += dstPitch){
+		for(i = 0; i < width; i += 2){
+			pair = *alpha++;
+			// Most bytes are outside the glyph or inside a stroke
+			if(pair == 0x00){
+				continue;
+			}
+			if(pair == 0xFF){
+				// One word store for both pixels
+				memcpy(&row[i], &colorPair, sizeof(colorPair));
+				continue;
+			}
+			row[i] = blendSpread(spreadColor, row[i], coverageWeight[pair & 0x0F]);
+			row[i + 1] = blendSpread(spreadColor, row[i + 1], coverageWeight[pair >> 4]);
+		}
+	}
+#endif
+}
+
+/**
+  * @brief Waits until the last started transfer has finished.
+  * @param None.
+  * @returns Void.
+  */
+void dma2dWait(void){
+#ifdef DMA2D_ENABLED
+	while(DMA2D->CR & DMA2D_CR_START){
+	}
+	if(outputBytes > 0){
+		cacheInvalidate(outputStart, outputBytes);
+		outputBytes = 0;
+	}
+#endif
+}
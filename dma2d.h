@@ -0,0 +1,28 @@
+/**
+  * @file dma2d.h
+  * @brief Header file of the dma2d.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef DMA2D_H
+#define DMA2D_H
+
+#include <stdint.h>
+
+/**
+  * @brief Use the DMA2D for rectangle copies and fills.
+  *        Comment out to do them with the CPU. Always off when GLCD_SOFT is defined.
+  */
+#define DMA2D_ENABLED
+
+void dma2dCopy(void* dst, uint32_t dstPitch, const void* src, uint32_t srcPitch,
+		uint32_t width, uint32_t height, uint32_t bytesPerPixel);
+void dma2dFill(void* dst, uint32_t dstPitch, uint32_t width, uint32_t height,
+		uint32_t value, uint32_t bytesPerPixel);
+void dma2dBlendA4(void* dst, uint32_t dstPitch, const uint8_t* alpha,
+		uint32_t width, uint32_t height, uint16_t color);
+void dma2dWait(void);
+
+#endif
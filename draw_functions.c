@@ -7,6 +7,7 @@
 
 #include "main.h"
 #include "draw_functions.h"
+#include "prng.h"
 
 /**
   * @brief A function to generate stars in the background,
@@ -27,12 +28,11 @@ void drawStar(int x, int y){
 }
 
 /**
-  * @brief A function to generate the background for the GUI
+  * @brief A function to clear the screen and draw the border of the GUI, without stars.
   * @param None.
   * @returns Void.
   */
-void drawBackground(void){
-	unsigned int n;
+void drawBorders(void){
 	GLCD_SetBackgroundColor (GLCD_COLOR_BLACK);
 	GLCD_ClearScreen ();
 	GLCD_SetForegroundColor (GLCD_COLOR_DARK_GREY);
@@ -44,11 +44,34 @@ void drawBackground(void){
 	GLCD_SetForegroundColor (GLCD_COLOR_LIGHT_GREY);
 	GLCD_DrawBargraph(15, 257, 455, 5, 100);
 	GLCD_DrawBargraph(465, 15, 5, 242, 100);
+	return;
+}
+
+/**
+  * @brief Number of random stars drawn by drawBackground.
+  */
+#define BACKGROUND_STARS 100
+
+/**
+  * @brief A function to generate the background for the GUI.
+  *        Star positions come from the PrngBackground stream, seed it for a repeatable layout.
+  * @param None.
+  * @returns Void.
+  */
+void drawBackground(void){
+	unsigned int n;
+	uint16_t starX[BACKGROUND_STARS];
+	uint16_t starY[BACKGROUND_STARS];
+	uint32_t start = profBegin();
+	drawBorders();
 	
+	prngFill(prngStream(PrngBackground), starX, BACKGROUND_STARS, 15, 445);
+	prngFill(prngStream(PrngBackground), starY, BACKGROUND_STARS, 15, 237);
 	GLCD_SetForegroundColor (GLCD_COLOR_WHITE);
-	for(n=0; n<100; n++){
-		drawStar((rand() % 445)+15, (rand() % 237)+15);
+	for(n=0; n<BACKGROUND_STARS; n++){
+		drawStar(starX[n], starY[n]);
 	}
 	drawStar(100, 100);
+	profEnd(ProfBackground, start, 0);
 	return;
 }
\ No newline at end of file
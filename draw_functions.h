@@ -7,4 +7,5 @@
   */ 
   
 void drawStar(int x, int y);
+void drawBorders(void);
 void drawBackground(void);
@@ -0,0 +1,154 @@
+/**
+  * @file events.c
+  * @brief Define functions for the single queue that carries touch, score, lid, timer, frame and bus events to the UI.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "main.h"
+#include "events.h"
+
+/**
+  * @brief Mask of the payload bits below the event type in a queue word.
+  */
+#define EVENT_PAYLOAD_MASK 0x0FFFFFFF
+
+/**
+  * @brief Defining the queue of packed UI events.
+  */
+osMessageQDef(eventQueue, EVENT_QUEUE_SIZE, uint32_t);
+
+/**
+  * @brief Message queue ID for UI events.
+  */
+osMessageQId eventQueueId;
+
+/**
+  * @brief Callback of the periodic UI timer.
+  */
+static void eventTimerCallback(void const* argument);
+
+/**
+  * @brief Defining the periodic UI timer.
+  */
+osTimerDef(eventTimer, eventTimerCallback);
+
+/**
+  * @brief Timer ID for the periodic UI timer.
+  */
+osTimerId eventTimerId;
+
+/**
+  * @brief Number of timer ticks posted since start-up.
+  */
+static uint32_t timerTicks = 0;
+
+/**
+  * @brief Number of events lost because the queue was full.
+  */
+static uint32_t droppedEvents = 0;
+
+/**
+  * @brief Puts a packed event word into the queue without blocking.
+  * @param message Event type in the top four bits, payload below.
+  * @returns true if the event was queued, false if it was dropped.
+  */
+ITCM_CODE static bool postMessage(uint32_t message){
+	if(osMessagePut(eventQueueId, message, 0) != osOK){
+		droppedEvents++;
+		return false;
+	}
+	return true;
+}
+
+/**
+  * @brief Posts a timer event for every period of the UI timer.
+  * @param argument Timer callback default argument paramater.
+  * @returns Void.
+  */
+static void eventTimerCallback(void const* argument){
+	timerTicks++;
+	postEvent(EventTimer, timerTicks & EVENT_PAYLOAD_MASK);
+}
+
+/**
+  * @brief Creates the event queue and the UI timer. Must be called before any event is posted.
+  * @param None.
+  * @returns Void.
+  */
+void eventsInitialize(void){
+	eventQueueId = osMessageCreate(osMessageQ(eventQueue), NULL);
+	eventTimerId = osTimerCreate(osTimer(eventTimer), osTimerPeriodic, NULL);
+}
+
+/**
+  * @brief Posts a score, lid or timer event. Safe to call from threads, timers and interrupts.
+  * @param type The kind of event.
+  * @param value The event value, must fit in 28 bits.
+  * @returns true if the event was queued, false if it was dropped.
+  */
+ITCM_CODE bool postEvent(enum eventType type, int value){
+	return postMessage(((uint32_t)type << 28) | ((uint32_t)value & EVENT_PAYLOAD_MASK));
+}
+
+/**
+  * @brief Posts a touch event.
+  * @param type The kind of touch event.
+  * @param x,y The co-ordinates of the touch.
+  * @returns true if the event was queued, false if it was dropped.
+  */
+bool postTouchEvent(enum touchType type, int x, int y){
+	return postMessage(((uint32_t)EventTouch << 28) | ((uint32_t)type << 24)
+			| (((uint32_t)x & 0xFFF) << 12) | ((uint32_t)y & 0xFFF));
+}
+
+/**
+  * @brief Waits for the next UI event.
+  * @param e Filled with the event when one is available.
+  * @param millisec Time to wait in ms, 0 to poll or osWaitForever to block.
+  * @returns true if an event was received, false on timeout.
+  */
+bool waitEvent(event* e, uint32_t millisec){
+	osEvent result = osMessageGet(eventQueueId, millisec);
+	uint32_t message;
+	if(result.status != osEventMessage){
+		return false;
+	}
+	message = result.value.v;
+	e->type = (enum eventType)(message >> 28);
+	e->value = message & EVENT_PAYLOAD_MASK;
+	if(e->type == EventTouch){
+		e->touch.type = (enum touchType)((message >> 24) & 0x0F);
+		e->touch.x = (message >> 12) & 0xFFF;
+		e->touch.y = message & 0xFFF;
+	}
+	return true;
+}
+
+/**
+  * @brief Starts posting timer events periodically.
+  * @param millisec The timer period in ms.
+  * @returns Void.
+  */
+void eventTimerStart(uint32_t millisec){
+	osTimerStart(eventTimerId, millisec);
+}
+
+/**
+  * @brief Stops the periodic timer events.
+  * @param None.
+  * @returns Void.
+  */
+void eventTimerStop(void){
+	osTimerStop(eventTimerId);
+}
+
+/**
+  * @brief Returns how many events were dropped because the queue was full.
+  * @param None.
+  * @returns Dropped event count.
+  */
+uint32_t eventDroppedCount(void){
+	return droppedEvents;
+}
@@ -0,0 +1,54 @@
+/**
+  * @file events.h
+  * @brief Header file of the events.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "touch_input.h"
+
+/**
+  * @brief Number of events the queue can hold before new ones are dropped.
+  */
+#define EVENT_QUEUE_SIZE 32
+
+/**
+  * @brief An enum containing the different sources of UI events.
+  */
+enum eventType{
+	EventTouch,
+	EventScore,
+	EventLid,
+	EventTimer,
+	EventFrame,
+	EventBus
+};
+
+/**
+  * @brief A struct containing a decoded UI event.
+  *        touch is valid for EventTouch, value holds the player number for EventScore,
+  *        1 for an open and 0 for a closed lid for EventLid, and the tick count for EventTimer.
+  *        EventFrame has no value, framePacerBegin tells how many frames it stands for.
+  *        EventBus holds the enum busTopic that has new messages for the UI.
+  */
+typedef struct{
+	enum eventType type;
+	touchEvent touch;
+	int value;
+	}event;
+
+void eventsInitialize(void);
+bool postEvent(enum eventType type, int value);
+bool postTouchEvent(enum touchType type, int x, int y);
+bool waitEvent(event* e, uint32_t millisec);
+void eventTimerStart(uint32_t millisec);
+void eventTimerStop(void);
+uint32_t eventDroppedCount(void);
+
+#endif
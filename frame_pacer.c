@@ -0,0 +1,229 @@
+/**
+  * @file frame_pacer.c
+  * @brief Define functions that pace the UI to the display refresh.
+  *        The LTDC line interrupt fires as each frame finishes scanning out, and every FRAME_PACER_INTERVAL
+  *        frames it posts an EventFrame. Only one EventFrame is queued at a time: ticks that come while one
+  *        is waiting are merged into it and counted as missed, so an overloaded UI skips frames instead of
+  *        falling behind. Define GLCD_SOFT to build for the host, where framePacerSimulate stands in for
+  *        the display and time is simulated.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdbool.h>
+#include "events.h"
+#include "frame_pacer.h"
+#include "platform.h"
+#ifdef GLCD_SOFT
+#define PACER_BARRIER() __sync_synchronize()
+#else
+#include "stm32f7xx_hal.h"
+#define PACER_BARRIER() __DMB()
+#endif
+
+/**
+  * @brief Display frames seen, UI ticks raised, and the timestamp of the latest tick. Written by the interrupt.
+  */
+static volatile uint32_t displayFrames = 0;
+static volatile uint32_t uiTicks = 0;
+static volatile uint32_t tickStamp = 0;
+
+/**
+  * @brief Display frames since the last UI tick.
+  */
+static volatile uint32_t phase = 0;
+
+/**
+  * @brief Set while an EventFrame is in the queue.
+  */
+static volatile bool pending = false;
+
+/**
+  * @brief Length of one display frame in clock ticks, measured on the target.
+  */
+static volatile uint32_t periodTicks = 0;
+
+/**
+  * @brief Timestamp of the latest display frame.
+  */
+static volatile uint32_t vsyncStamp = 0;
+
+/**
+  * @brief UI ticks already handled, and the tick the running UI frame started from.
+  */
+static uint32_t consumedTicks = 0;
+static uint32_t beginStamp = 0;
+
+/**
+  * @brief UI frames run, ticks merged into later frames, and the slack of the UI frames.
+  */
+static uint32_t uiFrames = 0;
+static uint32_t missedFrames = 0;
+static int32_t lastSlack = 0;
+static int32_t worstSlack = 0;
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Simulated time in microseconds, and when the simulated display finishes its next frame.
+  */
+static uint32_t hostMicros = 0;
+static uint32_t nextVsync = FRAME_PACER_PERIOD_US;
+#endif
+
+/**
+  * @brief Returns the clock frames are timed with.
+  * @param None.
+  * @returns Simulated microseconds on the host, cycles on the target.
+  */
+static uint32_t pacerClock(void){
+#ifdef GLCD_SOFT
+	return hostMicros;
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+/**
+  * @brief Returns the number of pacerClock ticks in a microsecond.
+  * @param None.
+  * @returns Ticks.
+  */
+static uint32_t ticksPerMicro(void){
+#ifdef GLCD_SOFT
+	return 1;
+#else
+	return SystemCoreClock / 1000000;
+#endif
+}
+
+/**
+  * @brief Starts the frame interrupt. The event queue must exist, the first EventFrame follows within two frames.
+  * @param None.
+  * @returns Void.
+  */
+void framePacerInitialize(void){
+	periodTicks = FRAME_PACER_PERIOD_US * ticksPerMicro();
+#ifndef GLCD_SOFT
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	// Interrupt on the first line after the active area, as vertical blanking starts
+	LTDC->LIPCR = (LTDC->AWCR & LTDC_AWCR_AAH) + 1;
+	LTDC->ICR = LTDC_ICR_CLIF;
+	LTDC->IER |= LTDC_IER_LIE;
+	HAL_NVIC_SetPriority(LTDC_IRQn, 0x0F, 0);
+	HAL_NVIC_EnableIRQ(LTDC_IRQn);
+#endif
+	vsyncStamp = pacerClock();
+}
+
+/**
+  * @brief Counts one display frame and raises a UI tick every FRAME_PACER_INTERVAL frames.
+  *        Called from the LTDC interrupt, or from framePacerSimulate on the host.
+  * @param None.
+  * @returns Void.
+  */
+ITCM_CODE void framePacerVsync(void){
+	uint32_t now = pacerClock();
+	// The first interrupt may come part way through a frame
+	if(displayFrames > 0){
+		periodTicks = now - vsyncStamp;
+	}
+	vsyncStamp = now;
+	displayFrames++;
+	if(++phase < FRAME_PACER_INTERVAL){
+		return;
+	}
+	phase = 0;
+	uiTicks++;
+	tickStamp = now;
+	// A frame already waiting takes this tick too, a full queue leaves it for the next one
+	if(!pending){
+		pending = postEvent(EventFrame, 0);
+	}
+}
+
+#ifndef GLCD_SOFT
+/**
+  * @brief Interrupt handler for the LTDC line interrupt.
+  * @param None.
+  * @returns Void.
+  */
+ITCM_CODE void LTDC_IRQHandler(void){
+	if(LTDC->ISR & LTDC_ISR_LIF){
+		LTDC->ICR = LTDC_ICR_CLIF;
+		framePacerVsync();
+	}
+}
+#endif
+
+/**
+  * @brief Starts a UI frame. Call when an EventFrame is received, before updating and drawing.
+  * @param None.
+  * @returns UI ticks this frame stands for, more than 1 when frames were merged, 0 if it has no new tick.
+  */
+uint32_t framePacerBegin(void){
+	uint32_t ticks;
+	uint32_t elapsed;
+
+	// Cleared before uiTicks is read, so a tick raised in between posts its own event. That event may find
+	// its tick already taken here, and then stands for 0 ticks
+	pending = false;
+	PACER_BARRIER();
+	ticks = uiTicks;
+	elapsed = ticks - consumedTicks;
+	beginStamp = tickStamp;
+	consumedTicks = ticks;
+	if(elapsed > 1){
+		missedFrames += elapsed - 1;
+	}
+	return elapsed;
+}
+
+/**
+  * @brief Ends a UI frame and measures how much of its FRAME_PACER_INTERVAL display frames was left.
+  * @param None.
+  * @returns Slack in microseconds, negative when the frame ran over.
+  */
+int32_t framePacerEnd(void){
+	uint32_t budget = periodTicks * FRAME_PACER_INTERVAL;
+	uint32_t used = pacerClock() - beginStamp;
+
+	lastSlack = ((int32_t)budget - (int32_t)used) / (int32_t)ticksPerMicro();
+	if(uiFrames == 0 || lastSlack < worstSlack){
+		worstSlack = lastSlack;
+	}
+	uiFrames++;
+	return lastSlack;
+}
+
+/**
+  * @brief Copies the frame statistics.
+  * @param stats Filled with the statistics.
+  * @returns Void.
+  */
+void framePacerGetStats(framePacerStats* stats){
+	stats->displayFrames = displayFrames;
+	stats->uiFrames = uiFrames;
+	stats->missedFrames = missedFrames;
+	stats->lastSlackMicros = lastSlack;
+	stats->worstSlackMicros = worstSlack;
+}
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Advances the simulated time, finishing display frames every FRAME_PACER_PERIOD_US on the way.
+  *        Call with the time the host code stands for, for example the modelled cost of a UI frame.
+  * @param micros Microseconds to advance.
+  * @returns Void.
+  */
+void framePacerSimulate(uint32_t micros){
+	while(micros >= nextVsync - hostMicros){
+		micros -= nextVsync - hostMicros;
+		hostMicros = nextVsync;
+		nextVsync += FRAME_PACER_PERIOD_US;
+		framePacerVsync();
+	}
+	hostMicros += micros;
+}
+#endif
@@ -0,0 +1,45 @@
+/**
+  * @file frame_pacer.h
+  * @brief Header file of the frame_pacer.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <stdint.h>
+
+/**
+  * @brief Display frames per UI frame. The panel refreshes at about 59 Hz, so 2 runs the UI at about 30 Hz.
+  */
+#define FRAME_PACER_INTERVAL 2
+
+/**
+  * @brief Nominal time between two display frames in microseconds: 566 x 286 pixel clocks at 9.6 MHz.
+  *        The host build steps its simulated display with it, the target measures the real period.
+  */
+#define FRAME_PACER_PERIOD_US 16860
+
+/**
+  * @brief A struct containing the frame statistics since framePacerInitialize.
+  */
+typedef struct{
+	uint32_t displayFrames;
+	uint32_t uiFrames;
+	uint32_t missedFrames;
+	int32_t lastSlackMicros;
+	int32_t worstSlackMicros;
+	}framePacerStats;
+
+void framePacerInitialize(void);
+void framePacerVsync(void);
+uint32_t framePacerBegin(void);
+int32_t framePacerEnd(void);
+void framePacerGetStats(framePacerStats* stats);
+#ifdef GLCD_SOFT
+void framePacerSimulate(uint32_t micros);
+#endif
+
+#endif
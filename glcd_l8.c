@@ -0,0 +1,397 @@
+/**
+  * @file glcd_l8.c
+  * @brief Define the GLCD drawing functions for an 8-bit palette-indexed frame buffer.
+  *        On the board the LTDC layer is switched to L8 after GLCD_Initialize and the palette
+  *        is loaded into its colour lookup table. Define GLCD_SOFT when linking with glcd_soft.c
+  *        instead; glcdL8ToRGB565 then turns the indices back into RGB pixels.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define GLCD_L8_NO_REDIRECT
+#include <string.h>
+#include "GLCD_Config.h"
+#include "glcd_l8.h"
+#ifdef GLCD_SOFT
+#include "glcd_soft.h"
+#else
+#include "stm32f7xx_hal.h"
+#endif
+
+#ifdef GLCD_L8
+
+/**
+  * @brief LTDC pixel format code of an 8-bit indexed layer.
+  */
+#define LTDC_PIXEL_FORMAT_L8 5
+
+/**
+  * @brief The indexed frame buffer, placed in SDRAM behind the RGB565 buffer of the board driver.
+  */
+#ifdef GLCD_SOFT
+static uint8_t l8_buf[GLCD_WIDTH * GLCD_HEIGHT];
+#else
+static uint8_t l8_buf[GLCD_WIDTH * GLCD_HEIGHT] __attribute__((section(".ARM.__at_0xC0040000")));
+#endif
+
+/**
+  * @brief RGB565 colour each palette index is requested by, used to look indices up.
+  */
+static uint16_t paletteKey[L8_PALETTE_SIZE];
+
+/**
+  * @brief RGB565 colour each palette index is currently shown as.
+  */
+static uint16_t paletteShown[L8_PALETTE_SIZE];
+
+/**
+  * @brief Marks indices reserved for palette animation, which colour lookups never return.
+  */
+static bool paletteReserved[L8_PALETTE_SIZE];
+
+/**
+  * @brief Number of palette indices in use.
+  */
+static uint32_t paletteUsed = 0;
+
+/**
+  * @brief Current drawing colours as palette indices.
+  */
+static uint8_t foreground_index = 0;
+static uint8_t background_index = 0;
+
+/**
+  * @brief Font used by glcdL8DrawChar and glcdL8DrawString.
+  */
+static GLCD_FONT* active_font = NULL;
+
+/**
+  * @brief Writes one palette entry to the LTDC colour lookup table.
+  * @param index The palette index.
+  * @returns Void.
+  */
+static void loadPaletteEntry(uint8_t index){
+#ifndef GLCD_SOFT
+	uint32_t color = paletteShown[index];
+	uint32_t r = (color >> 11) & 0x1F;
+	uint32_t g = (color >> 5) & 0x3F;
+	uint32_t b = color & 0x1F;
+	LTDC_Layer1->CLUTWR = ((uint32_t)index << 24) | (((r << 3) | (r >> 2)) << 16)
+			| (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+#endif
+}
+
+/**
+  * @brief Adds a colour to the palette.
+  * @param color RGB565 colour of the new entry.
+  * @param reserved true to keep the entry out of colour lookups.
+  * @returns The new palette index, 0 if the palette is full.
+  */
+static uint8_t addPaletteEntry(uint32_t color, bool reserved){
+	uint8_t index;
+	if(paletteUsed == L8_PALETTE_SIZE){
+		return 0;
+	}
+	index = (uint8_t)paletteUsed++;
+	paletteKey[index] = (uint16_t)color;
+	paletteShown[index] = (uint16_t)color;
+	paletteReserved[index] = reserved;
+	loadPaletteEntry(index);
+	return index;
+}
+
+/**
+  * @brief Returns the palette index of a colour, adding it to the palette on first use.
+  * @param color RGB565 colour.
+  * @returns The palette index.
+  */
+uint8_t glcdL8ColorIndex(uint32_t color){
+	static uint8_t last = 0;
+	uint32_t i;
+
+	// Screens switch between a handful of colours, so the last hit is usually right
+	if(last < paletteUsed && !paletteReserved[last] && paletteKey[last] == color){
+		return last;
+	}
+	for(i = 0; i < paletteUsed; i++){
+		if(!paletteReserved[i] && paletteKey[i] == color){
+			last = (uint8_t)i;
+			return last;
+		}
+	}
+	last = addPaletteEntry(color, false);
+	return last;
+}
+
+/**
+  * @brief Reserves a palette index of its own, e.g. for a flashing score.
+  *        Pixels drawn with it change colour through glcdL8SetPaletteEntry without being redrawn.
+  * @param color Initial RGB565 colour.
+  * @returns The reserved palette index, 0 if the palette is full.
+  */
+uint8_t glcdL8ReserveIndex(uint32_t color){
+	return addPaletteEntry(color, true);
+}
+
+/**
+  * @brief Draws with a palette index directly, e.g. one returned by glcdL8ReserveIndex.
+  * @param index The palette index.
+  * @returns Void.
+  */
+void glcdL8SetForegroundIndex(uint8_t index){
+	foreground_index = index;
+}
+
+/**
+  * @brief Changes the colour a palette index is shown as, without touching the frame buffer.
+  * @param index The palette index.
+  * @param color New RGB565 colour.
+  * @returns Void.
+  */
+void glcdL8SetPaletteEntry(uint8_t index, uint32_t color){
+	paletteShown[index] = (uint16_t)color;
+	loadPaletteEntry(index);
+}
+
+/**
+  * @brief Expands the indexed frame buffer to RGB565 through the palette.
+  * @param out GLCD_WIDTH * GLCD_HEIGHT pixels to fill, row by row.
+  * @returns Void.
+  */
+void glcdL8ToRGB565(uint16_t* out){
+	uint32_t i;
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		out[i] = paletteShown[l8_buf[i]];
+	}
+}
+
+/**
+  * @brief Initialises the display and switches layer 1 to the indexed frame buffer.
+  * @param None.
+  * @returns 0 on success, -1 if the display could not be initialised.
+  */
+int32_t glcdL8Initialize(void){
+	if(GLCD_Initialize() != 0){
+		return -1;
+	}
+	memset(l8_buf, 0, sizeof(l8_buf));
+	paletteUsed = 0;
+	foreground_index = glcdL8ColorIndex(GLCD_COLOR_BLACK);
+	background_index = glcdL8ColorIndex(GLCD_COLOR_WHITE);
+#ifndef GLCD_SOFT
+	LTDC_Layer1->PFCR = LTDC_PIXEL_FORMAT_L8;
+	LTDC_Layer1->CFBAR = (uint32_t)l8_buf;
+	// Pitch and line length in bytes, the line length register takes 3 more
+	LTDC_Layer1->CFBLR = ((uint32_t)GLCD_WIDTH << 16) | (GLCD_WIDTH + 3);
+	LTDC_Layer1->CFBLNR = GLCD_HEIGHT;
+	LTDC_Layer1->CR |= LTDC_LxCR_CLUTEN;
+	LTDC->SRCR = LTDC_SRCR_VBR;
+#endif
+	return 0;
+}
+
+/**
+  * @brief Sets the colour used by the drawing functions.
+  */
+int32_t glcdL8SetForegroundColor(uint32_t color){
+	foreground_index = glcdL8ColorIndex(color);
+	return 0;
+}
+
+/**
+  * @brief Sets the colour used for clearing and behind characters.
+  */
+int32_t glcdL8SetBackgroundColor(uint32_t color){
+	background_index = glcdL8ColorIndex(color);
+	return 0;
+}
+
+/**
+  * @brief Fills the frame buffer with the background colour.
+  */
+int32_t glcdL8ClearScreen(void){
+	memset(l8_buf, background_index, sizeof(l8_buf));
+	return 0;
+}
+
+/**
+  * @brief Sets the font used for characters and strings.
+  */
+int32_t glcdL8SetFont(GLCD_FONT* font){
+	active_font = font;
+	return 0;
+}
+
+/**
+  * @brief Draws one pixel in the foreground colour.
+  */
+int32_t glcdL8DrawPixel(uint32_t x, uint32_t y){
+	if(x >= GLCD_WIDTH || y >= GLCD_HEIGHT){
+		return -1;
+	}
+	l8_buf[y * GLCD_WIDTH + x] = foreground_index;
+	return 0;
+}
+
+/**
+  * @brief Draws a horizontal line in the foreground colour.
+  */
+int32_t glcdL8DrawHLine(uint32_t x, uint32_t y, uint32_t length){
+	if(x >= GLCD_WIDTH || y >= GLCD_HEIGHT){
+		return -1;
+	}
+	if(x + length > GLCD_WIDTH){
+		length = GLCD_WIDTH - x;
+	}
+	memset(&l8_buf[y * GLCD_WIDTH + x], foreground_index, length);
+	return 0;
+}
+
+/**
+  * @brief Draws a vertical line in the foreground colour.
+  */
+int32_t glcdL8DrawVLine(uint32_t x, uint32_t y, uint32_t length){
+	uint8_t* pixel;
+	if(x >= GLCD_WIDTH || y >= GLCD_HEIGHT){
+		return -1;
+	}
+	if(y + length > GLCD_HEIGHT){
+		length = GLCD_HEIGHT - y;
+	}
+	for(pixel = &l8_buf[y * GLCD_WIDTH + x]; length > 0; length--, pixel += GLCD_WIDTH){
+		*pixel = foreground_index;
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a rectangle outline in the foreground colour.
+  */
+int32_t glcdL8DrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height){
+	glcdL8DrawHLine(x, y, width);
+	glcdL8DrawHLine(x, y + height - 1, width);
+	glcdL8DrawVLine(x, y, height);
+	glcdL8DrawVLine(x + width - 1, y, height);
+	return 0;
+}
+
+/**
+  * @brief Draws a character, least significant bit of each font byte is the leftmost pixel.
+  */
+int32_t glcdL8DrawChar(uint32_t x, uint32_t y, int32_t ch){
+	uint32_t i, j;
+	uint32_t wb;
+	const uint8_t* ptr_ch_bmp;
+	uint8_t* pixel;
+
+	if(active_font == NULL || ch < active_font->offset || ch >= active_font->offset + active_font->count
+			|| x + active_font->width > GLCD_WIDTH || y + active_font->height > GLCD_HEIGHT){
+		return -1;
+	}
+	wb = (active_font->width + 7) / 8;
+	ptr_ch_bmp = active_font->bitmap + (uint32_t)(ch - active_font->offset) * wb * active_font->height;
+	for(i = 0; i < active_font->height; i++){
+		pixel = &l8_buf[(y + i) * GLCD_WIDTH + x];
+		for(j = 0; j < active_font->width; j++){
+			pixel[j] = ((ptr_ch_bmp[j >> 3] >> (j & 7)) & 1) ? foreground_index : background_index;
+		}
+		ptr_ch_bmp += wb;
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a string character by character.
+  */
+int32_t glcdL8DrawString(uint32_t x, uint32_t y, const char* str){
+	if(active_font == NULL){
+		return -1;
+	}
+	while(*str != '\0'){
+		glcdL8DrawChar(x, y, *str++);
+		x += active_font->width;
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a bargraph filled val percent with the foreground colour.
+  */
+int32_t glcdL8DrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val){
+	uint8_t* row;
+	if(x + width > GLCD_WIDTH || y + height > GLCD_HEIGHT){
+		return -1;
+	}
+	val = (val * width) / 100;
+	for(row = &l8_buf[y * GLCD_WIDTH + x]; height > 0; height--, row += GLCD_WIDTH){
+		memset(row, foreground_index, val);
+		memset(row + val, background_index, width - val);
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws an RGB565 bitmap stored row by row, mapping every pixel to a palette index.
+  */
+int32_t glcdL8DrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap){
+	const uint16_t* ptr_bmp = (const uint16_t*)bitmap;
+	uint32_t i, j;
+	if(x + width > GLCD_WIDTH || y + height > GLCD_HEIGHT){
+		return -1;
+	}
+	for(i = 0; i < height; i++){
+		for(j = 0; j < width; j++){
+			l8_buf[(y + i) * GLCD_WIDTH + x + j] = glcdL8ColorIndex(*ptr_bmp++);
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief Scrolls the frame buffer up by dy lines, filling with the background colour.
+  */
+int32_t glcdL8VScroll(uint32_t dy){
+	if(dy > GLCD_HEIGHT){
+		dy = GLCD_HEIGHT;
+	}
+	memmove(l8_buf, &l8_buf[dy * GLCD_WIDTH], (GLCD_HEIGHT - dy) * GLCD_WIDTH);
+	memset(&l8_buf[(GLCD_HEIGHT - dy) * GLCD_WIDTH], background_index, dy * GLCD_WIDTH);
+	return 0;
+}
+
+/**
+  * @brief Returns the address of the indexed frame buffer, one byte per pixel.
+  *        Only the board fits it in 32 bits, the host build reads the buffer through glcdL8FrameBuffer.
+  */
+uint32_t glcdL8FrameBufferAddress(void){
+	return (uint32_t)(uintptr_t)l8_buf;
+}
+
+/**
+  * @brief Returns the indexed frame buffer, one byte per pixel.
+  * @param None.
+  * @returns Pointer to GLCD_WIDTH * GLCD_HEIGHT palette indices.
+  */
+uint8_t* glcdL8FrameBuffer(void){
+	return l8_buf;
+}
+
+#endif
+
+/**
+  * @brief Returns the frame buffer every GLCD call draws to: one palette index a pixel with GLCD_L8, RGB565
+  *        pixels otherwise. GLCD_FrameBufferAddress keeps the board driver's 32-bit type, which cannot hold a
+  *        host pointer, so the host build takes the pointer from the buffer itself.
+  * @param None.
+  * @returns Pointer to the first of GLCD_WIDTH * GLCD_HEIGHT pixels.
+  */
+void* glcdFrameBuffer(void){
+#if defined(GLCD_L8)
+	return glcdL8FrameBuffer();
+#elif defined(GLCD_SOFT)
+	return glcdSoftFrameBuffer();
+#else
+	return (void*)GLCD_FrameBufferAddress();
+#endif
+}
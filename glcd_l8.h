@@ -0,0 +1,74 @@
+/**
+  * @file glcd_l8.h
+  * @brief Header file of the glcd_l8.c source file.
+  *        Included from main.h; with GLCD_L8 defined every GLCD call in the project draws palette indices.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef GLCD_L8_H
+#define GLCD_L8_H
+
+#include <stdint.h>
+#include "Board_GLCD.h"
+
+/**
+  * @brief Render into an 8-bit palette-indexed frame buffer shown through the LTDC colour lookup table.
+  *        Uncomment to halve the frame buffer traffic of every draw.
+  */
+//#define GLCD_L8
+
+/**
+  * @brief Number of entries in the LTDC colour lookup table.
+  */
+#define L8_PALETTE_SIZE 256
+
+void* glcdFrameBuffer(void);
+
+#ifdef GLCD_L8
+
+int32_t glcdL8Initialize(void);
+int32_t glcdL8SetForegroundColor(uint32_t color);
+int32_t glcdL8SetBackgroundColor(uint32_t color);
+int32_t glcdL8ClearScreen(void);
+int32_t glcdL8SetFont(GLCD_FONT* font);
+int32_t glcdL8DrawPixel(uint32_t x, uint32_t y);
+int32_t glcdL8DrawHLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t glcdL8DrawVLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t glcdL8DrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+int32_t glcdL8DrawChar(uint32_t x, uint32_t y, int32_t ch);
+int32_t glcdL8DrawString(uint32_t x, uint32_t y, const char* str);
+int32_t glcdL8DrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val);
+int32_t glcdL8DrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap);
+int32_t glcdL8VScroll(uint32_t dy);
+uint32_t glcdL8FrameBufferAddress(void);
+uint8_t* glcdL8FrameBuffer(void);
+
+uint8_t glcdL8ColorIndex(uint32_t color);
+uint8_t glcdL8ReserveIndex(uint32_t color);
+void glcdL8SetForegroundIndex(uint8_t index);
+void glcdL8SetPaletteEntry(uint8_t index, uint32_t color);
+void glcdL8ToRGB565(uint16_t* out);
+
+#ifndef GLCD_L8_NO_REDIRECT
+#define GLCD_Initialize()                         glcdL8Initialize()
+#define GLCD_SetForegroundColor(color)            glcdL8SetForegroundColor(color)
+#define GLCD_SetBackgroundColor(color)            glcdL8SetBackgroundColor(color)
+#define GLCD_ClearScreen()                        glcdL8ClearScreen()
+#define GLCD_SetFont(font)                        glcdL8SetFont(font)
+#define GLCD_DrawPixel(x, y)                      glcdL8DrawPixel(x, y)
+#define GLCD_DrawHLine(x, y, length)              glcdL8DrawHLine(x, y, length)
+#define GLCD_DrawVLine(x, y, length)              glcdL8DrawVLine(x, y, length)
+#define GLCD_DrawRectangle(x, y, width, height)   glcdL8DrawRectangle(x, y, width, height)
+#define GLCD_DrawChar(x, y, ch)                   glcdL8DrawChar(x, y, ch)
+#define GLCD_DrawString(x, y, str)                glcdL8DrawString(x, y, str)
+#define GLCD_DrawBargraph(x, y, width, height, val) glcdL8DrawBargraph(x, y, width, height, val)
+#define GLCD_DrawBitmap(x, y, width, height, bitmap) glcdL8DrawBitmap(x, y, width, height, bitmap)
+#define GLCD_VScroll(dy)                          glcdL8VScroll(dy)
+#define GLCD_FrameBufferAddress()                 glcdL8FrameBufferAddress()
+#endif
+
+#endif
+
+#endif
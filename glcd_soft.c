@@ -0,0 +1,306 @@
+/**
+  * @file glcd_soft.c
+  * @brief Software implementation of the Board_GLCD.h API rendering into an in-memory RGB565 frame buffer.
+  *        Links in place of glcd_746g_discovery.c so the screens can be drawn without the board,
+  *        e.g. on a Linux host. GLCD_FrameBufferAddress keeps the board driver's 32-bit return type, which
+  *        cannot hold a 64-bit host pointer, so host code reaches the pixels through glcdSoftFrameBuffer instead.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include "GLCD_Config.h"
+#include "glcd_soft.h"
+
+/**
+  * @brief The frame buffer, same geometry and pixel format as the LTDC layer on the board.
+  */
+static uint16_t frame_buf[GLCD_WIDTH * GLCD_HEIGHT];
+
+/**
+  * @brief Current drawing colours in RGB565.
+  */
+static uint16_t foreground_color = GLCD_COLOR_BLACK;
+static uint16_t background_color = GLCD_COLOR_WHITE;
+
+/**
+  * @brief Font used by GLCD_DrawChar and GLCD_DrawString.
+  */
+static GLCD_FONT* active_font = NULL;
+
+/**
+  * @brief Writes one pixel, ignoring pixels outside the screen.
+  * @param x,y The co-ordinates of the pixel.
+  * @param color The RGB565 colour.
+  * @returns Void.
+  */
+static void putPixel(uint32_t x, uint32_t y, uint16_t color){
+	if(x < GLCD_WIDTH && y < GLCD_HEIGHT){
+		frame_buf[y * GLCD_WIDTH + x] = color;
+	}
+}
+
+/**
+  * @brief Clears the frame buffer.
+  */
+int32_t GLCD_Initialize(void){
+	memset(frame_buf, 0, sizeof(frame_buf));
+	return 0;
+}
+
+/**
+  * @brief Nothing to release for the software display.
+  */
+int32_t GLCD_Uninitialize(void){
+	return 0;
+}
+
+/**
+  * @brief Sets the colour used by the drawing functions.
+  */
+int32_t GLCD_SetForegroundColor(uint32_t color){
+	foreground_color = (uint16_t)color;
+	return 0;
+}
+
+/**
+  * @brief Sets the colour used for clearing and behind characters.
+  */
+int32_t GLCD_SetBackgroundColor(uint32_t color){
+	background_color = (uint16_t)color;
+	return 0;
+}
+
+/**
+  * @brief Fills the frame buffer with the background colour.
+  */
+int32_t GLCD_ClearScreen(void){
+	uint32_t i;
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		frame_buf[i] = background_color;
+	}
+	return 0;
+}
+
+/**
+  * @brief Sets the font used for characters and strings.
+  */
+int32_t GLCD_SetFont(GLCD_FONT* font){
+	active_font = font;
+	return 0;
+}
+
+/**
+  * @brief Draws one pixel in the foreground colour.
+  */
+int32_t GLCD_DrawPixel(uint32_t x, uint32_t y){
+	putPixel(x, y, foreground_color);
+	return 0;
+}
+
+/**
+  * @brief Draws a horizontal line in the foreground colour.
+  */
+int32_t GLCD_DrawHLine(uint32_t x, uint32_t y, uint32_t length){
+	while(length--){
+		putPixel(x++, y, foreground_color);
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a vertical line in the foreground colour.
+  */
+int32_t GLCD_DrawVLine(uint32_t x, uint32_t y, uint32_t length){
+	while(length--){
+		putPixel(x, y++, foreground_color);
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a rectangle outline in the foreground colour.
+  */
+int32_t GLCD_DrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height){
+	GLCD_DrawHLine(x, y, width);
+	GLCD_DrawHLine(x, y + height - 1, width);
+	GLCD_DrawVLine(x, y, height);
+	GLCD_DrawVLine(x + width - 1, y, height);
+	return 0;
+}
+
+/**
+  * @brief Draws a character, bit order as in the board driver: least significant bit is the leftmost pixel.
+  */
+int32_t GLCD_DrawChar(uint32_t x, uint32_t y, int32_t ch){
+	uint32_t i, j;
+	uint32_t wb;
+	const uint8_t* ptr_ch_bmp;
+
+	if(active_font == NULL || ch < active_font->offset || ch >= active_font->offset + active_font->count){
+		return -1;
+	}
+	wb = (active_font->width + 7) / 8;
+	ptr_ch_bmp = active_font->bitmap + (uint32_t)(ch - active_font->offset) * wb * active_font->height;
+	for(i = 0; i < active_font->height; i++){
+		for(j = 0; j < active_font->width; j++){
+			putPixel(x + j, y + i, ((ptr_ch_bmp[j >> 3] >> (j & 7)) & 1) ? foreground_color : background_color);
+		}
+		ptr_ch_bmp += wb;
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a string character by character.
+  */
+int32_t GLCD_DrawString(uint32_t x, uint32_t y, const char* str){
+	if(active_font == NULL){
+		return -1;
+	}
+	while(*str != '\0'){
+		GLCD_DrawChar(x, y, *str++);
+		x += active_font->width;
+	}
+	return 0;
+}
+
+/**
+  * @brief Draws a bargraph filled val percent with the foreground colour.
+  */
+int32_t GLCD_DrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val){
+	uint32_t i, j;
+	val = (val * width) / 100;
+	for(i = 0; i < height; i++){
+		for(j = 0; j < width; j++){
+			putPixel(x + j, y + i, (j >= val) ? background_color : foreground_color);
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief Copies an RGB565 bitmap stored row by row.
+  */
+int32_t GLCD_DrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap){
+	const uint16_t* ptr_bmp = (const uint16_t*)bitmap;
+	uint32_t i, j;
+	for(i = 0; i < height; i++){
+		for(j = 0; j < width; j++){
+			putPixel(x + j, y + i, *ptr_bmp++);
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief Scrolls the frame buffer up by dy lines, filling with the background colour.
+  */
+int32_t GLCD_VScroll(uint32_t dy){
+	uint32_t i;
+	if(dy > GLCD_HEIGHT){
+		dy = GLCD_HEIGHT;
+	}
+	dy *= GLCD_WIDTH;
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT - dy; i++){
+		frame_buf[i] = frame_buf[i + dy];
+	}
+	for(; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		frame_buf[i] = background_color;
+	}
+	return 0;
+}
+
+/**
+  * @brief The software frame buffer is always accessible.
+  */
+int32_t GLCD_FrameBufferAccess(bool enable){
+	return 0;
+}
+
+/**
+  * @brief Returns the address of the frame buffer, truncated on a 64-bit host. Use glcdSoftFrameBuffer there.
+  */
+uint32_t GLCD_FrameBufferAddress(void){
+	return (uint32_t)(uintptr_t)frame_buf;
+}
+
+/**
+  * @brief Gives direct access to the software frame buffer.
+  * @param None.
+  * @returns Pointer to GLCD_WIDTH * GLCD_HEIGHT RGB565 pixels, row by row.
+  */
+uint16_t* glcdSoftFrameBuffer(void){
+	return frame_buf;
+}
+
+/**
+  * @brief Expands an RGB565 pixel to 8-bit red, green and blue.
+  * @param pixel The RGB565 pixel.
+  * @param rgb Filled with the three colour bytes.
+  * @returns Void.
+  */
+static void toRGB888(uint16_t pixel, uint8_t* rgb){
+	rgb[0] = (uint8_t)(((pixel >> 11) & 0x1F) * 255 / 31);
+	rgb[1] = (uint8_t)(((pixel >> 5) & 0x3F) * 255 / 63);
+	rgb[2] = (uint8_t)((pixel & 0x1F) * 255 / 31);
+}
+
+/**
+  * @brief Writes the frame buffer as a binary PPM (P6) image.
+  * @param path File to write.
+  * @returns 0 on success, -1 if the file could not be written.
+  */
+int glcdSoftWritePPM(const char* path){
+	FILE* out = fopen(path, "wb");
+	uint8_t rgb[3];
+	uint32_t i;
+
+	if(out == NULL){
+		return -1;
+	}
+	fprintf(out, "P6\n%d %d\n255\n", GLCD_WIDTH, GLCD_HEIGHT);
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		toRGB888(frame_buf[i], rgb);
+		fwrite(rgb, 1, 3, out);
+	}
+	return fclose(out) == 0 ? 0 : -1;
+}
+
+/**
+  * @brief Compares the frame buffer against a golden PPM image written by glcdSoftWritePPM.
+  * @param path Golden image to compare with.
+  * @returns Number of differing pixels, or -1 if the image is missing or has another size.
+  */
+long glcdSoftCompare(const char* path){
+	FILE* in = fopen(path, "rb");
+	uint8_t expected[3];
+	uint8_t actual[3];
+	int width, height, maxValue;
+	long differences = 0;
+	uint32_t i;
+
+	if(in == NULL){
+		return -1;
+	}
+	if(fscanf(in, "P6 %d %d %d", &width, &height, &maxValue) != 3
+			|| width != GLCD_WIDTH || height != GLCD_HEIGHT || maxValue != 255){
+		fclose(in);
+		return -1;
+	}
+	fgetc(in);
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		if(fread(expected, 1, 3, in) != 3){
+			differences += GLCD_WIDTH * GLCD_HEIGHT - i;
+			break;
+		}
+		toRGB888(frame_buf[i], actual);
+		if(memcmp(expected, actual, 3) != 0){
+			differences++;
+		}
+	}
+	fclose(in);
+	return differences;
+}
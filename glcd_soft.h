@@ -0,0 +1,19 @@
+/**
+  * @file glcd_soft.h
+  * @brief Header file of the glcd_soft.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef GLCD_SOFT_H
+#define GLCD_SOFT_H
+
+#include <stdint.h>
+#include "Board_GLCD.h"
+
+uint16_t* glcdSoftFrameBuffer(void);
+int glcdSoftWritePPM(const char* path);
+long glcdSoftCompare(const char* path);
+
+#endif
@@ -0,0 +1,162 @@
+/**
+  * @file glyph_atlas.c
+  * @brief Define functions that keep pre-rasterised RGB565 glyphs for fast text drawing.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <string.h>
+#include "main.h"
+#include "glyph_atlas.h"
+#include "dma2d.h"
+
+/**
+  * @brief Pixels of every glyph in the atlas, stored one glyph after another.
+  */
+static atlasPixel atlasPixels[ATLAS_MAX_GLYPHS * ATLAS_MAX_GLYPH_PIXELS];
+
+/**
+  * @brief Atlas slot of each ASCII character, or -1 if the character is not in the atlas.
+  */
+static signed char atlasIndex[128];
+
+/**
+  * @brief Font the atlas was built from, used for glyph size and as fallback.
+  */
+static GLCD_FONT* atlasFont = NULL;
+
+/**
+  * @brief Frame buffer pixels of the set and cleared font pixels, used for the fallback path.
+  */
+static atlasPixel atlasSet;
+static atlasPixel atlasClear;
+
+/**
+  * @brief Rasterises the given characters of a 1-bpp font into frame buffer pixels,
+  *        replacing any previous atlas contents.
+  * @param font The font to take the glyph bitmaps from.
+  * @param characters Null-terminated list of characters to put in the atlas.
+  * @param foreground Colour of the set font pixels.
+  * @param background Colour of the cleared font pixels.
+  * @returns 0 on success, -1 if the font or character list does not fit in the atlas.
+  */
+int atlasBuild(GLCD_FONT* font, const char* characters, uint16_t foreground, uint16_t background){
+	unsigned int slot = 0;
+	unsigned int row;
+	unsigned int col;
+	unsigned int bytesPerRow;
+	const uint8_t* bitmap;
+	atlasPixel* pixel;
+	int ch;
+
+	if(font->width * font->height > ATLAS_MAX_GLYPH_PIXELS){
+		return -1;
+	}
+	memset(atlasIndex, -1, sizeof(atlasIndex));
+	atlasFont = font;
+	bytesPerRow = (font->width + 7) / 8;
+#ifdef GLCD_L8
+	atlasSet = glcdL8ColorIndex(foreground);
+	atlasClear = glcdL8ColorIndex(background);
+#else
+	atlasSet = foreground;
+	atlasClear = background;
+#endif
+
+	for(; *characters != '\0'; characters++){
+		ch = (unsigned char)*characters;
+		if(ch >= 128 || ch < font->offset || ch >= font->offset + font->count){
+			continue;
+		}
+		if(slot == ATLAS_MAX_GLYPHS){
+			return -1;
+		}
+		// Same bit order as GLCD_DrawChar: least significant bit is the leftmost pixel
+		bitmap = font->bitmap + (ch - font->offset) * bytesPerRow * font->height;
+		pixel = &atlasPixels[slot * ATLAS_MAX_GLYPH_PIXELS];
+		for(row = 0; row < font->height; row++){
+			for(col = 0; col < font->width; col++){
+				*pixel++ = ((bitmap[col >> 3] >> (col & 7)) & 1) ? atlasSet : atlasClear;
+			}
+			bitmap += bytesPerRow;
+		}
+		atlasIndex[ch] = slot;
+		slot++;
+	}
+	return 0;
+}
+
+/**
+  * @brief Rasterises a character missing from the atlas straight from the atlas font into the frame buffer,
+  *        in the atlas colours. Does not go through GLCD_DrawChar, so the font and colours the GLCD
+  *        driver was set to are left as they were. A character outside the font is drawn as background.
+  * @param frame The frame buffer.
+  * @param x,y Top left co-ordinates of the character.
+  * @param ch The character.
+  * @returns Void.
+  */
+static void atlasDrawMissing(atlasPixel* frame, unsigned int x, unsigned int y, int ch){
+	unsigned int row;
+	unsigned int col;
+	unsigned int bytesPerRow = (atlasFont->width + 7) / 8;
+	const uint8_t* bitmap = NULL;
+	atlasPixel* pixel;
+
+	if(ch >= atlasFont->offset && ch < atlasFont->offset + atlasFont->count){
+		bitmap = atlasFont->bitmap + (ch - atlasFont->offset) * bytesPerRow * atlasFont->height;
+	}
+	// Glyphs copied earlier in the string may still be in flight
+	dma2dWait();
+	for(row = 0; row < atlasFont->height; row++){
+		pixel = &frame[(y + row) * GLCD_WIDTH + x];
+		for(col = 0; col < atlasFont->width; col++){
+			*pixel++ = (bitmap != NULL && ((bitmap[col >> 3] >> (col & 7)) & 1)) ? atlasSet : atlasClear;
+		}
+		if(bitmap != NULL){
+			bitmap += bytesPerRow;
+		}
+	}
+}
+
+/**
+  * @brief Draws a string using the atlas glyphs.
+  *        Characters missing from the atlas are rasterised from the atlas font in the atlas colours.
+  * @param x,y Top left co-ordinates of the string.
+  * @param str Null-terminated string to draw.
+  * @returns 0 on success, -1 if the atlas is empty or the string runs off the screen.
+  */
+int atlasDrawString(unsigned int x, unsigned int y, const char* str){
+	atlasPixel* frame;
+	unsigned int left = x;
+	int ch;
+	int result = 0;
+	uint32_t pixels = 0;
+	uint32_t start = profBegin();
+
+	if(atlasFont == NULL || y + atlasFont->height > GLCD_HEIGHT){
+		profEnd(ProfString, start, 0);
+		return -1;
+	}
+	frame = glcdFrameBuffer();
+
+	for(; *str != '\0'; str++, x += atlasFont->width){
+		if(x + atlasFont->width > GLCD_WIDTH){
+			result = -1;
+			break;
+		}
+		ch = (unsigned char)*str;
+		if(ch < 128 && atlasIndex[ch] >= 0){
+			// The next glyph lookup overlaps with this transfer
+			dma2dCopy(&frame[y * GLCD_WIDTH + x], GLCD_WIDTH, &atlasPixels[atlasIndex[ch] * ATLAS_MAX_GLYPH_PIXELS],
+					atlasFont->width, atlasFont->width, atlasFont->height, sizeof(atlasPixel));
+		}else{
+			atlasDrawMissing(frame, x, y, ch);
+		}
+		pixels += atlasFont->width * atlasFont->height;
+	}
+	dma2dWait();
+	mirrorMarkDirty(left, y, x - left, atlasFont->height);
+	profEnd(ProfString, start, pixels);
+	return result;
+}
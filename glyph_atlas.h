@@ -0,0 +1,38 @@
+/**
+  * @file glyph_atlas.h
+  * @brief Header file of the glyph_atlas.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <stdint.h>
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+
+/**
+  * @brief Type of one frame buffer pixel: an RGB565 colour, or a palette index in GLCD_L8 mode.
+  */
+#ifdef GLCD_L8
+typedef uint8_t atlasPixel;
+#else
+typedef uint16_t atlasPixel;
+#endif
+
+/**
+  * @brief Maximum number of characters the atlas can hold.
+  */
+#define ATLAS_MAX_GLYPHS 16
+
+/**
+  * @brief Maximum pixel count of a single glyph, sized for GLCD_Font_16x24.
+  */
+#define ATLAS_MAX_GLYPH_PIXELS (16 * 24)
+
+int atlasBuild(GLCD_FONT* font, const char* characters, uint16_t foreground, uint16_t background);
+int atlasDrawString(unsigned int x, unsigned int y, const char* str);
+
+#endif
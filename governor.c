@@ -0,0 +1,251 @@
+/**
+  * @file governor.c
+  * @brief Define the governor that scales the clocks with the screen shown.
+  *        The home and error screens only wait for input and run in GOVERNOR_IDLE_PROFILE, the game runs in
+  *        GOVERNOR_ACTIVE_PROFILE. The clocks are raised before the game screen is entered, so its first frame
+  *        and the first flipper press are already at full speed, and lowered only once the transition away
+  *        from it has finished. A switch waits until both servo outputs are low and far from the end of the
+  *        PWM period, so no pulse is counted across two clocks. platformSetProfile then rescales the servo
+  *        timers, the ADC and the SDRAM refresh, and platformRetuneTick keeps the kernel tick on time.
+  *        Define GLCD_SOFT to build for the host, where governorSimulateServo stands in for the timers
+  *        and the switch itself only updates the profile.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "governor.h"
+#include "platform.h"
+#ifdef GLCD_SOFT
+#include <time.h>
+#else
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief The profile the clocks run in.
+  */
+static enum clockProfile profile = PLATFORM_DEFAULT_PROFILE;
+
+/**
+  * @brief Switches made and failed, switches over GOVERNOR_SWITCH_BUDGET_US, and their timings.
+  */
+static uint32_t switches = 0;
+static uint32_t failures = 0;
+static uint32_t overBudget = 0;
+static uint32_t lastSwitchMicros = 0;
+static uint32_t worstSwitchMicros = 0;
+static uint32_t worstWaitMicros = 0;
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Simulated servo timer count and pulse length, and whether governorSimulateServo set them.
+  */
+static uint32_t simulatedCount = 0;
+static uint32_t simulatedPulse = 0;
+static bool simulated = false;
+#endif
+
+/**
+  * @brief Returns the profile a screen runs in.
+  * @param s The screen.
+  * @returns The profile.
+  */
+enum clockProfile governorPolicy(enum screen s){
+	return (s == Game) ? GOVERNOR_ACTIVE_PROFILE : GOVERNOR_IDLE_PROFILE;
+}
+
+/**
+  * @brief Returns a timestamp for measuring switches: microseconds on the host, core cycles on the target.
+  * @param None.
+  * @returns The timestamp.
+  */
+static uint32_t governorClock(void){
+#ifdef GLCD_SOFT
+	return (uint32_t)((uint64_t)clock() * 1000000 / CLOCKS_PER_SEC);
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+/**
+  * @brief Returns the time since a timestamp of governorClock.
+  * @param start The timestamp.
+  * @param coreHz Core clock the cycles were counted at, ignored on the host.
+  * @returns Elapsed time in microseconds.
+  */
+static uint32_t elapsedMicros(uint32_t start, uint32_t coreHz){
+#ifdef GLCD_SOFT
+	(void)coreHz;
+	return governorClock() - start;
+#else
+	return (governorClock() - start) / (coreHz / 1000000);
+#endif
+}
+
+/**
+  * @brief Checks that a servo output is low and stays low for longer than a switch may take.
+  * @param count Timer count.
+  * @param pulse Pulse length in counts, the compare value.
+  * @returns true if the clocks may be switched.
+  */
+static bool servoQuiet(uint32_t count, uint32_t pulse){
+	uint32_t margin = (uint32_t)((uint64_t)GOVERNOR_SWITCH_BUDGET_US * CLOCK_SERVO_TICK_HZ / 1000000) + 1;
+	return count > pulse && count + margin < GOVERNOR_SERVO_PERIOD;
+}
+
+/**
+  * @brief Checks that both servo outputs are quiet.
+  * @param None.
+  * @returns true if the clocks may be switched.
+  */
+static bool servosQuiet(void){
+#ifdef GLCD_SOFT
+	// Without a simulated servo there is nothing to disturb
+	return !simulated || servoQuiet(simulatedCount, simulatedPulse);
+#else
+	return servoQuiet(TIM3->CNT, TIM3->CCR1) && servoQuiet(TIM12->CNT, TIM12->CCR1);
+#endif
+}
+
+/**
+  * @brief Switches the clocks to a profile. The wait for the servos is bounded by one PWM period,
+  *        after which the switch is made anyway. The switch is timed in core cycles and converted at the
+  *        HSE clock, the slowest the core runs at while switching, so the time reported is an upper bound.
+  *        The flipper threads may preempt a switch and their time is included.
+  * @param target The profile.
+  * @returns Void.
+  */
+static void switchTo(enum clockProfile target){
+	uint32_t periodMicros = (uint32_t)((uint64_t)GOVERNOR_SERVO_PERIOD * 1000000 / CLOCK_SERVO_TICK_HZ);
+	uint32_t coreHz = clockSysclk(clockProfileTree(profile));
+	uint32_t start;
+	uint32_t micros;
+
+#ifdef GLCD_SOFT
+	// The simulated servo does not move while waiting, so a busy one costs the whole bound without spinning
+	(void)coreHz;
+	micros = servosQuiet() ? 0 : periodMicros;
+#else
+	start = governorClock();
+	while(!servosQuiet() && elapsedMicros(start, coreHz) < periodMicros){
+	}
+	micros = elapsedMicros(start, coreHz);
+#endif
+	if(micros > worstWaitMicros){
+		worstWaitMicros = micros;
+	}
+
+	start = governorClock();
+	if(platformSetProfile(target) != 0){
+		failures++;
+		profile = platformProfile();
+		return;
+	}
+	micros = elapsedMicros(start, CLOCK_HSE_HZ);
+	profile = target;
+	switches++;
+	lastSwitchMicros = micros;
+	if(micros > worstSwitchMicros){
+		worstSwitchMicros = micros;
+	}
+	if(micros > GOVERNOR_SWITCH_BUDGET_US){
+		overBudget++;
+	}
+}
+
+/**
+  * @brief Takes over the profile SystemClock_Config started in and clears the statistics.
+  * @param None.
+  * @returns Void.
+  */
+void governorInitialize(void){
+	profile = platformProfile();
+	switches = 0;
+	failures = 0;
+	overBudget = 0;
+	lastSwitchMicros = 0;
+	worstSwitchMicros = 0;
+	worstWaitMicros = 0;
+}
+
+/**
+  * @brief Raises the clocks if the next screen needs more than the current profile. Call before entering it.
+  * @param next The screen about to be entered.
+  * @returns Void.
+  */
+void governorBeforeScreen(enum screen next){
+#ifdef GOVERNOR_ENABLED
+	enum clockProfile target = governorPolicy(next);
+	if(clockSysclk(clockProfileTree(target)) > clockSysclk(clockProfileTree(profile))){
+		switchTo(target);
+	}
+#endif
+}
+
+/**
+  * @brief Lowers the clocks if the screen needs less than the current profile. Call once it is shown.
+  * @param current The screen shown.
+  * @returns Void.
+  */
+void governorAfterScreen(enum screen current){
+#ifdef GOVERNOR_ENABLED
+	enum clockProfile target = governorPolicy(current);
+	if(clockSysclk(clockProfileTree(target)) < clockSysclk(clockProfileTree(profile))){
+		switchTo(target);
+	}
+#endif
+}
+
+/**
+  * @brief Scales a number of busy-loop samples to the core clock, so a loop takes as long in every profile
+  *        as it did in GOVERNOR_ACTIVE_PROFILE.
+  * @param samples Samples in GOVERNOR_ACTIVE_PROFILE.
+  * @returns Samples in the current profile, at least 1.
+  */
+int governorSamples(int samples){
+	int64_t scaled = (int64_t)samples * clockSysclk(clockProfileTree(profile)) / clockSysclk(clockProfileTree(GOVERNOR_ACTIVE_PROFILE));
+	return (scaled > 0) ? (int)scaled : 1;
+}
+
+/**
+  * @brief Copies the statistics since governorInitialize and the peripheral rates of the current profile.
+  *        The rates come from the same arithmetic as the prescalers platformSetProfile writes.
+  * @param stats Filled in.
+  * @returns Void.
+  */
+void governorGetStats(governorStats* stats){
+	const clockTree* tree = clockProfileTree(profile);
+	uint32_t timerClock = clockApb1TimerClock(tree);
+	uint32_t hclk = clockHclk(tree);
+	uint32_t pclk2 = clockPclk2(tree);
+	uint32_t adcDivider = clockAdcDivider(pclk2);
+
+	stats->profile = profile;
+	stats->switches = switches;
+	stats->failures = failures;
+	stats->overBudget = overBudget;
+	stats->lastSwitchMicros = lastSwitchMicros;
+	stats->worstSwitchMicros = worstSwitchMicros;
+	stats->worstWaitMicros = worstWaitMicros;
+	stats->sysclk = clockSysclk(tree);
+	stats->servoTickHz = timerClock / (clockTimerPrescaler(timerClock, CLOCK_SERVO_TICK_HZ) + 1);
+	stats->kernelTickHz = hclk / (clockSysTickReload(hclk, CLOCK_TICK_HZ) + 1);
+	stats->adcHz = (adcDivider != 0) ? pclk2 / adcDivider : 0;
+}
+
+#ifdef GLCD_SOFT
+
+/**
+  * @brief Sets the simulated servo timer the host build checks. Until it is set the servos count as quiet.
+  * @param count Timer count, 0 to GOVERNOR_SERVO_PERIOD - 1.
+  * @param pulse Pulse length in counts.
+  * @returns Void.
+  */
+void governorSimulateServo(uint32_t count, uint32_t pulse){
+	simulatedCount = count;
+	simulatedPulse = pulse;
+	simulated = true;
+}
+
+#endif
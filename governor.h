@@ -0,0 +1,66 @@
+/**
+  * @file governor.h
+  * @brief Header file of the governor.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "clock_tree.h"
+#include "screens.h"
+
+/**
+  * @brief Scale the clocks with the screen shown. Comment out to stay in PLATFORM_DEFAULT_PROFILE.
+  */
+#define GOVERNOR_ENABLED
+
+/**
+  * @brief Profile of the screens that only wait for input, and of the game.
+  */
+#define GOVERNOR_IDLE_PROFILE ClockLowPower
+#define GOVERNOR_ACTIVE_PROFILE ClockMaxPerformance
+
+/**
+  * @brief Longest a switch may take in microseconds, half a kernel tick.
+  *        Together with platformRetuneTick it keeps every tick within one tick of where it should be.
+  */
+#define GOVERNOR_SWITCH_BUDGET_US 500
+
+/**
+  * @brief Servo PWM period in timer counts, the auto-reload of TIM3 and TIM12 plus one.
+  */
+#define GOVERNOR_SERVO_PERIOD 581
+
+/**
+  * @brief A struct containing the switch statistics and the rates the peripherals run at in the current profile.
+  */
+typedef struct{
+	enum clockProfile profile;
+	uint32_t switches;
+	uint32_t failures;
+	uint32_t overBudget;
+	uint32_t lastSwitchMicros;
+	uint32_t worstSwitchMicros;
+	uint32_t worstWaitMicros;
+	uint32_t sysclk;
+	uint32_t servoTickHz;
+	uint32_t kernelTickHz;
+	uint32_t adcHz;
+	}governorStats;
+
+enum clockProfile governorPolicy(enum screen s);
+void governorInitialize(void);
+void governorBeforeScreen(enum screen next);
+void governorAfterScreen(enum screen current);
+int governorSamples(int samples);
+void governorGetStats(governorStats* stats);
+#ifdef GLCD_SOFT
+void governorSimulateServo(uint32_t count, uint32_t pulse);
+#endif
+
+#endif
@@ -0,0 +1,132 @@
+/**
+  * @file atlas_bench.c
+  * @brief Times score text drawn four ways, in glyphs per second of real time: GLCD_DrawString,
+  *        atlasDrawString with every digit in the atlas, atlasDrawString with none of them, which takes
+  *        the fallback, and the large anti-aliased digits of scoreFontDrawString. The first draw of those is
+  *        printed on its own, as it decodes the glyphs into their cache. Runs as the script thread of the
+  *        firmware, which does not yield while it is timing.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cmsis_os_soft.h"
+#include "Board_GLCD.h"
+#include "GLCD_Config.h"
+#include "glyph_atlas.h"
+#include "score_font.h"
+
+/**
+  * @brief Least time each way is run for, in milliseconds.
+  */
+#define ATLAS_BENCH_MS 200
+
+/**
+  * @brief The text drawn, ten glyphs.
+  */
+#define ATLAS_BENCH_TEXT "0123456789"
+
+/**
+  * @brief The font the screens build the atlas from.
+  */
+extern GLCD_FONT GLCD_Font_16x24;
+
+/**
+  * @brief Draws the text once.
+  */
+typedef void (*textCall)(void);
+
+/**
+  * @brief Draws the text with the GLCD driver.
+  * @param None.
+  * @returns Void.
+  */
+static void drawGlcd(void){
+	GLCD_DrawString(0, 0, ATLAS_BENCH_TEXT);
+}
+
+/**
+  * @brief Draws the text from the atlas.
+  * @param None.
+  * @returns Void.
+  */
+static void drawAtlas(void){
+	atlasDrawString(0, 0, ATLAS_BENCH_TEXT);
+}
+
+/**
+  * @brief Draws the text in the score font, which is as wide as the screen.
+  * @param None.
+  * @returns Void.
+  */
+static void drawScore(void){
+	scoreFontDrawString(0, 0, ATLAS_BENCH_TEXT, GLCD_COLOR_WHITE, GLCD_COLOR_BLACK);
+}
+
+/**
+  * @brief Reads the monotonic clock.
+  * @param None.
+  * @returns Nanoseconds.
+  */
+static uint64_t nanos(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief Draws the text for at least ATLAS_BENCH_MS and prints the rate.
+  * @param name Name of the way it is drawn.
+  * @param call Draws the text once.
+  * @returns Void.
+  */
+static void timeText(const char* name, textCall call){
+	uint64_t start = nanos();
+	uint64_t elapsed;
+	uint32_t calls = 0;
+
+	do{
+		call();
+		calls++;
+		elapsed = nanos() - start;
+	}while(elapsed < (uint64_t)ATLAS_BENCH_MS * 1000000);
+	printf("%-16s %12.0f glyphs/s\n", name, (double)calls * (sizeof(ATLAS_BENCH_TEXT) - 1) * 1e9 / (double)elapsed);
+}
+
+/**
+  * @brief Thread function running the benchmark.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	GLCD_SetFont(&GLCD_Font_16x24);
+	GLCD_SetForegroundColor(GLCD_COLOR_WHITE);
+	GLCD_SetBackgroundColor(GLCD_COLOR_BLACK);
+	timeText("GLCD_DrawString", drawGlcd);
+	atlasBuild(&GLCD_Font_16x24, ATLAS_BENCH_TEXT, GLCD_COLOR_WHITE, GLCD_COLOR_BLACK);
+	timeText("atlas", drawAtlas);
+	atlasBuild(&GLCD_Font_16x24, "", GLCD_COLOR_WHITE, GLCD_COLOR_BLACK);
+	timeText("atlas fallback", drawAtlas);
+	drawScore();
+	printf("%-16s %12u us, decoding the glyphs\n", "score font first", (unsigned int)scoreFontLastMicros());
+	timeText("score font", drawScore);
+	exit(0);
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the benchmark with the kernel.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osThreadCreate(osThread(scriptTask), NULL);
+}
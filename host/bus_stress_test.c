@@ -0,0 +1,264 @@
+/**
+  * @file bus_stress_test.c
+  * @brief Stresses bus.c with pthreads. First, on one thread, a subscriber that stops reading makes exactly the
+  *        reservations past the depth fail, and the dropped count must match them. Then every topic has its
+  *        publisher and BUS_SUBSCRIBERS subscribers running at once, one of them slow, so the rings fill and
+  *        the publishers are pushed back. Each message carries a sequence number and its complement in the slot
+  *        it was written to: every subscriber must read every published message once, in order and whole, and
+  *        the dropped count of each topic must be the reservations its publisher saw fail.
+  *        The bus allows one publishing thread per topic, so the publishers run on different topics.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+#include "bus.h"
+
+/**
+  * @brief Reservations each publisher makes.
+  */
+#define STRESS_MESSAGES 200000
+
+/**
+  * @brief The slow subscriber of each topic pauses after this many messages.
+  */
+#define SLOW_EVERY 64
+
+/**
+  * @brief Messages the single-thread check tries to publish past the depth.
+  */
+#define FORCED_DROPS 5
+
+/**
+  * @brief A struct containing what a publisher did.
+  */
+typedef struct{
+	enum busTopic topic;
+	uint32_t published;
+	uint32_t refused;
+	}publisher;
+
+/**
+  * @brief A struct containing what a subscriber read.
+  */
+typedef struct{
+	enum busTopic topic;
+	int number;
+	bool slow;
+	uint32_t received;
+	uint32_t outOfOrder;
+	uint32_t torn;
+	}subscriber;
+
+/**
+  * @brief Messages each topic ends with, set by its publisher once it is done, 0 until then.
+  */
+static volatile uint32_t finalCount[TopicCount];
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Writes a message. Every slot holds at least 8 bytes, the sequence number and its complement.
+  * @param slot The slot from busReserve.
+  * @param sequence Number of the message.
+  * @returns Void.
+  */
+static void writeMessage(void* slot, uint32_t sequence){
+	((uint32_t*)slot)[0] = sequence;
+	((uint32_t*)slot)[1] = ~sequence;
+}
+
+/**
+  * @brief Thread function of a publisher: reserves STRESS_MESSAGES times and publishes what it could place.
+  * @param argument The publisher.
+  * @returns NULL.
+  */
+static void* publisherTask(void* argument){
+	publisher* p = (publisher*)argument;
+	void* slot;
+	uint32_t i;
+
+	for(i = 0; i < STRESS_MESSAGES; i++){
+		slot = busReserve(p->topic);
+		if(slot == NULL){
+			p->refused++;
+			sched_yield();
+			continue;
+		}
+		writeMessage(slot, p->published);
+		busPublish(p->topic);
+		p->published++;
+	}
+	__sync_synchronize();
+	finalCount[p->topic] = p->published;
+	return NULL;
+}
+
+/**
+  * @brief Thread function of a subscriber: reads until it has every message its publisher placed.
+  * @param argument The subscriber.
+  * @returns NULL.
+  */
+static void* subscriberTask(void* argument){
+	subscriber* s = (subscriber*)argument;
+	struct timespec pause = {0, 20000};
+	const uint32_t* message;
+	uint32_t total;
+
+	for(;;){
+		message = (const uint32_t*)busPeek(s->topic, s->number);
+		if(message == NULL){
+			total = finalCount[s->topic];
+			if(total != 0 && s->received == total){
+				return NULL;
+			}
+			sched_yield();
+			continue;
+		}
+		s->outOfOrder += message[0] != s->received;
+		s->torn += message[1] != ~message[0];
+		busRelease(s->topic, s->number);
+		s->received++;
+		if(s->slow && s->received % SLOW_EVERY == 0){
+			nanosleep(&pause, NULL);
+		}
+	}
+}
+
+/**
+  * @brief Fills a topic whose subscriber stops reading and checks that the drops are the refused reservations.
+  * @param None.
+  * @returns Void.
+  */
+static void checkForcedDrops(void){
+	busStats stats;
+	int number;
+	int refused = 0;
+	uint32_t i;
+
+	busInitialize();
+	number = busSubscribe(TopicScore, NULL);
+	for(i = 0; i < BUS_SCORE_DEPTH + FORCED_DROPS; i++){
+		void* slot = busReserve(TopicScore);
+		if(slot == NULL){
+			refused++;
+			continue;
+		}
+		writeMessage(slot, i);
+		busPublish(TopicScore);
+	}
+	busGetStats(TopicScore, &stats);
+	check(refused == FORCED_DROPS, "a full ring refuses every reservation past its depth");
+	check(stats.dropped == FORCED_DROPS, "the dropped count is the refused reservations");
+	check(stats.published == BUS_SCORE_DEPTH, "the published count is the messages placed");
+	check(stats.waiting == BUS_SCORE_DEPTH && stats.highWater == BUS_SCORE_DEPTH, "the ring is full");
+	busRelease(TopicScore, number);
+	check(busReserve(TopicScore) != NULL, "a released slot can be reserved again");
+	busGetStats(TopicScore, &stats);
+	check(stats.dropped == FORCED_DROPS, "a reservation that succeeds is not counted as dropped");
+}
+
+/**
+  * @brief Runs every topic with its publisher and subscribers at once and checks what each one saw.
+  * @param None.
+  * @returns Void.
+  */
+static void checkStress(void){
+	publisher publishers[TopicCount];
+	subscriber subscribers[TopicCount][BUS_SUBSCRIBERS];
+	pthread_t threads[TopicCount * (BUS_SUBSCRIBERS + 1)];
+	int threadCount = 0;
+	busStats stats;
+	int topic;
+	int i;
+
+	busInitialize();
+	for(topic = 0; topic < TopicCount; topic++){
+		finalCount[topic] = 0;
+		publishers[topic].topic = (enum busTopic)topic;
+		publishers[topic].published = 0;
+		publishers[topic].refused = 0;
+		for(i = 0; i < BUS_SUBSCRIBERS; i++){
+			subscriber* s = &subscribers[topic][i];
+			s->topic = (enum busTopic)topic;
+			s->number = busSubscribe((enum busTopic)topic, NULL);
+			s->slow = (i == 0);
+			s->received = 0;
+			s->outOfOrder = 0;
+			s->torn = 0;
+		}
+	}
+	check(busSubscribe(TopicScore, NULL) == -1, "a topic takes BUS_SUBSCRIBERS subscribers");
+	for(topic = 0; topic < TopicCount; topic++){
+		for(i = 0; i < BUS_SUBSCRIBERS; i++){
+			pthread_create(&threads[threadCount++], NULL, subscriberTask, &subscribers[topic][i]);
+		}
+	}
+	for(topic = 0; topic < TopicCount; topic++){
+		pthread_create(&threads[threadCount++], NULL, publisherTask, &publishers[topic]);
+	}
+	for(i = 0; i < threadCount; i++){
+		pthread_join(threads[i], NULL);
+	}
+
+	for(topic = 0; topic < TopicCount; topic++){
+		uint32_t lost = 0;
+		uint32_t outOfOrder = 0;
+		uint32_t torn = 0;
+
+		busGetStats((enum busTopic)topic, &stats);
+		for(i = 0; i < BUS_SUBSCRIBERS; i++){
+			lost += publishers[topic].published - subscribers[topic][i].received;
+			outOfOrder += subscribers[topic][i].outOfOrder;
+			torn += subscribers[topic][i].torn;
+		}
+		printf("topic %d: %u published, %u dropped of %u, high water %u of %u\n", topic,
+				(unsigned int)stats.published, (unsigned int)stats.dropped, (unsigned int)STRESS_MESSAGES,
+				(unsigned int)stats.highWater, (unsigned int)stats.depth);
+		check(lost == 0, "every subscriber reads every published message");
+		check(outOfOrder == 0, "no message is read twice, skipped or out of order");
+		check(torn == 0, "every message is read whole");
+		check(stats.published == publishers[topic].published, "the published count is the messages placed");
+		check(stats.dropped == publishers[topic].refused, "the dropped count is the refused reservations");
+		check(stats.published + stats.dropped == STRESS_MESSAGES, "every reservation is placed or dropped");
+		check(stats.dropped > 0, "the slow subscriber pushes the publisher back");
+		check(stats.highWater <= stats.depth && stats.waiting == 0, "the ring stays within its depth and drains");
+	}
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	checkForcedDrops();
+	checkStress();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,203 @@
+/**
+  * @file clock_tree_test.c
+  * @brief Checks the profiles of clock_tree.c against values worked out by hand from the reference manual:
+  *        SYSCLK, HCLK, APB1, APB2, the APB1 timer clock, the USB clock, the flash wait states, the voltage
+  *        scale and over-drive of each profile, then the settings platformSetProfile recomputes from them:
+  *        the servo timer prescaler, the ADC clock divider, the SysTick reload and the SDRAM refresh count.
+  *        Also checks that clockValidate finds broken trees, and that OS_CLOCK in RTX_Conf_CM.c is the
+  *        core clock of PLATFORM_DEFAULT_PROFILE.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "clock_tree.h"
+#include "platform.h"
+
+/**
+  * @brief The kernel configuration, relative to host/, where make runs the test.
+  */
+#define RTX_CONF "../RTE/CMSIS/RTX_Conf_CM.c"
+
+/**
+  * @brief A struct containing the values a profile should give, worked out by hand.
+  */
+typedef struct{
+	enum clockProfile profile;
+	uint32_t sysclk;
+	uint32_t hclk;
+	uint32_t pclk1;
+	uint32_t pclk2;
+	uint32_t timerClock;
+	uint32_t usb;
+	uint32_t flashLatency;
+	uint8_t voltageScale;
+	bool overDrive;
+	uint32_t servoPrescaler;
+	uint32_t adcDivider;
+	uint32_t sysTickReload;
+	uint32_t sdramRefresh;
+	}expectedClocks;
+
+/**
+  * @brief The expected values of every profile.
+  *        max: 25 MHz / 25 * 432 = 432 MHz VCO, / 2 = 216 MHz, APB1 / 4 = 54 MHz with timers at 108 MHz,
+  *        APB2 / 2 = 108 MHz, 432 / 9 = 48 MHz USB; 216 MHz is 8 started 30 MHz steps, 7 wait states;
+  *        108 MHz / 32928 Hz = 3280.0, prescaler 3279; 108 / 4 = 27 MHz ADC; 108 MHz * 14.43 us = 1558 - 20.
+  *        balanced: 336 MHz VCO, 168 MHz, APB1 42 MHz with timers at 84 MHz, APB2 84 MHz, 336 / 7 = 48 MHz;
+  *        5 wait states; 84 MHz / 32928 Hz = 2551.0, prescaler 2550 as in the original set-up; 84 / 4 = 21 MHz
+  *        ADC; 84 MHz * 14.43 us = 1212 - 20.
+  *        low-power: 192 MHz VCO, / 4 = 48 MHz, APB1 / 2 = 24 MHz with timers at 48 MHz, APB2 48 MHz,
+  *        192 / 4 = 48 MHz; 1 wait state; 48 MHz / 32928 Hz = 1457.7, prescaler 1457; 48 / 2 = 24 MHz ADC;
+  *        24 MHz * 14.43 us = 346 - 20.
+  */
+static const expectedClocks expected[ClockProfileCount] = {
+	{ClockMaxPerformance, 216000000, 216000000, 54000000, 108000000, 108000000, 48000000, 7, 1, true,
+			3279, 4, 215999, 1538},
+	{ClockBalanced, 168000000, 168000000, 42000000, 84000000, 84000000, 48000000, 5, 2, false,
+			2550, 4, 167999, 1192},
+	{ClockLowPower, 48000000, 48000000, 24000000, 48000000, 48000000, 48000000, 1, 3, false,
+			1457, 2, 47999, 326}
+};
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Compares a value with the one expected and prints both if they differ.
+  * @param name Name of the profile.
+  * @param what What was checked.
+  * @param value The value.
+  * @param wanted The value expected.
+  * @returns Void.
+  */
+static void checkValue(const char* name, const char* what, uint32_t value, uint32_t wanted){
+	if(value != wanted){
+		printf("FAIL %s %s: %u, expected %u\n", name, what, (unsigned int)value, (unsigned int)wanted);
+		failures++;
+	}
+}
+
+/**
+  * @brief Checks one profile against its expected values.
+  * @param want The expected values.
+  * @returns Void.
+  */
+static void checkProfile(const expectedClocks* want){
+	const clockTree* tree = clockProfileTree(want->profile);
+	uint32_t timerClock;
+	uint32_t servoHz;
+
+	if(tree == NULL){
+		printf("FAIL profile %d missing\n", (int)want->profile);
+		failures++;
+		return;
+	}
+	checkValue(tree->name, "clockValidate", clockValidate(tree), 0);
+	checkValue(tree->name, "SYSCLK", clockSysclk(tree), want->sysclk);
+	checkValue(tree->name, "HCLK", clockHclk(tree), want->hclk);
+	checkValue(tree->name, "APB1", clockPclk1(tree), want->pclk1);
+	checkValue(tree->name, "APB2", clockPclk2(tree), want->pclk2);
+	checkValue(tree->name, "APB1 timers", clockApb1TimerClock(tree), want->timerClock);
+	checkValue(tree->name, "USB", clockUsb(tree), want->usb);
+	checkValue(tree->name, "flash latency", clockFlashLatency(clockHclk(tree)), want->flashLatency);
+	checkValue(tree->name, "voltage scale", tree->voltageScale, want->voltageScale);
+	checkValue(tree->name, "over-drive", tree->overDrive, want->overDrive);
+	checkValue(tree->name, "within its voltage scale",
+			clockSysclk(tree) <= clockMaxSysclk(tree->voltageScale, tree->overDrive), 1);
+
+	timerClock = clockApb1TimerClock(tree);
+	checkValue(tree->name, "servo prescaler", clockTimerPrescaler(timerClock, CLOCK_SERVO_TICK_HZ),
+			want->servoPrescaler);
+	// The servo pulse lengths are counted at CLOCK_SERVO_TICK_HZ, so it must hold within 0.1 %
+	servoHz = timerClock / (clockTimerPrescaler(timerClock, CLOCK_SERVO_TICK_HZ) + 1);
+	checkValue(tree->name, "servo tick within 0.1 %",
+			servoHz * 1000 >= CLOCK_SERVO_TICK_HZ * 999u && servoHz * 1000 <= CLOCK_SERVO_TICK_HZ * 1001u, 1);
+	checkValue(tree->name, "ADC divider", clockAdcDivider(clockPclk2(tree)), want->adcDivider);
+	checkValue(tree->name, "ADC within its limit", clockPclk2(tree) / want->adcDivider <= CLOCK_ADC_MAX_HZ, 1);
+	checkValue(tree->name, "SysTick reload", clockSysTickReload(clockHclk(tree), CLOCK_TICK_HZ),
+			want->sysTickReload);
+	checkValue(tree->name, "kernel tick", clockHclk(tree) / (want->sysTickReload + 1), CLOCK_TICK_HZ);
+	checkValue(tree->name, "SDRAM refresh", clockSdramRefreshCount(clockHclk(tree)), want->sdramRefresh);
+	printf("%-9s %3u MHz, APB1 %2u MHz, APB2 %3u MHz, %u wait states, servo PSC %u, ADC /%u, SysTick %u\n",
+			tree->name, (unsigned int)(clockSysclk(tree) / 1000000), (unsigned int)(clockPclk1(tree) / 1000000),
+			(unsigned int)(clockPclk2(tree) / 1000000), (unsigned int)clockFlashLatency(clockHclk(tree)),
+			(unsigned int)clockTimerPrescaler(timerClock, CLOCK_SERVO_TICK_HZ),
+			(unsigned int)clockAdcDivider(clockPclk2(tree)),
+			(unsigned int)clockSysTickReload(clockHclk(tree), CLOCK_TICK_HZ));
+}
+
+/**
+  * @brief Checks that clockValidate reports broken trees.
+  * @param None.
+  * @returns Void.
+  */
+static void checkValidate(void){
+	clockTree tree = *clockProfileTree(ClockMaxPerformance);
+
+	tree.overDrive = false;
+	checkValue("216 MHz", "without over-drive", clockValidate(&tree),
+			ClockErrorSysclk | ClockErrorApb1 | ClockErrorApb2);
+	tree = *clockProfileTree(ClockMaxPerformance);
+	tree.apb1Divider = 2;
+	checkValue("216 MHz", "with APB1 / 2", clockValidate(&tree), ClockErrorApb1);
+	tree = *clockProfileTree(ClockBalanced);
+	tree.pllq = 8;
+	checkValue("balanced", "with a 42 MHz USB clock", clockValidate(&tree), ClockErrorUsb);
+	tree = *clockProfileTree(ClockLowPower);
+	tree.pllm = 10;
+	checkValue("low-power", "with a 2.5 MHz PLL input", clockValidate(&tree) & ClockErrorPllInput,
+			ClockErrorPllInput);
+	tree = *clockProfileTree(ClockLowPower);
+	tree.pllp = 3;
+	checkValue("low-power", "with PLLP 3", clockValidate(&tree), ClockErrorDivider);
+	checkValue("none", "clockProfileTree past the end", clockProfileTree(ClockProfileCount) == NULL, 1);
+}
+
+/**
+  * @brief Reads OS_CLOCK from the kernel configuration and checks it is the core clock the board starts in.
+  * @param None.
+  * @returns Void.
+  */
+static void checkOsClock(void){
+	char line[256];
+	unsigned long osClock = 0;
+	FILE* in = fopen(RTX_CONF, "r");
+
+	if(in == NULL){
+		printf("FAIL %s missing\n", RTX_CONF);
+		failures++;
+		return;
+	}
+	while(fgets(line, sizeof(line), in) != NULL){
+		if(sscanf(line, " #define OS_CLOCK %lu", &osClock) == 1){
+			break;
+		}
+	}
+	fclose(in);
+	checkValue("OS_CLOCK", "of RTX_Conf_CM.c", (uint32_t)osClock,
+			clockSysclk(clockProfileTree(PLATFORM_DEFAULT_PROFILE)));
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	int i;
+	for(i = 0; i < ClockProfileCount; i++){
+		checkProfile(&expected[i]);
+	}
+	checkValidate();
+	checkOsClock();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,199 @@
+/**
+  * @file draw_bench.c
+  * @brief Times each drawing primitive of glcd_soft.c: how long one call takes and how many pixels a second
+  *        it writes. Every primitive is called with the sizes the screens use, for at least DRAW_BENCH_MS.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Board_GLCD.h"
+#include "GLCD_Config.h"
+#include "glcd_soft.h"
+
+/**
+  * @brief Least time each primitive is run for, in milliseconds.
+  */
+#define DRAW_BENCH_MS 200
+
+/**
+  * @brief Glyph bits of a 16x24 font, every glyph solid, and the font.
+  */
+static uint8_t fontBits[95 * 2 * 24];
+static GLCD_FONT font = {16, 24, 32, 95, fontBits};
+
+/**
+  * @brief An RGB565 bitmap the size of a score digit.
+  */
+static uint16_t bitmap[32 * 48];
+
+/**
+  * @brief The call of a primitive, with the index of the call to vary its position.
+  */
+typedef void (*drawCall)(uint32_t i);
+
+/**
+  * @brief A struct containing a primitive to time and the pixels one call writes.
+  */
+typedef struct{
+	const char* name;
+	drawCall call;
+	uint32_t pixels;
+	}benchmark;
+
+/**
+  * @brief Clears the whole screen.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawClear(uint32_t i){
+	GLCD_ClearScreen();
+}
+
+/**
+  * @brief Draws one pixel, walking the screen.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawPixel(uint32_t i){
+	GLCD_DrawPixel(i % GLCD_WIDTH, (i / GLCD_WIDTH) % GLCD_HEIGHT);
+}
+
+/**
+  * @brief Draws a horizontal line across the screen.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawHLine(uint32_t i){
+	GLCD_DrawHLine(0, i % GLCD_HEIGHT, GLCD_WIDTH);
+}
+
+/**
+  * @brief Draws a vertical line down the screen.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawVLine(uint32_t i){
+	GLCD_DrawVLine(i % GLCD_WIDTH, 0, GLCD_HEIGHT);
+}
+
+/**
+  * @brief Draws the outline of the START GAME button.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawRectangle(uint32_t i){
+	GLCD_DrawRectangle(170, 150, 130, 50);
+}
+
+/**
+  * @brief Draws one 16x24 digit.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawChar(uint32_t i){
+	GLCD_DrawChar(16 * (i % 29), 50, '0' + (int32_t)(i % 10));
+}
+
+/**
+  * @brief Draws a player label.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawString(uint32_t i){
+	GLCD_DrawString(70, 50, "Player 1");
+}
+
+/**
+  * @brief Draws a full width bargraph at a changing value.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawBargraph(uint32_t i){
+	GLCD_DrawBargraph(20, 200, 440, 20, i % 101);
+}
+
+/**
+  * @brief Draws a score digit sized bitmap.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawBitmap(uint32_t i){
+	GLCD_DrawBitmap(62 + 2 * (i % 100), 110, 32, 48, (const uint8_t*)bitmap);
+}
+
+/**
+  * @brief Scrolls the screen by one line.
+  * @param i Index of the call.
+  * @returns Void.
+  */
+static void drawVScroll(uint32_t i){
+	GLCD_VScroll(1);
+}
+
+/**
+  * @brief The primitives, with the pixels each call writes.
+  */
+static const benchmark benchmarks[] = {
+	{"ClearScreen", drawClear, GLCD_WIDTH * GLCD_HEIGHT},
+	{"DrawPixel", drawPixel, 1},
+	{"DrawHLine", drawHLine, GLCD_WIDTH},
+	{"DrawVLine", drawVLine, GLCD_HEIGHT},
+	{"DrawRectangle", drawRectangle, 2 * 130 + 2 * 50},
+	{"DrawChar", drawChar, 16 * 24},
+	{"DrawString", drawString, 8 * 16 * 24},
+	{"DrawBargraph", drawBargraph, 440 * 20},
+	{"DrawBitmap", drawBitmap, 32 * 48},
+	{"VScroll", drawVScroll, GLCD_WIDTH * GLCD_HEIGHT}
+};
+
+/**
+  * @brief Reads the monotonic clock.
+  * @param None.
+  * @returns Nanoseconds.
+  */
+static uint64_t nanos(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief Main runner of the benchmark.
+  * @param None.
+  * @returns 0.
+  */
+int main(void){
+	const benchmark* b;
+	uint64_t start;
+	uint64_t elapsed;
+	uint32_t calls;
+	uint32_t batch;
+
+	memset(fontBits, 0xFF, sizeof(fontBits));
+	memset(bitmap, 0x5A, sizeof(bitmap));
+	GLCD_Initialize();
+	GLCD_SetFont(&font);
+	GLCD_SetForegroundColor(GLCD_COLOR_YELLOW);
+	GLCD_SetBackgroundColor(GLCD_COLOR_BLACK);
+
+	printf("%-14s %12s %12s\n", "primitive", "ns/call", "Mpixel/s");
+	for(b = benchmarks; b < benchmarks + sizeof(benchmarks) / sizeof(benchmarks[0]); b++){
+		calls = 0;
+		start = nanos();
+		// The clock is only read between batches, so its own cost stays out of the small primitives
+		do{
+			for(batch = 0; batch < 64; batch++){
+				b->call(calls++);
+			}
+			elapsed = nanos() - start;
+		}while(elapsed < (uint64_t)DRAW_BENCH_MS * 1000000);
+		printf("%-14s %12.1f %12.1f\n", b->name, (double)elapsed / calls,
+				(double)b->pixels * calls * 1000.0 / (double)elapsed);
+	}
+	return 0;
+}
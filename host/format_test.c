@@ -0,0 +1,171 @@
+/**
+  * @file format_test.c
+  * @brief Checks number_format.c against snprintf: every width from 1 to FORMAT_MAX_WIDTH for the edge values,
+  *        and the whole 32-bit range in steps of 7919 above 100000, signed and unsigned. Checks the '#' fill of a
+  *        field too narrow and the change mask of formatChanges, then prints how much faster formatting is than
+  *        snprintf. The speed is for information, it does not fail the test.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "number_format.h"
+
+/**
+  * @brief Numbers formatted in the speed comparison, and the width they are formatted at.
+  */
+#define FORMAT_TIMED 1000000
+#define FORMAT_TIMED_WIDTH 3
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Edge values checked at every width.
+  */
+static const int64_t edges[] = {0, 1, 9, 10, 99, 100, 999, 1000, 65535, 99999, 100000, 2147483647, -1, -9, -10,
+		-99, -100, -2147483647 - 1, 4294967295LL};
+
+/**
+  * @brief Formats a number both ways at one width and compares the results.
+  * @param value The number, signed if it is negative or fits in int32_t.
+  * @param isSigned Whether to use formatSigned.
+  * @param width Width of the field.
+  * @returns Void.
+  */
+static void checkNumber(int64_t value, int isSigned, unsigned int width){
+	char expected[32];
+	char actual[FORMAT_MAX_WIDTH + 1];
+	int length;
+	int result;
+
+	if(isSigned){
+		length = snprintf(expected, sizeof(expected), "%*ld", (int)width, (long)value);
+		result = formatSigned(actual, width, (int32_t)value);
+	}else{
+		length = snprintf(expected, sizeof(expected), "%*lu", (int)width, (unsigned long)value);
+		result = formatUnsigned(actual, width, (uint32_t)value);
+	}
+	if(length > (int)width){
+		// Too narrow: the field is filled with '#'
+		memset(expected, '#', width);
+		expected[width] = '\0';
+	}
+	if(strcmp(expected, actual) != 0 || result != ((length > (int)width) ? -1 : 0)){
+		if(failures++ < 10){
+			printf("FAIL %s %lld width %u: \"%s\" returned %d, expected \"%s\"\n", isSigned ? "signed" : "unsigned",
+					(long long)value, width, actual, result, expected);
+		}
+	}
+}
+
+/**
+  * @brief Checks formatChanges on one pair of texts.
+  * @param shown The text on screen.
+  * @param next The next text.
+  * @param expected The change mask expected.
+  * @returns Void.
+  */
+static void checkChanges(const char* shown, const char* next, uint32_t expected){
+	char text[FORMAT_MAX_WIDTH + 1];
+	uint32_t changed;
+
+	strcpy(text, shown);
+	changed = formatChanges(text, next, (unsigned int)strlen(next));
+	if(changed != expected || strcmp(text, next) != 0){
+		printf("FAIL changes \"%s\" to \"%s\": mask %x, expected %x\n", shown, next,
+				(unsigned int)changed, (unsigned int)expected);
+		failures++;
+	}
+}
+
+/**
+  * @brief Reads the monotonic clock.
+  * @param None.
+  * @returns Nanoseconds.
+  */
+static uint64_t nanos(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief Times formatting the scores both ways.
+  * @param None.
+  * @returns Void.
+  */
+static void timeFormatting(void){
+	char text[FORMAT_MAX_WIDTH + 1];
+	volatile char sink = 0;
+	uint64_t start;
+	uint64_t snprintfTime;
+	uint64_t formatTime;
+	uint32_t i;
+
+	start = nanos();
+	for(i = 0; i < FORMAT_TIMED; i++){
+		snprintf(text, sizeof(text), "%*u", FORMAT_TIMED_WIDTH, (unsigned int)(i % 1000));
+		sink ^= text[FORMAT_TIMED_WIDTH - 1];
+	}
+	snprintfTime = nanos() - start;
+	start = nanos();
+	for(i = 0; i < FORMAT_TIMED; i++){
+		formatUnsigned(text, FORMAT_TIMED_WIDTH, i % 1000);
+		sink ^= text[FORMAT_TIMED_WIDTH - 1];
+	}
+	formatTime = nanos() - start;
+	printf("snprintf %.1f ns, formatUnsigned %.1f ns, %.1fx faster\n", (double)snprintfTime / FORMAT_TIMED,
+			(double)formatTime / FORMAT_TIMED, (double)snprintfTime / (double)formatTime);
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	char field[FORMAT_MAX_WIDTH + 2];
+	unsigned int width;
+	unsigned int i;
+	uint64_t value;
+
+	for(width = 1; width <= FORMAT_MAX_WIDTH; width++){
+		for(i = 0; i < sizeof(edges) / sizeof(edges[0]); i++){
+			if(edges[i] >= 0){
+				checkNumber(edges[i], 0, width);
+			}
+			if(edges[i] >= -2147483647 - 1 && edges[i] <= 2147483647){
+				checkNumber(edges[i], 1, width);
+			}
+		}
+	}
+	for(value = 0; value <= 0xFFFFFFFFu; value += (value < 100000) ? 1 : 7919){
+		checkNumber((int64_t)value, 0, FORMAT_UNSIGNED_WIDTH);
+		checkNumber((int64_t)(int32_t)(uint32_t)value, 1, FORMAT_SIGNED_WIDTH);
+	}
+	if(formatUnsigned(field, 0, 1) != -1 || formatUnsigned(field, FORMAT_MAX_WIDTH + 1, 1) != -1
+			|| formatSigned(field, 0, 1) != -1){
+		printf("FAIL invalid widths accepted\n");
+		failures++;
+	}
+
+	checkChanges("  7", "  8", 0x4);
+	checkChanges("  9", " 10", 0x6);
+	checkChanges("123", "123", 0);
+	checkChanges("999", "  0", 0x7);
+
+	timeFormatting();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
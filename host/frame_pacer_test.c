@@ -0,0 +1,225 @@
+/**
+  * @file frame_pacer_test.c
+  * @brief Checks frame_pacer.c against its simulated display. A UI frame that fits its budget gets one tick per
+  *        FRAME_PACER_INTERVAL display frames and is never counted missed. A UI frame that takes longer than
+  *        two intervals has the ticks that came while it ran merged into one EventFrame: no second event is
+  *        ever queued, every frame after the first stands for more than one tick, the extra ticks are counted
+  *        as missed and the slack is negative. A tick that finds the queue full is taken by the next one.
+  *        postEvent is replaced by a queue of one EventFrame, so the pacer runs alone.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "events.h"
+#include "frame_pacer.h"
+
+/**
+  * @brief Modelled cost of a light UI frame and of an overloaded one, in microseconds.
+  *        The overloaded frame takes two and a half intervals.
+  */
+#define LIGHT_FRAME_US 5000
+#define HEAVY_FRAME_US (FRAME_PACER_PERIOD_US * FRAME_PACER_INTERVAL * 5 / 2)
+
+/**
+  * @brief UI frames run in each part of the test.
+  */
+#define UI_FRAMES 100
+
+/**
+  * @brief Step of simulated time while the UI waits for an event.
+  */
+#define WAIT_STEP_US 100
+
+/**
+  * @brief The stand-in event queue: whether an EventFrame is queued, events posted, events posted while one
+  *        was queued, and whether the queue refuses the next post.
+  */
+static int queued = 0;
+static uint32_t posted = 0;
+static uint32_t duplicates = 0;
+static int refuseNext = 0;
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Stands in for the event queue of events.c, holding one EventFrame.
+  * @param type Type of the event, only EventFrame is posted by the pacer.
+  * @param value Unused.
+  * @returns true if the event was queued.
+  */
+bool postEvent(enum eventType type, int value){
+	if(type != EventFrame){
+		return false;
+	}
+	if(refuseNext){
+		refuseNext = 0;
+		return false;
+	}
+	duplicates += queued;
+	queued = 1;
+	posted++;
+	return true;
+}
+
+/**
+  * @brief Advances simulated time until an EventFrame is queued, then takes it from the queue.
+  * @param None.
+  * @returns Microseconds waited.
+  */
+static uint32_t waitFrame(void){
+	uint32_t waited = 0;
+	while(!queued){
+		framePacerSimulate(WAIT_STEP_US);
+		waited += WAIT_STEP_US;
+	}
+	queued = 0;
+	return waited;
+}
+
+/**
+  * @brief Runs UI frames of one cost, as the screens thread does.
+  * @param cost Modelled cost of each frame in microseconds.
+  * @param ticks Filled with the ticks each frame stood for.
+  * @param slack Filled with the slack of each frame.
+  * @returns Void.
+  */
+static void runFrames(uint32_t cost, uint32_t* ticks, int32_t* slack){
+	int frame;
+	for(frame = 0; frame < UI_FRAMES; frame++){
+		waitFrame();
+		ticks[frame] = framePacerBegin();
+		framePacerSimulate(cost);
+		slack[frame] = framePacerEnd();
+	}
+}
+
+/**
+  * @brief Checks light frames: one tick each, nothing missed and the slack what is left of the budget.
+  * @param None.
+  * @returns Void.
+  */
+static void checkLight(void){
+	uint32_t ticks[UI_FRAMES];
+	int32_t slack[UI_FRAMES];
+	framePacerStats stats;
+	int single = 1;
+	int fits = 1;
+	int frame;
+
+	runFrames(LIGHT_FRAME_US, ticks, slack);
+	framePacerGetStats(&stats);
+	for(frame = 0; frame < UI_FRAMES; frame++){
+		single &= ticks[frame] == 1;
+		// A frame starts up to WAIT_STEP_US after its tick
+		fits &= slack[frame] <= FRAME_PACER_PERIOD_US * FRAME_PACER_INTERVAL - LIGHT_FRAME_US
+				&& slack[frame] >= FRAME_PACER_PERIOD_US * FRAME_PACER_INTERVAL - LIGHT_FRAME_US - WAIT_STEP_US;
+	}
+	printf("light: %u display frames, %u UI frames, %u missed, worst slack %d us\n",
+			(unsigned int)stats.displayFrames, (unsigned int)stats.uiFrames, (unsigned int)stats.missedFrames,
+			(int)stats.worstSlackMicros);
+	check(single, "a light frame stands for one tick");
+	check(fits, "a light frame leaves the rest of its budget as slack");
+	check(stats.missedFrames == 0, "no light frame is missed");
+	check(stats.uiFrames == UI_FRAMES, "every light frame is counted");
+	check(stats.displayFrames >= UI_FRAMES * FRAME_PACER_INTERVAL
+			&& stats.displayFrames < (UI_FRAMES + 1) * FRAME_PACER_INTERVAL, "one UI frame per FRAME_PACER_INTERVAL");
+}
+
+/**
+  * @brief Checks overloaded frames: ticks merged, counted missed, never queued twice, slack negative.
+  * @param None.
+  * @returns Void.
+  */
+static void checkOverloaded(void){
+	uint32_t ticks[UI_FRAMES];
+	int32_t slack[UI_FRAMES];
+	framePacerStats before;
+	framePacerStats after;
+	uint32_t merged = 0;
+	uint32_t total = 0;
+	int over = 1;
+	int frame;
+
+	framePacerGetStats(&before);
+	runFrames(HEAVY_FRAME_US, ticks, slack);
+	framePacerGetStats(&after);
+	for(frame = 0; frame < UI_FRAMES; frame++){
+		total += ticks[frame];
+		merged += ticks[frame] > 1;
+		over &= slack[frame] < 0;
+	}
+	printf("overloaded: %u display frames, %u UI frames for %u ticks, %u missed, worst slack %d us\n",
+			(unsigned int)(after.displayFrames - before.displayFrames), (unsigned int)(after.uiFrames - before.uiFrames),
+			(unsigned int)total, (unsigned int)(after.missedFrames - before.missedFrames), (int)after.worstSlackMicros);
+	check(duplicates == 0, "no second EventFrame is queued while one waits");
+	check(merged >= UI_FRAMES - 1, "every overloaded frame after the first stands for several ticks");
+	check(after.missedFrames - before.missedFrames == total - UI_FRAMES, "every merged tick is counted missed");
+	check(total >= UI_FRAMES * 2, "overloaded frames skip at least every other tick");
+	check(over, "an overloaded frame has negative slack");
+	check(after.worstSlackMicros <= FRAME_PACER_PERIOD_US * FRAME_PACER_INTERVAL - HEAVY_FRAME_US,
+			"the worst slack is at least the overload");
+}
+
+/**
+  * @brief Checks that a tick refused by a full queue is taken by the next one.
+  * @param None.
+  * @returns Void.
+  */
+static void checkQueueFull(void){
+	framePacerStats before;
+	framePacerStats after;
+	uint32_t postedBefore;
+	uint32_t ticks;
+
+	// Start just after a tick, with the queue empty
+	waitFrame();
+	framePacerBegin();
+	framePacerEnd();
+	framePacerGetStats(&before);
+	postedBefore = posted;
+	refuseNext = 1;
+	framePacerSimulate(FRAME_PACER_PERIOD_US * FRAME_PACER_INTERVAL);
+	check(!queued && posted == postedBefore, "a full queue refuses the tick");
+	waitFrame();
+	ticks = framePacerBegin();
+	framePacerEnd();
+	framePacerGetStats(&after);
+	check(ticks == 2, "the next frame takes the refused tick");
+	check(after.missedFrames == before.missedFrames + 1, "the refused tick is counted missed");
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	framePacerInitialize();
+	checkLight();
+	checkOverloaded();
+	checkQueueFull();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
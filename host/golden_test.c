@@ -0,0 +1,147 @@
+/**
+  * @file golden_test.c
+  * @brief Boots the whole firmware on the host, shows each screen in turn and compares the frame buffer with
+  *        a golden image of it in golden/. A screen that differs is written to build/ for a look.
+  *        Run with GOLDEN_UPDATE=1 in the environment, as `make golden` does, to write new golden images
+  *        after a deliberate change to a screen. The images are of the default build, without GLCD_LAYERS.
+  *        Built with GLCD_L8, as l8_golden_test, the palette indices are turned back into RGB565 pixels with
+  *        glcdL8ToRGB565 first and compared with the images in golden/l8.
+  *        Last, the ten digits of the score font are drawn across a cleared screen and compared with digits.ppm.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cmsis_os_soft.h"
+#include "hal_soft.h"
+#include "Board_GLCD.h"
+#include "GLCD_Config.h"
+#include "glcd_soft.h"
+#include "glcd_l8.h"
+#include "screens.h"
+#include "score_font.h"
+#include "events.h"
+
+/**
+  * @brief Directory of the golden images. The palette mode has no anti-aliased score digits, so its images differ.
+  */
+#ifdef GLCD_L8
+#define GOLDEN_DIRECTORY "golden/l8"
+#else
+#define GOLDEN_DIRECTORY "golden"
+#endif
+
+/**
+  * @brief Centre of the START GAME button of the home screen.
+  */
+#define START_X 235
+#define START_Y 175
+
+/**
+  * @brief Top of the row of score digits.
+  */
+#define DIGITS_Y ((GLCD_HEIGHT - SCORE_FONT_HEIGHT) / 2)
+
+/**
+  * @brief Screens that differed from their golden image.
+  */
+static int failures = 0;
+
+/**
+  * @brief Checks the frame buffer against its golden image, or replaces the golden image when GOLDEN_UPDATE is set.
+  * @param name Name of the golden image, without directory and extension.
+  * @returns Void.
+  */
+static void checkGolden(const char* name){
+	char path[64];
+	long differences;
+
+	sprintf(path, GOLDEN_DIRECTORY "/%s.ppm", name);
+#ifdef GLCD_L8
+	// The RGB565 buffer of glcd_soft.c is not shown in L8 mode, it takes the expanded indices
+	glcdL8ToRGB565(glcdSoftFrameBuffer());
+#endif
+	if(getenv("GOLDEN_UPDATE") != NULL){
+		printf("%s %s\n", (glcdSoftWritePPM(path) == 0) ? "wrote" : "FAIL writing", path);
+		return;
+	}
+	differences = glcdSoftCompare(path);
+	if(differences == 0){
+		printf("ok %s\n", name);
+		return;
+	}
+	failures++;
+	if(differences < 0){
+		printf("FAIL %s: %s missing, run make golden\n", name, path);
+	}else{
+		sprintf(path, "build/%s.ppm", name);
+		glcdSoftWritePPM(path);
+		printf("FAIL %s: %ld pixels differ, see %s\n", name, differences, path);
+	}
+}
+
+/**
+  * @brief Runs the firmware for a while, then checks the screen shown against its golden image.
+  * @param millisec Time to run.
+  * @param expected The screen that should be shown.
+  * @param name Name of the golden image, without directory and extension.
+  * @returns Void.
+  */
+static void checkScreen(uint32_t millisec, enum screen expected, const char* name){
+	halSoftRun(millisec);
+	if(screenCurrent() != expected){
+		printf("FAIL %s: screen %d shown\n", name, (int)screenCurrent());
+		failures++;
+		return;
+	}
+	checkGolden(name);
+}
+
+/**
+  * @brief Draws every digit of the score font across a cleared screen and checks it against its golden image.
+  *        The script thread does not yield, so nothing else draws in between.
+  * @param None.
+  * @returns Void.
+  */
+static void checkDigits(void){
+	GLCD_SetBackgroundColor(GLCD_COLOR_BLACK);
+	GLCD_ClearScreen();
+	if(scoreFontDrawString(0, DIGITS_Y, "0123456789", GLCD_COLOR_WHITE, GLCD_COLOR_BLACK) != 0){
+		printf("FAIL digits: the row does not fit the screen\n");
+		failures++;
+		return;
+	}
+	checkGolden("digits");
+}
+
+/**
+  * @brief Thread function playing the test.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	checkScreen(300, Home, "home");
+	postTouchEvent(TouchDown, START_X, START_Y);
+	postTouchEvent(TouchUp, START_X, START_Y);
+	checkScreen(300, Game, "game");
+	halSoftSetAdc(HAL_SOFT_LIGHT_CHANNEL, HAL_SOFT_LIGHT_OPEN);
+	checkScreen(500, Error, "error");
+	checkDigits();
+	exit(failures == 0 ? 0 : 1);
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the script with the kernel.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osThreadCreate(osThread(scriptTask), NULL);
+}
@@ -0,0 +1,134 @@
+/**
+  * @file governor_test.c
+  * @brief Boots the whole firmware on the host and moves from Home to Game to Error, checking after each screen
+  *        that governor.c has switched to the profile of governorPolicy through platformSetProfile of
+  *        hal_soft.c, and that what follows the clocks was set again: the core clock, the servo timer
+  *        prescalers, the ADC clock divider and the SysTick reload, with the rates of governorGetStats. The
+  *        switch into Game waits for a simulated servo in the middle of its pulse, so the wait must stop at
+  *        one PWM period. No switch may fail or take longer than GOVERNOR_SWITCH_BUDGET_US.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cmsis_os_soft.h"
+#include "hal_soft.h"
+#include "governor.h"
+#include "platform.h"
+#include "screens.h"
+#include "events.h"
+
+/**
+  * @brief Centre of the START GAME button of the home screen.
+  */
+#define START_X 235
+#define START_Y 175
+
+/**
+  * @brief Longest the governor may wait for the servos, one PWM period, in microseconds.
+  */
+#define SERVO_PERIOD_US ((uint32_t)((uint64_t)GOVERNOR_SERVO_PERIOD * 1000000 / CLOCK_SERVO_TICK_HZ))
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param name Name of the screen.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* name, const char* what){
+	if(!passed){
+		printf("FAIL %s: %s\n", name, what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Runs the firmware for a while, then checks the screen shown and everything that follows its profile.
+  * @param millisec Time to run.
+  * @param expected The screen that should be shown.
+  * @param name Name of the screen, for the messages.
+  * @returns Void.
+  */
+static void checkScreen(uint32_t millisec, enum screen expected, const char* name){
+	enum clockProfile wanted = governorPolicy(expected);
+	const clockTree* tree = clockProfileTree(wanted);
+	uint32_t timerClock = clockApb1TimerClock(tree);
+	governorStats stats;
+
+	halSoftRun(millisec);
+	governorGetStats(&stats);
+	printf("%-5s %-9s %3u MHz, servo %u Hz, ADC %u Hz, tick %u Hz, %u switches, last %u us\n", name,
+			tree->name, (unsigned int)(SystemCoreClock / 1000000), (unsigned int)stats.servoTickHz,
+			(unsigned int)stats.adcHz, (unsigned int)stats.kernelTickHz, (unsigned int)stats.switches,
+			(unsigned int)stats.lastSwitchMicros);
+	check(screenCurrent() == expected, name, "screen shown");
+	check(stats.profile == wanted && platformProfile() == wanted, name, "profile of governorPolicy");
+	check(SystemCoreClock == clockHclk(tree), name, "core clock");
+	check(TIM3->PSC == clockTimerPrescaler(timerClock, CLOCK_SERVO_TICK_HZ) && TIM12->PSC == TIM3->PSC, name,
+			"servo timer prescalers");
+	check(stats.servoTickHz * 1000 >= CLOCK_SERVO_TICK_HZ * 999u
+			&& stats.servoTickHz * 1000 <= CLOCK_SERVO_TICK_HZ * 1001u, name,
+			"servo PWM within 0.1 % of CLOCK_SERVO_TICK_HZ");
+	check(halSoftAdcPrescaler() == clockAdcDivider(clockPclk2(tree)), name, "ADC clock divider");
+	check(stats.adcHz != 0 && stats.adcHz <= CLOCK_ADC_MAX_HZ, name, "ADC clock within its limit");
+	check(SysTick->LOAD == clockSysTickReload(SystemCoreClock, CLOCK_TICK_HZ), name, "SysTick reload");
+	check(stats.kernelTickHz == CLOCK_TICK_HZ, name, "kernel tick");
+}
+
+/**
+  * @brief Thread function playing the test.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	governorStats stats;
+
+	checkScreen(300, Home, "home");
+	// Mid-pulse, so the switch up to the game waits as long as it may
+	governorSimulateServo(0, GOVERNOR_SERVO_PERIOD / 2);
+	postTouchEvent(TouchDown, START_X, START_Y);
+	postTouchEvent(TouchUp, START_X, START_Y);
+	checkScreen(300, Game, "game");
+	governorSimulateServo(GOVERNOR_SERVO_PERIOD / 2, 0);
+	halSoftSetAdc(HAL_SOFT_LIGHT_CHANNEL, HAL_SOFT_LIGHT_OPEN);
+	checkScreen(500, Error, "error");
+
+	governorGetStats(&stats);
+	printf("worst switch %u us of %u, worst wait %u us of %u\n", (unsigned int)stats.worstSwitchMicros,
+			(unsigned int)GOVERNOR_SWITCH_BUDGET_US, (unsigned int)stats.worstWaitMicros,
+			(unsigned int)SERVO_PERIOD_US);
+	check(stats.switches >= 3, "all", "a switch for each screen");
+	check(stats.failures == 0, "all", "no switch failed");
+	check(stats.overBudget == 0 && stats.worstSwitchMicros <= GOVERNOR_SWITCH_BUDGET_US, "all",
+			"every switch within GOVERNOR_SWITCH_BUDGET_US");
+	check(stats.worstWaitMicros > 0 && stats.worstWaitMicros <= SERVO_PERIOD_US, "all",
+			"the wait for a busy servo stops at one PWM period");
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		exit(1);
+	}
+	printf("PASS\n");
+	exit(0);
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the script with the kernel.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osThreadCreate(osThread(scriptTask), NULL);
+}
@@ -0,0 +1,345 @@
+/**
+  * @file hal_soft.c
+  * @brief Host implementation of the HAL calls, board fonts and platform functions the firmware uses.
+  *        Links with glcd_soft.c and cmsis_os_soft.c in place of the HAL, the board support pack and platform.c.
+  *        Peripherals are plain structs: the firmware's register writes land in them, and a test can read them
+  *        back or set the input data registers of the GPIO ports to press the flipper buttons.
+  *        The ADC returns a value set per channel with halSoftSetAdc, so a test can play the sensors.
+  *        The fonts have the geometry of the board fonts, but each glyph is a box with the character code inside,
+  *        enough to see where text is drawn and to tell strings apart in a screenshot.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <string.h>
+#include "hal_soft.h"
+#include "Board_GLCD.h"
+#include "platform.h"
+#include "cmsis_os.h"
+#include "frame_pacer.h"
+
+/**
+  * @brief The peripherals.
+  */
+GPIO_TypeDef hostGpio[11];
+TIM_TypeDef hostTim3;
+TIM_TypeDef hostTim12;
+ADC_TypeDef hostAdc3;
+SysTick_Type hostSysTick;
+DWT_Type hostDwt;
+CoreDebug_Type hostCoreDebug;
+
+/**
+  * @brief Core clock in Hz, follows platformSetProfile as on the board.
+  */
+uint32_t SystemCoreClock = 216000000;
+
+/**
+  * @brief Glyph bits of the two board fonts, filled by buildFont.
+  */
+static uint8_t font6x8Bits[95 * 8];
+static uint8_t font16x24Bits[95 * 2 * 24];
+
+/**
+  * @brief The board fonts used by the firmware.
+  */
+GLCD_FONT GLCD_Font_6x8 = {6, 8, 32, 95, font6x8Bits};
+GLCD_FONT GLCD_Font_16x24 = {16, 24, 32, 95, font16x24Bits};
+
+/**
+  * @brief Value each ADC channel converts to, and the channel selected.
+  */
+static uint32_t adcValues[19];
+static uint32_t adcChannel = 0;
+
+/**
+  * @brief Clock profile set by platformSetProfile.
+  */
+static enum clockProfile activeProfile = PLATFORM_DEFAULT_PROFILE;
+
+/**
+  * @brief ADC clock divider, set by HAL_ADC_Init and platformSetProfile where the board sets ADCPRE.
+  */
+static uint32_t adcPrescaler = 0;
+
+/**
+  * @brief Draws the box glyphs of a font: a frame, with the character code in binary down the middle rows.
+  *        Space stays blank.
+  * @param font The font whose bitmap is filled.
+  * @param bits The bitmap of the font.
+  * @returns Void.
+  */
+static void buildFont(const GLCD_FONT* font, uint8_t* bits){
+	uint32_t bytesPerRow = (font->width + 7) / 8;
+	uint32_t ch, x, y;
+	bool on;
+
+	memset(bits, 0, font->count * bytesPerRow * font->height);
+	for(ch = 1; ch < font->count; ch++){
+		uint8_t* glyph = bits + ch * bytesPerRow * font->height;
+		for(y = 0; y < font->height; y++){
+			for(x = 0; x < font->width; x++){
+				on = (y == 0 || y == font->height - 1U || x == 0 || x == font->width - 1U);
+				// Seven rows in the middle carry one bit of the character code each
+				if(!on && x > 1 && x < font->width - 2U && y >= 1 && y - 1 < 7){
+					on = ((font->offset + ch) >> (y - 1)) & 1;
+				}
+				if(on){
+					glyph[y * bytesPerRow + x / 8] |= (uint8_t)(1 << (x % 8));
+				}
+			}
+		}
+	}
+}
+
+/**
+  * @brief Sets the value an ADC channel converts to.
+  * @param channel ADC_CHANNEL_n.
+  * @param value 12-bit conversion result.
+  * @returns Void.
+  */
+void halSoftSetAdc(uint32_t channel, uint32_t value){
+	if(channel < sizeof(adcValues) / sizeof(adcValues[0])){
+		adcValues[channel] = value;
+	}
+}
+
+/**
+  * @brief Returns the ADC clock divider the firmware set last, the ADCPRE setting of the board.
+  * @param None.
+  * @returns Divider, 2 to 8.
+  */
+uint32_t halSoftAdcPrescaler(void){
+	return adcPrescaler;
+}
+
+/**
+  * @brief Lets the firmware run for a while with the display refreshing, from a thread of the host kernel.
+  *        Sleeps a display frame at a time and finishes each frame, as the LTDC would, before sleeping again.
+  * @param millisec Time to run in milliseconds, rounded up to whole display frames.
+  * @returns Void.
+  */
+void halSoftRun(uint32_t millisec){
+	uint32_t elapsed;
+
+	for(elapsed = 0; elapsed < millisec * 1000; elapsed += FRAME_PACER_PERIOD_US){
+		framePacerSimulate(FRAME_PACER_PERIOD_US);
+		osDelay((FRAME_PACER_PERIOD_US + 999) / 1000);
+	}
+}
+
+/**
+  * @brief Starts the HAL: builds the fonts and puts the sensors at rest.
+  * @param None.
+  * @returns HAL_OK.
+  */
+HAL_StatusTypeDef HAL_Init(void){
+	buildFont(&GLCD_Font_6x8, font6x8Bits);
+	buildFont(&GLCD_Font_16x24, font16x24Bits);
+	// Only sensors no test has set yet start at rest
+	if(adcValues[HAL_SOFT_PLAYER1_CHANNEL] == 0){
+		adcValues[HAL_SOFT_PLAYER1_CHANNEL] = HAL_SOFT_IR_IDLE;
+	}
+	if(adcValues[HAL_SOFT_PLAYER2_CHANNEL] == 0){
+		adcValues[HAL_SOFT_PLAYER2_CHANNEL] = HAL_SOFT_IR_IDLE;
+	}
+	if(adcValues[HAL_SOFT_LIGHT_CHANNEL] == 0){
+		adcValues[HAL_SOFT_LIGHT_CHANNEL] = HAL_SOFT_LIGHT_CLOSED;
+	}
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority){
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn){
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn){
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init){
+}
+
+/**
+  * @brief Reads a pin from the input data register of its port.
+  */
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin){
+	return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+/**
+  * @brief Writes a pin to the output data register of its port.
+  */
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState){
+	if(PinState == GPIO_PIN_SET){
+		GPIOx->ODR |= GPIO_Pin;
+	}else{
+		GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+	}
+}
+
+/**
+  * @brief Passes an EXTI line on to the callback, as the HAL handler does once it cleared the line.
+  */
+void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin){
+	HAL_GPIO_EXTI_Callback(GPIO_Pin);
+}
+
+/**
+  * @brief Sets up a timer base: the prescaler and period go straight to the registers.
+  */
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef* htim){
+	htim->Instance->PSC = htim->Init.Prescaler;
+	htim->Instance->ARR = htim->Init.Period;
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef* htim, TIM_ClockConfigTypeDef* sClockSourceConfig){
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef* htim){
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef* htim, TIM_MasterConfigTypeDef* sMasterConfig){
+	return HAL_OK;
+}
+
+/**
+  * @brief Sets up channel 1 of a PWM timer: the pulse goes to its compare register.
+  */
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef* htim, TIM_OC_InitTypeDef* sConfig, uint32_t Channel){
+	htim->Instance->CCR1 = sConfig->Pulse;
+	return HAL_OK;
+}
+
+/**
+  * @brief Starts the counter of a timer.
+  */
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef* htim, uint32_t Channel){
+	htim->Instance->CR1 |= 1;
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef* hadc){
+	adcPrescaler = hadc->Init.ClockPrescaler;
+	return HAL_OK;
+}
+
+/**
+  * @brief Selects the channel the following conversions read.
+  */
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef* hadc, ADC_ChannelConfTypeDef* sConfig){
+	adcChannel = sConfig->Channel;
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef* hadc){
+	return HAL_OK;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef* hadc){
+	return HAL_OK;
+}
+
+/**
+  * @brief A conversion is always ready.
+  */
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef* hadc, uint32_t Timeout){
+	return HAL_OK;
+}
+
+/**
+  * @brief Returns the value set with halSoftSetAdc for the selected channel.
+  */
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef* hadc){
+	return (adcChannel < sizeof(adcValues) / sizeof(adcValues[0])) ? adcValues[adcChannel] : 0;
+}
+
+/**
+  * @brief Nothing to configure on the host.
+  */
+void platformInitialize(void){
+}
+
+/**
+  * @brief Switches the clock profile and, as on the board, everything that follows it: the SysTick reload,
+  *        the servo timer prescalers and the ADC clock divider. There are no clocks to start on the host.
+  * @param profile The profile to run in.
+  * @returns 0 on success, -1 if the profile is not valid.
+  */
+int platformSetProfile(enum clockProfile profile){
+	const clockTree* tree = clockProfileTree(profile);
+
+	if(tree == NULL || clockValidate(tree) != 0){
+		return -1;
+	}
+	activeProfile = profile;
+	SystemCoreClock = clockHclk(tree);
+	platformRetuneTick();
+	TIM3->PSC = platformServoPrescaler();
+	TIM12->PSC = platformServoPrescaler();
+	adcPrescaler = platformAdcPrescaler();
+	return 0;
+}
+
+/**
+  * @brief The host kernel keeps its own tick, only the reload the SysTick would get is recorded.
+  */
+void platformRetuneTick(void){
+	SysTick->LOAD = clockSysTickReload(SystemCoreClock, CLOCK_TICK_HZ);
+}
+
+/**
+  * @brief Returns the clock profile set last.
+  */
+enum clockProfile platformProfile(void){
+	return activeProfile;
+}
+
+/**
+  * @brief Returns the servo timer prescaler of the current profile, worked out as on the board.
+  */
+uint32_t platformServoPrescaler(void){
+	return clockTimerPrescaler(clockApb1TimerClock(clockProfileTree(activeProfile)), CLOCK_SERVO_TICK_HZ);
+}
+
+/**
+  * @brief Returns the ADC clock divider of the current profile, as a divider rather than the HAL constant.
+  */
+uint32_t platformAdcPrescaler(void){
+	return clockAdcDivider(clockPclk2(clockProfileTree(activeProfile)));
+}
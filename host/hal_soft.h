@@ -0,0 +1,33 @@
+/**
+  * @file hal_soft.h
+  * @brief Header file of the hal_soft.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef HAL_SOFT_H
+#define HAL_SOFT_H
+
+#include <stdint.h>
+#include "stm32f7xx_hal.h"
+
+/**
+  * @brief ADC channels of the sensors, as sampled by analogTask in main.c.
+  */
+#define HAL_SOFT_PLAYER1_CHANNEL ADC_CHANNEL_0
+#define HAL_SOFT_PLAYER2_CHANNEL ADC_CHANNEL_8
+#define HAL_SOFT_LIGHT_CHANNEL ADC_CHANNEL_6
+
+/**
+  * @brief Sensor readings of a machine at rest: nothing in front of the IR sensors and the lid shut.
+  */
+#define HAL_SOFT_IR_IDLE 2000
+#define HAL_SOFT_LIGHT_CLOSED 4095
+#define HAL_SOFT_LIGHT_OPEN 3000
+
+void halSoftSetAdc(uint32_t channel, uint32_t value);
+uint32_t halSoftAdcPrescaler(void);
+void halSoftRun(uint32_t millisec);
+
+#endif
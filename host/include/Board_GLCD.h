@@ -0,0 +1,44 @@
+/**
+  * @file Board_GLCD.h
+  * @brief Host stand-in for the Board_GLCD.h header of the board support pack. glcd_soft.c implements it.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef BOARD_GLCD_H
+#define BOARD_GLCD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+  * @brief A struct containing a bitmap font: glyph size, first character, character count and the glyph bits.
+  */
+typedef struct{
+	uint16_t width;
+	uint16_t height;
+	uint16_t offset;
+	uint16_t count;
+	const uint8_t* bitmap;
+	}GLCD_FONT;
+
+int32_t GLCD_Initialize(void);
+int32_t GLCD_Uninitialize(void);
+int32_t GLCD_SetForegroundColor(uint32_t color);
+int32_t GLCD_SetBackgroundColor(uint32_t color);
+int32_t GLCD_ClearScreen(void);
+int32_t GLCD_SetFont(GLCD_FONT* font);
+int32_t GLCD_DrawPixel(uint32_t x, uint32_t y);
+int32_t GLCD_DrawHLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t GLCD_DrawVLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t GLCD_DrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+int32_t GLCD_DrawChar(uint32_t x, uint32_t y, int32_t ch);
+int32_t GLCD_DrawString(uint32_t x, uint32_t y, const char* str);
+int32_t GLCD_DrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val);
+int32_t GLCD_DrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap);
+int32_t GLCD_VScroll(uint32_t dy);
+int32_t GLCD_FrameBufferAccess(bool enable);
+uint32_t GLCD_FrameBufferAddress(void);
+
+#endif
@@ -0,0 +1,18 @@
+/**
+  * @file Board_LED.h
+  * @brief Host stand-in for the Board_LED.h header of the board support pack.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef BOARD_LED_H
+#define BOARD_LED_H
+
+#include <stdint.h>
+
+int32_t LED_Initialize(void);
+int32_t LED_On(uint32_t num);
+int32_t LED_Off(uint32_t num);
+
+#endif
@@ -0,0 +1,27 @@
+/**
+  * @file Board_Touch.h
+  * @brief Host stand-in for the Board_Touch.h header of the board support pack.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef BOARD_TOUCH_H
+#define BOARD_TOUCH_H
+
+#include <stdint.h>
+
+/**
+  * @brief A struct containing the touch state: whether the panel is pressed and where.
+  */
+typedef struct{
+	uint8_t pressed;
+	int16_t x;
+	int16_t y;
+	}TOUCH_STATE;
+
+int32_t Touch_Initialize(void);
+int32_t Touch_Uninitialize(void);
+int32_t Touch_GetState(TOUCH_STATE* state);
+
+#endif
@@ -0,0 +1,32 @@
+/**
+  * @file GLCD_Config.h
+  * @brief Host stand-in for the GLCD_Config.h header of the board support pack: screen size and RGB565 colours.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef GLCD_CONFIG_H
+#define GLCD_CONFIG_H
+
+#define GLCD_WIDTH 480
+#define GLCD_HEIGHT 272
+
+#define GLCD_COLOR_BLACK 0x0000
+#define GLCD_COLOR_NAVY 0x000F
+#define GLCD_COLOR_DARK_GREEN 0x03E0
+#define GLCD_COLOR_DARK_CYAN 0x03EF
+#define GLCD_COLOR_MAROON 0x7800
+#define GLCD_COLOR_PURPLE 0x780F
+#define GLCD_COLOR_OLIVE 0x7BE0
+#define GLCD_COLOR_LIGHT_GREY 0xC618
+#define GLCD_COLOR_DARK_GREY 0x7BEF
+#define GLCD_COLOR_BLUE 0x001F
+#define GLCD_COLOR_GREEN 0x07E0
+#define GLCD_COLOR_CYAN 0x07FF
+#define GLCD_COLOR_RED 0xF800
+#define GLCD_COLOR_MAGENTA 0xF81F
+#define GLCD_COLOR_YELLOW 0xFFE0
+#define GLCD_COLOR_WHITE 0xFFFF
+
+#endif
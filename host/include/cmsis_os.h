@@ -0,0 +1,155 @@
+/**
+  * @file cmsis_os.h
+  * @brief Host stand-in for the CMSIS-RTOS v1 header of RTX. Declares the part of the API that
+  *        cmsis_os_soft.c implements, with the same types and definition macros as RTX.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef CMSIS_OS_H
+#define CMSIS_OS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __RTX
+
+/**
+  * @brief Rate osKernelSysTick counts at, OS_CLOCK of RTX_Conf_CM.c.
+  */
+#define osKernelSysTickFrequency 216000000
+
+/**
+  * @brief Timeout that never expires.
+  */
+#define osWaitForever 0xFFFFFFFF
+
+/**
+  * @brief An enum containing the thread priorities.
+  */
+typedef enum{
+	osPriorityIdle = -3,
+	osPriorityLow = -2,
+	osPriorityBelowNormal = -1,
+	osPriorityNormal = 0,
+	osPriorityAboveNormal = 1,
+	osPriorityHigh = 2,
+	osPriorityRealtime = 3,
+	osPriorityError = 0x84
+	}osPriority;
+
+/**
+  * @brief An enum containing the status and event codes returned by the kernel.
+  */
+typedef enum{
+	osOK = 0,
+	osEventSignal = 0x08,
+	osEventMessage = 0x10,
+	osEventMail = 0x20,
+	osEventTimeout = 0x40,
+	osErrorParameter = 0x80,
+	osErrorResource = 0x81,
+	osErrorTimeoutResource = 0xC1,
+	osErrorISR = 0x82,
+	osErrorNoMemory = 0x85,
+	osErrorValue = 0x86,
+	osErrorOS = 0xFF
+	}osStatus;
+
+/**
+  * @brief An enum containing the timer types.
+  */
+typedef enum{
+	osTimerOnce = 0,
+	osTimerPeriodic = 1
+	}os_timer_type;
+
+typedef void (*os_pthread)(void const* argument);
+typedef void (*os_ptimer)(void const* argument);
+
+typedef struct os_thread_cb* osThreadId;
+typedef struct os_timer_cb* osTimerId;
+typedef struct os_messageQ_cb* osMessageQId;
+
+/**
+  * @brief A struct containing a thread definition made by osThreadDef.
+  */
+typedef struct os_thread_def{
+	os_pthread pthread;
+	osPriority tpriority;
+	uint32_t instances;
+	uint32_t stacksize;
+	}osThreadDef_t;
+
+/**
+  * @brief A struct containing a timer definition made by osTimerDef.
+  */
+typedef struct os_timer_def{
+	os_ptimer ptimer;
+	void* timer;
+	}osTimerDef_t;
+
+/**
+  * @brief A struct containing a message queue definition made by osMessageQDef.
+  */
+typedef struct os_messageQ_def{
+	uint32_t queue_sz;
+	void* pool;
+	}osMessageQDef_t;
+
+/**
+  * @brief A struct containing the result of a wait: a status and the signals or message received.
+  */
+typedef struct{
+	osStatus status;
+	union{
+		uint32_t v;
+		void* p;
+		int32_t signals;
+		}value;
+	union{
+		osMessageQId message_id;
+		}def;
+	}osEvent;
+
+#define osThreadDef(name, priority, instances, stacksz) \
+	const osThreadDef_t os_thread_def_##name = {(name), (priority), (instances), (stacksz)}
+#define osThread(name) &os_thread_def_##name
+
+#define osTimerDef(name, function) \
+	uint32_t os_timer_cb_##name[6]; \
+	const osTimerDef_t os_timer_def_##name = {(function), ((void*)os_timer_cb_##name)}
+#define osTimer(name) &os_timer_def_##name
+
+#define osMessageQDef(name, queue_sz, type) \
+	uint32_t os_messageQ_q_##name[4 + (queue_sz)] = {0}; \
+	const osMessageQDef_t os_messageQ_def_##name = {(queue_sz), ((void*)(os_messageQ_q_##name))}
+#define osMessageQ(name) &os_messageQ_def_##name
+
+osStatus osKernelInitialize(void);
+osStatus osKernelStart(void);
+int32_t osKernelRunning(void);
+uint32_t osKernelSysTick(void);
+
+osThreadId osThreadCreate(const osThreadDef_t* thread_def, void* argument);
+osThreadId osThreadGetId(void);
+osStatus osThreadYield(void);
+osStatus osThreadSetPriority(osThreadId thread_id, osPriority priority);
+osPriority osThreadGetPriority(osThreadId thread_id);
+
+osStatus osDelay(uint32_t millisec);
+
+int32_t osSignalSet(osThreadId thread_id, int32_t signals);
+int32_t osSignalClear(osThreadId thread_id, int32_t signals);
+osEvent osSignalWait(int32_t signals, uint32_t millisec);
+
+osMessageQId osMessageCreate(const osMessageQDef_t* queue_def, osThreadId thread_id);
+osStatus osMessagePut(osMessageQId queue_id, uint32_t info, uint32_t millisec);
+osEvent osMessageGet(osMessageQId queue_id, uint32_t millisec);
+
+osTimerId osTimerCreate(const osTimerDef_t* timer_def, os_timer_type type, void* argument);
+osStatus osTimerStart(osTimerId timer_id, uint32_t millisec);
+osStatus osTimerStop(osTimerId timer_id);
+
+#endif
@@ -0,0 +1,350 @@
+/**
+  * @file stm32f7xx_hal.h
+  * @brief Host stand-in for the STM32F7 HAL and CMSIS device headers. Declares the part the firmware uses.
+  *        Each peripheral is a struct in host memory defined in hal_soft.c, so register writes made by
+  *        code shared with the target land somewhere harmless and can be read back by the tests.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef STM32F7XX_HAL_H
+#define STM32F7XX_HAL_H
+
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------
+ *      Core intrinsics, nothing to do on the host
+ *---------------------------------------------------------------------------*/
+
+#define __IO volatile
+#define __STATIC_INLINE static inline
+#define __WFI() do{}while(0)
+#define __NOP() do{}while(0)
+#define __DSB() __sync_synchronize()
+#define __ISB() __sync_synchronize()
+#define __DMB() __sync_synchronize()
+#define __disable_irq() do{}while(0)
+#define __enable_irq() do{}while(0)
+#define __get_PRIMASK() 0u
+#define __set_PRIMASK(x) ((void)(x))
+#define __get_IPSR() 0u
+#define __CLZ(x) ((uint32_t)__builtin_clz(x))
+
+/*----------------------------------------------------------------------------
+ *      HAL common
+ *---------------------------------------------------------------------------*/
+
+typedef enum{
+	HAL_OK,
+	HAL_ERROR,
+	HAL_BUSY,
+	HAL_TIMEOUT
+	}HAL_StatusTypeDef;
+
+typedef enum{
+	RESET = 0,
+	SET = 1
+	}FlagStatus;
+
+typedef enum{
+	DISABLE = 0,
+	ENABLE = 1
+	}FunctionalState;
+
+typedef enum{
+	SysTick_IRQn = -1,
+	ADC_IRQn = 18,
+	TIM3_IRQn = 29,
+	EXTI15_10_IRQn = 40,
+	OTG_FS_IRQn = 67,
+	LTDC_IRQn = 88,
+	DMA2D_IRQn = 90
+	}IRQn_Type;
+
+HAL_StatusTypeDef HAL_Init(void);
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority);
+uint32_t HAL_GetTick(void);
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority);
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+extern uint32_t SystemCoreClock;
+
+#define __HAL_RCC_PWR_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM3_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM12_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOG_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOH_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOI_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_DMA2D_CLK_ENABLE() do{}while(0)
+#define __GPIOA_CLK_ENABLE() do{}while(0)
+#define __GPIOF_CLK_ENABLE() do{}while(0)
+#define __ADC3_CLK_ENABLE() do{}while(0)
+
+/*----------------------------------------------------------------------------
+ *      GPIO
+ *---------------------------------------------------------------------------*/
+
+typedef enum{
+	GPIO_PIN_RESET = 0,
+	GPIO_PIN_SET
+	}GPIO_PinState;
+
+typedef struct{
+	__IO uint32_t MODER;
+	__IO uint32_t OTYPER;
+	__IO uint32_t OSPEEDR;
+	__IO uint32_t PUPDR;
+	__IO uint32_t IDR;
+	__IO uint32_t ODR;
+	__IO uint32_t BSRR;
+	__IO uint32_t LCKR;
+	__IO uint32_t AFR[2];
+	}GPIO_TypeDef;
+
+typedef struct{
+	uint32_t Pin;
+	uint32_t Mode;
+	uint32_t Pull;
+	uint32_t Speed;
+	uint32_t Alternate;
+	}GPIO_InitTypeDef;
+
+extern GPIO_TypeDef hostGpio[11];
+#define GPIOA (&hostGpio[0])
+#define GPIOB (&hostGpio[1])
+#define GPIOC (&hostGpio[2])
+#define GPIOD (&hostGpio[3])
+#define GPIOE (&hostGpio[4])
+#define GPIOF (&hostGpio[5])
+#define GPIOG (&hostGpio[6])
+#define GPIOH (&hostGpio[7])
+#define GPIOI (&hostGpio[8])
+#define GPIOJ (&hostGpio[9])
+#define GPIOK (&hostGpio[10])
+
+#define GPIO_PIN_0 0x0001u
+#define GPIO_PIN_1 0x0002u
+#define GPIO_PIN_2 0x0004u
+#define GPIO_PIN_3 0x0008u
+#define GPIO_PIN_4 0x0010u
+#define GPIO_PIN_5 0x0020u
+#define GPIO_PIN_6 0x0040u
+#define GPIO_PIN_7 0x0080u
+#define GPIO_PIN_8 0x0100u
+#define GPIO_PIN_10 0x0400u
+#define GPIO_PIN_13 0x2000u
+
+#define GPIO_MODE_INPUT 0x00000000u
+#define GPIO_MODE_OUTPUT_PP 0x00000001u
+#define GPIO_MODE_AF_PP 0x00000002u
+#define GPIO_MODE_ANALOG 0x00000003u
+#define GPIO_MODE_IT_RISING 0x10110000u
+#define GPIO_MODE_IT_FALLING 0x10210000u
+#define GPIO_NOPULL 0u
+#define GPIO_PULLUP 1u
+#define GPIO_PULLDOWN 2u
+#define GPIO_SPEED_FREQ_LOW 0u
+#define GPIO_SPEED_HIGH 2u
+#define GPIO_AF2_TIM3 2u
+#define GPIO_AF9_TIM12 9u
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin);
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+
+/*----------------------------------------------------------------------------
+ *      Timers
+ *---------------------------------------------------------------------------*/
+
+typedef struct{
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	__IO uint32_t SMCR;
+	__IO uint32_t DIER;
+	__IO uint32_t SR;
+	__IO uint32_t EGR;
+	__IO uint32_t CCMR1;
+	__IO uint32_t CCMR2;
+	__IO uint32_t CCER;
+	__IO uint32_t CNT;
+	__IO uint32_t PSC;
+	__IO uint32_t ARR;
+	__IO uint32_t RCR;
+	__IO uint32_t CCR1;
+	__IO uint32_t CCR2;
+	__IO uint32_t CCR3;
+	__IO uint32_t CCR4;
+	}TIM_TypeDef;
+
+typedef struct{
+	uint32_t Prescaler;
+	uint32_t CounterMode;
+	uint32_t Period;
+	uint32_t ClockDivision;
+	uint32_t RepetitionCounter;
+	uint32_t AutoReloadPreload;
+	}TIM_Base_InitTypeDef;
+
+typedef struct{
+	TIM_TypeDef* Instance;
+	TIM_Base_InitTypeDef Init;
+	}TIM_HandleTypeDef;
+
+typedef struct{
+	uint32_t ClockSource;
+	uint32_t ClockPolarity;
+	uint32_t ClockPrescaler;
+	uint32_t ClockFilter;
+	}TIM_ClockConfigTypeDef;
+
+typedef struct{
+	uint32_t MasterOutputTrigger;
+	uint32_t MasterSlaveMode;
+	}TIM_MasterConfigTypeDef;
+
+typedef struct{
+	uint32_t OCMode;
+	uint32_t Pulse;
+	uint32_t OCPolarity;
+	uint32_t OCNPolarity;
+	uint32_t OCFastMode;
+	uint32_t OCIdleState;
+	uint32_t OCNIdleState;
+	}TIM_OC_InitTypeDef;
+
+extern TIM_TypeDef hostTim3;
+extern TIM_TypeDef hostTim12;
+#define TIM3 (&hostTim3)
+#define TIM12 (&hostTim12)
+
+#define TIM_COUNTERMODE_UP 0u
+#define TIM_CLOCKDIVISION_DIV1 0u
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0u
+#define TIM_CLOCKSOURCE_INTERNAL 0u
+#define TIM_TRGO_RESET 0u
+#define TIM_MASTERSLAVEMODE_DISABLE 0u
+#define TIM_OCMODE_PWM1 0x60u
+#define TIM_OCPOLARITY_HIGH 0u
+#define TIM_OCFAST_DISABLE 0u
+#define TIM_CHANNEL_1 0u
+
+#define __HAL_TIM_SET_PRESCALER(handle, value) ((handle)->Instance->PSC = (value))
+#define __HAL_TIM_SET_AUTORELOAD(handle, value) ((handle)->Instance->ARR = (value))
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef* htim, TIM_ClockConfigTypeDef* sClockSourceConfig);
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef* htim);
+HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef* htim, TIM_MasterConfigTypeDef* sMasterConfig);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef* htim, TIM_OC_InitTypeDef* sConfig, uint32_t Channel);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef* htim, uint32_t Channel);
+
+/*----------------------------------------------------------------------------
+ *      ADC
+ *---------------------------------------------------------------------------*/
+
+typedef struct{
+	__IO uint32_t SR;
+	__IO uint32_t CR1;
+	__IO uint32_t CR2;
+	}ADC_TypeDef;
+
+typedef struct{
+	uint32_t ClockPrescaler;
+	uint32_t Resolution;
+	uint32_t DataAlign;
+	uint32_t ScanConvMode;
+	uint32_t EOCSelection;
+	uint32_t ContinuousConvMode;
+	uint32_t NbrOfConversion;
+	uint32_t DiscontinuousConvMode;
+	uint32_t NbrOfDiscConversion;
+	uint32_t ExternalTrigConv;
+	uint32_t ExternalTrigConvEdge;
+	uint32_t DMAContinuousRequests;
+	}ADC_InitTypeDef;
+
+typedef struct{
+	ADC_TypeDef* Instance;
+	ADC_InitTypeDef Init;
+	}ADC_HandleTypeDef;
+
+typedef struct{
+	uint32_t Channel;
+	uint32_t Rank;
+	uint32_t SamplingTime;
+	uint32_t Offset;
+	}ADC_ChannelConfTypeDef;
+
+extern ADC_TypeDef hostAdc3;
+#define ADC3 (&hostAdc3)
+
+#define ADC_CHANNEL_0 0u
+#define ADC_CHANNEL_6 6u
+#define ADC_CHANNEL_8 8u
+#define ADC_REGULAR_RANK_1 1u
+#define ADC_SAMPLETIME_480CYCLES 7u
+#define ADC_RESOLUTION_12B 0u
+#define ADC_DATAALIGN_RIGHT 0u
+#define ADC_EXTERNALTRIGCONVEDGE_NONE 0u
+#define ADC_EXTERNALTRIGCONV_T1_CC1 0u
+
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef* hadc);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef* hadc, ADC_ChannelConfTypeDef* sConfig);
+HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef* hadc);
+HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef* hadc);
+HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef* hadc, uint32_t Timeout);
+uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef* hadc);
+
+/*----------------------------------------------------------------------------
+ *      Core peripherals
+ *---------------------------------------------------------------------------*/
+
+typedef struct{
+	__IO uint32_t CTRL;
+	__IO uint32_t LOAD;
+	__IO uint32_t VAL;
+	__IO uint32_t CALIB;
+	}SysTick_Type;
+
+typedef struct{
+	__IO uint32_t CTRL;
+	__IO uint32_t CYCCNT;
+	}DWT_Type;
+
+typedef struct{
+	__IO uint32_t DHCSR;
+	__IO uint32_t DCRSR;
+	__IO uint32_t DCRDR;
+	__IO uint32_t DEMCR;
+	}CoreDebug_Type;
+
+extern SysTick_Type hostSysTick;
+extern DWT_Type hostDwt;
+extern CoreDebug_Type hostCoreDebug;
+#define SysTick (&hostSysTick)
+#define DWT (&hostDwt)
+#define CoreDebug (&hostCoreDebug)
+
+#define SysTick_CTRL_ENABLE_Msk 1u
+#define DWT_CTRL_CYCCNTENA_Msk 1u
+#define CoreDebug_DEMCR_TRCENA_Msk (1u << 24)
+
+/**
+  * @brief Starts the SysTick. The host kernel keeps its own tick, so this only marks it enabled.
+  * @param ticks Core clock cycles between two ticks.
+  * @returns 0.
+  */
+static inline uint32_t SysTick_Config(uint32_t ticks){
+	SysTick->LOAD = ticks - 1;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	return 0;
+}
+
+#endif
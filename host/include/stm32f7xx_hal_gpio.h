@@ -0,0 +1,9 @@
+/**
+  * @file stm32f7xx_hal_gpio.h
+  * @brief Host stand-in, everything the firmware uses is declared in stm32f7xx_hal.h.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "stm32f7xx_hal.h"
@@ -0,0 +1,105 @@
+/**
+  * @file layers_test.c
+  * @brief Checks layersCompose of layers.c, built with GLCD_LAYERS: layersInitialize moves the drawing to the
+  *        background layer, the key colour of the HUD layer shows the background, HUD pixels cover it, and the
+  *        constant alphas blend the layers over black the way the LTDC does. Expected colours are worked out
+  *        by hand from the LTDC blending formula.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "layers.h"
+
+/**
+  * @brief A pixel outside the HUD rectangle and one inside it.
+  */
+#define OUTSIDE (10 * GLCD_WIDTH + 10)
+#define INSIDE (110 * GLCD_WIDTH + 110)
+
+/**
+  * @brief The composed image.
+  */
+static uint16_t composed[GLCD_WIDTH * GLCD_HEIGHT];
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Composes the layers and checks two pixels of the result.
+  * @param what What is checked.
+  * @param outside Colour expected outside the HUD rectangle.
+  * @param inside Colour expected inside it.
+  * @returns Void.
+  */
+static void checkComposed(const char* what, uint16_t outside, uint16_t inside){
+	layersCompose(composed);
+	if(composed[OUTSIDE] != outside || composed[INSIDE] != inside){
+		printf("FAIL %s: %04x and %04x, expected %04x and %04x\n", what, composed[OUTSIDE], composed[INSIDE],
+				outside, inside);
+		failures++;
+	}
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	GLCD_Initialize();
+	GLCD_SetBackgroundColor(GLCD_COLOR_BLUE);
+	GLCD_ClearScreen();
+	layersInitialize();
+	if(layerBackgroundBuffer()[OUTSIDE] != GLCD_COLOR_BLUE){
+		printf("FAIL the drawing did not move to the background layer\n");
+		failures++;
+	}
+	checkComposed("key colour shows the background", GLCD_COLOR_BLUE, GLCD_COLOR_BLUE);
+
+	GLCD_SetForegroundColor(GLCD_COLOR_WHITE);
+	GLCD_DrawBargraph(100, 100, 40, 40, 100);
+	checkComposed("HUD covers the background", GLCD_COLOR_BLUE, GLCD_COLOR_WHITE);
+
+	// 255 * 128 / 255 = 128 in blue, 16 in five bits
+	layerSetAlpha(LayerBackground, 128);
+	layerSetAlpha(LayerHud, 255);
+	checkComposed("background alpha", 0x0010, GLCD_COLOR_WHITE);
+
+	// White at 128 over opaque blue: red and green 128, blue stays 255
+	layerSetAlpha(LayerBackground, 255);
+	layerSetAlpha(LayerHud, 128);
+	checkComposed("HUD alpha", GLCD_COLOR_BLUE, 0x841F);
+
+	layerFade(0, LAYER_FADE_MS);
+	if(layerAlpha(LayerBackground) != 0 || layerAlpha(LayerHud) != 0){
+		printf("FAIL fade to black ends at alpha 0\n");
+		failures++;
+	}
+	checkComposed("faded out", GLCD_COLOR_BLACK, GLCD_COLOR_BLACK);
+	layerFade(255, LAYER_FADE_MS);
+	checkComposed("faded in", GLCD_COLOR_BLUE, GLCD_COLOR_WHITE);
+
+	// A screen draws its whole background before committing it
+	GLCD_SetBackgroundColor(GLCD_COLOR_GREEN);
+	GLCD_ClearScreen();
+	GLCD_DrawBargraph(100, 100, 40, 40, 100);
+	layerCommitBackground();
+	checkComposed("HUD committed to the background", GLCD_COLOR_GREEN, GLCD_COLOR_WHITE);
+	GLCD_SetForegroundColor(GLCD_COLOR_RED);
+	GLCD_DrawBargraph(100, 100, 40, 40, 100);
+	layerSetAlpha(LayerHud, 0);
+	checkComposed("invisible HUD", GLCD_COLOR_GREEN, GLCD_COLOR_WHITE);
+
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,71 @@
+/**
+  * @file mirror2ppm.c
+  * @brief Decodes a display stream of mirror.c with mirrorDecode and writes the screen it ends on as a PPM image.
+  *        The stream is read from a file, such as a recording of the board's CDC port, or from a terminal
+  *        in raw mode, in which case the image is rewritten after every frame. Given a third image, the
+  *        decoded screen is compared with it and any difference fails.
+  *        Usage: mirror2ppm stream image.ppm [expected.ppm]
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "glcd_soft.h"
+#include "mirror.h"
+
+/**
+  * @brief Main runner of the decoder.
+  * @param argc Number of arguments.
+  * @param argv The stream, the image to write and the image to compare with.
+  * @returns 0 on success, 1 if a file could not be opened, no frame was complete or the screen differs.
+  */
+int main(int argc, char** argv){
+	static uint8_t data[4096];
+	mirrorDecoder decoder;
+	ssize_t length;
+	uint32_t frames = 0;
+	uint32_t completed;
+	long differences;
+	int live;
+	int in;
+
+	if(argc < 3 || argc > 4){
+		fprintf(stderr, "usage: %s stream image.ppm [expected.ppm]\n", argv[0]);
+		return 1;
+	}
+	if((in = open(argv[1], O_RDONLY)) < 0){
+		perror(argv[1]);
+		return 1;
+	}
+	live = isatty(in);
+	mirrorDecoderInitialize(&decoder, glcdSoftFrameBuffer());
+	while((length = read(in, data, sizeof(data))) > 0){
+		completed = mirrorDecode(&decoder, data, (uint32_t)length);
+		frames += completed;
+		if(live && completed > 0 && glcdSoftWritePPM(argv[2]) != 0){
+			perror(argv[2]);
+			return 1;
+		}
+	}
+	close(in);
+	fprintf(stderr, "%u frames, %u errors\n", (unsigned int)frames, (unsigned int)decoder.errors);
+	if(frames == 0){
+		return 1;
+	}
+	if(glcdSoftWritePPM(argv[2]) != 0){
+		perror(argv[2]);
+		return 1;
+	}
+	if(argc == 4){
+		differences = glcdSoftCompare(argv[3]);
+		if(differences != 0){
+			fprintf(stderr, "%s: %ld pixels differ\n", argv[3], differences);
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,278 @@
+/**
+  * @file mirror_test.c
+  * @brief Boots the whole firmware on the host with MIRROR_ENABLED and streams the display through a
+  *        pseudo-terminal. A thread outside the kernel reads the other end and rebuilds the screen with
+  *        mirrorDecode. After each screen, and after the home screen has animated for a while, the rebuilt
+  *        screen must match the GLCD_SOFT frame buffer once every dirty tile is sent. No frame may exceed the
+  *        budget of MIRROR_BYTES_PER_SECOND, and a frame with nothing drawn only carries the refresh tiles.
+  *        The stream is kept in build/ with the last screen, for mirror2ppm.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _XOPEN_SOURCE 600
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cmsis_os_soft.h"
+#include "hal_soft.h"
+#include "glcd_soft.h"
+#include "mirror.h"
+#include "screens.h"
+#include "events.h"
+// After the firmware headers, its CR1 and CR2 would rename register fields
+#include <termios.h>
+
+/**
+  * @brief Centre of the START GAME button of the home screen.
+  */
+#define START_X 235
+#define START_Y 175
+
+/**
+  * @brief Frames streamed while the home screen animates.
+  */
+#define ANIMATED_FRAMES 50
+
+/**
+  * @brief Most bytes a frame may take, and most a message takes.
+  */
+#define FRAME_BYTES (MIRROR_BYTES_PER_SECOND / 1000 * MIRROR_FRAME_MS)
+#define MAX_MESSAGE (MIRROR_HEADER_SIZE + MIRROR_TILE_PIXELS * 2)
+
+/**
+  * @brief Files of the stream and of the last screen, relative to host/, where make runs the test.
+  */
+#define MIRROR_STREAM "build/mirror_stream.bin"
+#define MIRROR_SCREEN "build/mirror_screen.ppm"
+
+/**
+  * @brief The master side of the pseudo-terminal, read by the viewer thread, and the recording of the stream.
+  */
+static int master = -1;
+static FILE* recording = NULL;
+
+/**
+  * @brief The viewer: its decoder, the screen it rebuilds, the bytes and frames it received.
+  *        Guarded by lock, decoded is signalled at every frame.
+  */
+static mirrorDecoder decoder;
+static uint16_t rebuilt[GLCD_WIDTH * GLCD_HEIGHT];
+static uint64_t received = 0;
+static uint32_t decodedFrames = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t decoded = PTHREAD_COND_INITIALIZER;
+
+/**
+  * @brief Frames and bytes sent, the largest frame, and the checks that failed.
+  */
+static uint32_t sentFrames = 0;
+static uint64_t sentBytes = 0;
+static uint32_t largestFrame = 0;
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Thread function of the viewer, outside the kernel: reads the stream until the terminal closes.
+  * @param argument Unused.
+  * @returns NULL.
+  */
+static void* viewerTask(void* argument){
+	uint8_t data[4096];
+	ssize_t length;
+
+	while((length = read(master, data, sizeof(data))) > 0){
+		pthread_mutex_lock(&lock);
+		fwrite(data, 1, (size_t)length, recording);
+		received += (uint64_t)length;
+		decodedFrames += mirrorDecode(&decoder, data, (uint32_t)length);
+		pthread_cond_signal(&decoded);
+		pthread_mutex_unlock(&lock);
+	}
+	return NULL;
+}
+
+/**
+  * @brief Opens a pseudo-terminal in raw mode, points the stream at it and starts the viewer.
+  * @param None.
+  * @returns 0 on success, -1 on failure.
+  */
+static int openTerminal(void){
+	struct termios raw;
+	pthread_t viewer;
+	int slave;
+	FILE* output;
+
+	master = posix_openpt(O_RDWR | O_NOCTTY);
+	if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0){
+		return -1;
+	}
+	slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if(slave < 0 || tcgetattr(slave, &raw) != 0){
+		return -1;
+	}
+	// No line editing, echo or newline translation, the stream is binary
+	raw.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+	raw.c_oflag &= ~(tcflag_t)OPOST;
+	raw.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+	raw.c_cflag = (raw.c_cflag & ~(tcflag_t)(CSIZE | PARENB)) | CS8;
+	if(tcsetattr(slave, TCSANOW, &raw) != 0 || (output = fdopen(slave, "wb")) == NULL){
+		return -1;
+	}
+	setvbuf(output, NULL, _IONBF, 0);
+	recording = fopen(MIRROR_STREAM, "wb");
+	if(recording == NULL){
+		return -1;
+	}
+	mirrorDecoderInitialize(&decoder, rebuilt);
+	mirrorSetOutput(output);
+	return pthread_create(&viewer, NULL, viewerTask, NULL);
+}
+
+/**
+  * @brief Streams one frame and waits until the viewer has decoded it.
+  * @param None.
+  * @returns Bytes of the frame.
+  */
+static uint32_t streamFrame(void){
+	uint32_t bytes = mirrorFrame();
+
+	sentFrames++;
+	sentBytes += bytes;
+	if(bytes > largestFrame){
+		largestFrame = bytes;
+	}
+	pthread_mutex_lock(&lock);
+	while(decodedFrames < sentFrames){
+		pthread_cond_wait(&decoded, &lock);
+	}
+	pthread_mutex_unlock(&lock);
+	return bytes;
+}
+
+/**
+  * @brief Streams frames until no tile is dirty, then compares the rebuilt screen with the frame buffer.
+  * @param name Name of the screen, for the message.
+  * @returns Void.
+  */
+static void checkRebuilt(const char* name){
+	const uint16_t* frame = glcdSoftFrameBuffer();
+	uint32_t differences = 0;
+	uint32_t frames = 0;
+	uint32_t i;
+
+	while(mirrorDirtyTiles() > 0){
+		streamFrame();
+		frames++;
+	}
+	pthread_mutex_lock(&lock);
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		differences += rebuilt[i] != frame[i];
+	}
+	pthread_mutex_unlock(&lock);
+	printf("%s: %u frames to send, ", name, (unsigned int)frames);
+	if(differences != 0){
+		printf("%u pixels differ\n", (unsigned int)differences);
+		failures++;
+		return;
+	}
+	printf("rebuilt\n");
+}
+
+/**
+  * @brief Runs the firmware for a while and checks the screen it ends up on.
+  * @param millisec Time to run.
+  * @param expected The screen that should be shown.
+  * @param name Name of the screen, for the message.
+  * @returns Void.
+  */
+static void checkScreen(uint32_t millisec, enum screen expected, const char* name){
+	halSoftRun(millisec);
+	if(screenCurrent() != expected){
+		printf("FAIL %s: screen %d shown\n", name, (int)screenCurrent());
+		failures++;
+	}
+	checkRebuilt(name);
+}
+
+/**
+  * @brief Thread function playing the test.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	uint32_t bytes;
+	uint32_t rate;
+	int frame;
+
+	if(openTerminal() != 0){
+		perror("pseudo-terminal");
+		exit(1);
+	}
+	checkScreen(300, Home, "home");
+	for(frame = 0; frame < ANIMATED_FRAMES; frame++){
+		halSoftRun(MIRROR_FRAME_MS);
+		streamFrame();
+	}
+	checkRebuilt("home animated");
+	postTouchEvent(TouchDown, START_X, START_Y);
+	postTouchEvent(TouchUp, START_X, START_Y);
+	checkScreen(300, Game, "game");
+	halSoftSetAdc(HAL_SOFT_LIGHT_CHANNEL, HAL_SOFT_LIGHT_OPEN);
+	checkScreen(500, Error, "error");
+
+	// Nothing is drawn between these frames
+	bytes = streamFrame();
+	check(bytes <= MIRROR_REFRESH_TILES * MAX_MESSAGE + MIRROR_HEADER_SIZE,
+			"an unchanged screen only sends refresh tiles");
+
+	rate = (uint32_t)(sentBytes * 1000 / ((uint64_t)sentFrames * MIRROR_FRAME_MS));
+	printf("%u frames, %llu bytes, largest frame %u of %u, %u bytes a second of %u\n", (unsigned int)sentFrames,
+			(unsigned long long)sentBytes, (unsigned int)largestFrame, (unsigned int)FRAME_BYTES,
+			(unsigned int)rate, (unsigned int)MIRROR_BYTES_PER_SECOND);
+	check(largestFrame <= FRAME_BYTES, "every frame fits its budget");
+	check(rate <= MIRROR_BYTES_PER_SECOND, "the stream stays within MIRROR_BYTES_PER_SECOND");
+	pthread_mutex_lock(&lock);
+	check(received == sentBytes, "the viewer received every byte");
+	check(decoder.errors == 0, "the viewer decoded every message");
+	fflush(recording);
+	pthread_mutex_unlock(&lock);
+	check(glcdSoftWritePPM(MIRROR_SCREEN) == 0, "the last screen is written");
+
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		exit(1);
+	}
+	printf("PASS\n");
+	exit(0);
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the script with the kernel.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osThreadCreate(osThread(scriptTask), NULL);
+}
@@ -0,0 +1,238 @@
+/**
+  * @file pool_test.c
+  * @brief Checks pool.c: owner tags, double and foreign frees, fallback to a larger pool, failure counts and
+  *        high-water marks, then a seeded stress run of random allocations and frees that checks alignment,
+  *        the pool usage and that no block overlaps another. Then prints the time of an allocate and free pair
+  *        against malloc and free. The speed is for information, it does not fail the test.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pool.h"
+
+/**
+  * @brief Allocations and frees of the stress run.
+  */
+#define POOL_STRESS_STEPS 1000000
+
+/**
+  * @brief Blocks the pools hold in all.
+  */
+#define POOL_TOTAL_BLOCKS (POOL_SMALL_BLOCKS + POOL_MEDIUM_BLOCKS + POOL_LARGE_BLOCKS)
+
+/**
+  * @brief Allocate and free pairs timed.
+  */
+#define POOL_TIMED 10000000
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief State of the generator picking the stress steps, a linear congruential generator.
+  */
+static uint32_t seed = 12345;
+
+/**
+  * @brief A struct containing a block the stress run holds: where it is, its size and the byte it is filled with.
+  */
+typedef struct{
+	uint8_t* block;
+	uint32_t size;
+	uint8_t fill;
+	}heldBlock;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Returns the next stress step choice.
+  * @param None.
+  * @returns 24 random bits.
+  */
+static uint32_t nextRandom(void){
+	seed = seed * 1664525u + 1013904223u;
+	return seed >> 8;
+}
+
+/**
+  * @brief Reads the usage of a pool.
+  * @param id The pool.
+  * @returns Blocks in use.
+  */
+static uint32_t used(enum poolId id){
+	poolStats stats;
+	poolGetStats(id, &stats);
+	return stats.used;
+}
+
+/**
+  * @brief Checks tags, bad frees, the fallback and the usage counts.
+  * @param None.
+  * @returns Void.
+  */
+static void checkBasics(void){
+	void* small[POOL_SMALL_BLOCKS];
+	poolStats stats;
+	uint64_t notABlock;
+	uint8_t* block;
+	void* spill;
+	int i;
+
+	poolsInitialize();
+	block = poolAlloc(10, POOL_TAG('T', 'E', 'S', 'T'));
+	check(block != NULL && poolOwner(block) == POOL_TAG('T', 'E', 'S', 'T'), "owner tag");
+	check(poolFree(block + 8) == -1, "a pointer inside a block is refused");
+	check(poolFree(&notABlock) == -1, "a foreign pointer is refused");
+	check(poolFree(block) == 0 && poolOwner(block) == POOL_TAG_FREE, "free clears the tag");
+	check(poolFree(block) == -1, "a double free is refused");
+	check(poolFree(NULL) == 0, "NULL is ignored");
+	check(poolAlloc(POOL_LARGE_SIZE + 1, 1) == NULL, "too large fails");
+	poolGetStats(PoolLarge, &stats);
+	check(stats.failures == 1, "too large is counted");
+
+	poolsInitialize();
+	for(i = 0; i < POOL_SMALL_BLOCKS; i++){
+		small[i] = poolAlloc(POOL_SMALL_SIZE, 1);
+	}
+	check(used(PoolSmall) == POOL_SMALL_BLOCKS, "small pool full");
+	spill = poolAlloc(1, 1);
+	poolGetStats(PoolSmall, &stats);
+	check(spill != NULL && used(PoolMedium) == 1 && stats.failures == 1, "full small pool falls back to medium");
+	for(i = 0; i < POOL_SMALL_BLOCKS; i++){
+		poolFree(small[i]);
+	}
+	poolFree(spill);
+	poolGetStats(PoolSmall, &stats);
+	check(stats.used == 0 && stats.highWater == POOL_SMALL_BLOCKS, "high-water mark stays");
+	poolGetStats((enum poolId)PoolCount, &stats);
+	check(stats.blocks == 0, "unknown pool reads as empty");
+}
+
+/**
+  * @brief Allocates and frees blocks of random sizes, filling each block and checking the fill when it is freed.
+  * @param None.
+  * @returns Void.
+  */
+static void checkStress(void){
+	heldBlock held[POOL_TOTAL_BLOCKS];
+	int count = 0;
+	int step;
+	int i;
+	uint32_t size;
+	uint32_t total;
+	uint8_t* block;
+	int intact = 1;
+	int aligned = 1;
+	int counted = 1;
+	int refused = 1;
+
+	poolsInitialize();
+	for(step = 0; step < POOL_STRESS_STEPS; step++){
+		if(count == 0 || (count < POOL_TOTAL_BLOCKS && (nextRandom() & 1))){
+			size = 1 + nextRandom() % POOL_LARGE_SIZE;
+			block = poolAlloc(size, POOL_TAG('S', 'T', 'R', 'S'));
+			if(block == NULL){
+				// Only refused when every pool that fits is full
+				refused &= (size > POOL_MEDIUM_SIZE || used(PoolMedium) == POOL_MEDIUM_BLOCKS)
+						&& (size > POOL_SMALL_SIZE || used(PoolSmall) == POOL_SMALL_BLOCKS)
+						&& used(PoolLarge) == POOL_LARGE_BLOCKS;
+				continue;
+			}
+			aligned &= ((uintptr_t)block & 7) == 0;
+			held[count].block = block;
+			held[count].size = size;
+			held[count].fill = (uint8_t)step;
+			memset(block, held[count].fill, size);
+			count++;
+		}else{
+			i = nextRandom() % count;
+			for(size = 0; size < held[i].size; size++){
+				intact &= held[i].block[size] == held[i].fill;
+			}
+			poolFree(held[i].block);
+			held[i] = held[--count];
+		}
+		total = used(PoolSmall) + used(PoolMedium) + used(PoolLarge);
+		counted &= total == (uint32_t)count;
+	}
+	check(aligned, "blocks are 8-byte aligned");
+	check(intact, "no block overlaps another");
+	check(counted, "usage matches the blocks held");
+	check(refused, "refused only when full");
+}
+
+/**
+  * @brief Reads the monotonic clock.
+  * @param None.
+  * @returns Nanoseconds.
+  */
+static uint64_t nanos(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief Times allocate and free pairs from the pools and from the heap.
+  * @param None.
+  * @returns Void.
+  */
+static void timeAlloc(void){
+	void* volatile block;
+	uint64_t start;
+	uint64_t poolTime;
+	uint64_t mallocTime;
+	uint32_t i;
+
+	poolsInitialize();
+	start = nanos();
+	for(i = 0; i < POOL_TIMED; i++){
+		block = poolAlloc(48, 1);
+		poolFree(block);
+	}
+	poolTime = nanos() - start;
+	start = nanos();
+	for(i = 0; i < POOL_TIMED; i++){
+		block = malloc(48);
+		free(block);
+	}
+	mallocTime = nanos() - start;
+	printf("poolAlloc/poolFree %.1f ns, malloc/free %.1f ns\n", (double)poolTime / POOL_TIMED,
+			(double)mallocTime / POOL_TIMED);
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	checkBasics();
+	checkStress();
+	timeAlloc();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,213 @@
+/**
+  * @file prng_test.c
+  * @brief Checks prng.c: the same seed gives the same sequence and the streams differ, prngBelow is uniform by a
+  *        chi-square test over 100 buckets and every output bit is set about half the time, and prngFill writes
+  *        what repeated prngBelow calls return. Then prints how much faster prngFill is than rand() % n.
+  *        The speed is for information, it does not fail the test.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "prng.h"
+
+/**
+  * @brief Draws of the chi-square and bit balance checks.
+  */
+#define PRNG_DRAWS 1000000
+
+/**
+  * @brief Buckets of the chi-square check.
+  */
+#define PRNG_BUCKETS 100
+
+/**
+  * @brief Chi-square above which 99 degrees of freedom fail, the 0.1% critical value.
+  */
+#define PRNG_CHI_LIMIT 148.2
+
+/**
+  * @brief Largest difference from half of PRNG_DRAWS allowed in the count of one bit, six standard deviations.
+  */
+#define PRNG_BIT_LIMIT 3000
+
+/**
+  * @brief Values filled per batch in the speed comparison, as many as drawBackground fills.
+  */
+#define PRNG_BATCH 100
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Checks that a seed repeats its sequence, that another seed does not, and that the streams differ.
+  * @param None.
+  * @returns Void.
+  */
+static void checkSeeding(void){
+	prngState a;
+	prngState b;
+	int same = 1;
+	int different = 0;
+	int i;
+
+	prngSeed(&a, 1234);
+	prngSeed(&b, 1234);
+	for(i = 0; i < 1000; i++){
+		same &= prngNext(&a) == prngNext(&b);
+	}
+	check(same, "same seed, same sequence");
+	prngSeed(&b, 1235);
+	for(i = 0; i < 1000; i++){
+		different += prngNext(&a) != prngNext(&b);
+	}
+	check(different > 990, "different seeds, different sequences");
+	prngSeedAll(PRNG_DEFAULT_SEED);
+	check(prngNext(prngStream(PrngBackground)) != prngNext(prngStream(PrngStarfield))
+			&& prngNext(prngStream(PrngStarfield)) != prngNext(prngStream(PrngTrace)), "streams differ");
+	prngSeed(&a, 0);
+	check((a.s[0] | a.s[1] | a.s[2] | a.s[3]) != 0 && prngNext(&a) != prngNext(&a), "seed 0 is not stuck");
+}
+
+/**
+  * @brief Runs the chi-square test of prngBelow and counts each output bit.
+  * @param None.
+  * @returns Void.
+  */
+static void checkDistribution(void){
+	static uint32_t buckets[PRNG_BUCKETS];
+	uint32_t bits[32] = {0};
+	prngState state;
+	double expected = (double)PRNG_DRAWS / PRNG_BUCKETS;
+	double chi = 0;
+	uint32_t value;
+	int worst = 0;
+	int i;
+	int bit;
+
+	prngSeed(&state, PRNG_DEFAULT_SEED);
+	for(i = 0; i < PRNG_DRAWS; i++){
+		buckets[prngBelow(&state, PRNG_BUCKETS)]++;
+		value = prngNext(&state);
+		for(bit = 0; bit < 32; bit++){
+			bits[bit] += (value >> bit) & 1;
+		}
+	}
+	for(i = 0; i < PRNG_BUCKETS; i++){
+		chi += (buckets[i] - expected) * (buckets[i] - expected) / expected;
+	}
+	for(bit = 0; bit < 32; bit++){
+		if(abs((int)bits[bit] - PRNG_DRAWS / 2) > worst){
+			worst = abs((int)bits[bit] - PRNG_DRAWS / 2);
+		}
+	}
+	printf("chi-square %.1f over %d buckets, worst bit %d from half\n", chi, PRNG_BUCKETS, worst);
+	check(chi < PRNG_CHI_LIMIT, "prngBelow is uniform");
+	check(worst < PRNG_BIT_LIMIT, "bits are balanced");
+	check(prngBelow(&state, 0) == 0, "prngBelow of 0 is 0");
+}
+
+/**
+  * @brief Checks that prngFill writes what prngBelow returns and leaves the generator in the same state.
+  * @param None.
+  * @returns Void.
+  */
+static void checkFill(void){
+	uint16_t filled[1000];
+	prngState a;
+	prngState b;
+	int same = 1;
+	int i;
+
+	prngSeed(&a, 42);
+	prngSeed(&b, 42);
+	prngFill(&a, filled, 1000, 20, 440);
+	for(i = 0; i < 1000; i++){
+		same &= filled[i] == 20 + prngBelow(&b, 440);
+	}
+	check(same, "prngFill matches prngBelow");
+	check(prngNext(&a) == prngNext(&b), "prngFill stores the state");
+}
+
+/**
+  * @brief Reads the monotonic clock.
+  * @param None.
+  * @returns Nanoseconds.
+  */
+static uint64_t nanos(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief Times filling star positions with prngFill and with rand() % n.
+  * @param None.
+  * @returns Void.
+  */
+static void timeFill(void){
+	static uint16_t out[PRNG_BATCH];
+	volatile uint16_t sink = 0;
+	prngState state;
+	uint64_t start;
+	uint64_t randTime;
+	uint64_t fillTime;
+	int batch;
+	int i;
+
+	srand(1);
+	start = nanos();
+	for(batch = 0; batch < PRNG_DRAWS / PRNG_BATCH; batch++){
+		for(i = 0; i < PRNG_BATCH; i++){
+			out[i] = (uint16_t)(20 + rand() % 440);
+		}
+		sink ^= out[batch % PRNG_BATCH];
+	}
+	randTime = nanos() - start;
+	prngSeed(&state, 1);
+	start = nanos();
+	for(batch = 0; batch < PRNG_DRAWS / PRNG_BATCH; batch++){
+		prngFill(&state, out, PRNG_BATCH, 20, 440);
+		sink ^= out[batch % PRNG_BATCH];
+	}
+	fillTime = nanos() - start;
+	printf("rand() %% n %.2f ns, prngFill %.2f ns a value, %.1fx faster\n", (double)randTime / PRNG_DRAWS,
+			(double)fillTime / PRNG_DRAWS, (double)randTime / (double)fillTime);
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	checkSeeding();
+	checkDistribution();
+	checkFill();
+	timeFill();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,165 @@
+/**
+  * @file sim_bench.c
+  * @brief Plays a long seeded session on the host kernel in virtual time and reports how fast it simulated.
+  *        The session starts a game, then for SIM_ROUNDS rounds presses random flippers and swings the IR
+  *        sensors to score, and finally opens the lid. What the run did goes to stdout: the time simulated,
+  *        switches, time jumps, the thread loads and a hash of the final screen. Two runs must print the same,
+  *        which `make check` verifies. The real time taken and simulated seconds per real second go to stderr.
+  *        Each firmware thread is charged a modelled cost per run, so the loads share out the CPU; they must add
+  *        up to 100 %, less the rounding, and idle must not have it all.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cmsis_os_soft.h"
+#include "hal_soft.h"
+#include "GLCD_Config.h"
+#include "glcd_soft.h"
+#include "screens.h"
+#include "events.h"
+#include "trace.h"
+
+/**
+  * @brief Rounds of play, each lasting 800 to 1200 ms.
+  */
+#define SIM_ROUNDS 60
+
+/**
+  * @brief Seed of the session's inputs.
+  */
+#define SIM_SEED 12345
+
+/**
+  * @brief Modelled cost of a run of each firmware thread in microseconds: main draws a frame of the screen,
+  *        analog converts and filters the sensors, a player thread moves its servo. The other threads keep
+  *        OS_SOFT_RUN_COST_US, and the script stands for no work of the firmware.
+  */
+#define SIM_MAIN_COST_US 5000
+#define SIM_ANALOG_COST_US 300
+#define SIM_PLAYER_COST_US 200
+
+/**
+  * @brief The firmware threads of main.c.
+  */
+extern osThreadId player1Paddles;
+extern osThreadId player2Paddles;
+extern osThreadId analogThread;
+
+/**
+  * @brief State of the generator picking the inputs, a linear congruential generator so the
+  *        session does not draw from the firmware's own PRNG streams.
+  */
+static uint32_t seed = SIM_SEED;
+
+/**
+  * @brief Returns the next input choice.
+  * @param None.
+  * @returns 24 random bits.
+  */
+static uint32_t nextRandom(void){
+	seed = seed * 1664525u + 1013904223u;
+	return seed >> 8;
+}
+
+/**
+  * @brief Hashes the frame buffer with FNV-1a.
+  * @param None.
+  * @returns The hash.
+  */
+static uint64_t frameHash(void){
+	const uint16_t* frame = glcdSoftFrameBuffer();
+	uint64_t hash = 1469598103934665603ULL;
+	uint32_t i;
+
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		hash ^= frame[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+  * @brief Prints the results and ends the run.
+  * @param None.
+  * @returns Void.
+  */
+static void finish(void){
+	osSoftStats stats;
+	traceLoad loads[TRACE_THREADS];
+	uint32_t percent = 0;
+	uint64_t total = 0;
+	bool passed;
+	int count;
+	int i;
+
+	osSoftGetStats(&stats);
+	count = traceGetLoads(loads, TRACE_THREADS);
+	printf("screen %d simulated %u ms switches %u jumps %u hash %016llx\n", (int)screenCurrent(),
+			(unsigned int)stats.simulatedMillis, (unsigned int)stats.switches, (unsigned int)stats.jumps,
+			(unsigned long long)frameHash());
+	for(i = 0; i < count; i++){
+		percent += loads[i].loadPercent;
+		total += loads[i].totalMicros;
+	}
+	for(i = 0; i < count; i++){
+		// In tenths of a percent of the run, the lighter threads are well under one
+		uint32_t share = (total != 0) ? (uint32_t)(loads[i].totalMicros * 1000 / total) : 0;
+		printf("load %-8s %3u.%u%%\n", (loads[i].name != NULL) ? loads[i].name : "?", (unsigned int)(share / 10),
+				(unsigned int)(share % 10));
+	}
+	// Each load is rounded down, by less than a percent; the kernel names idle first
+	passed = percent <= 100 && percent + count >= 100 && loads[0].loadPercent < 100;
+	if(!passed){
+		printf("FAIL loads add up to %u%%, idle %u%%\n", (unsigned int)percent, (unsigned int)loads[0].loadPercent);
+	}
+	fprintf(stderr, "real %u ms, %u simulated seconds per real second\n",
+			(unsigned int)stats.realMillis, (unsigned int)stats.simulatedPerReal);
+	fflush(stdout);
+	exit(screenCurrent() == Error && passed ? 0 : 1);
+}
+
+/**
+  * @brief Thread function playing the session.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	int round;
+
+	traceName(osThreadGetId(), "script");
+	osSoftSetRunCost(osThreadGetId(), 0);
+	halSoftRun(300);
+	postTouchEvent(TouchDown, 235, 175);
+	postTouchEvent(TouchUp, 235, 175);
+	for(round = 0; round < SIM_ROUNDS; round++){
+		GPIOC->IDR = (nextRandom() & 1) ? GPIO_PIN_6 : 0;
+		GPIOG->IDR = (nextRandom() & 1) ? GPIO_PIN_6 : 0;
+		halSoftSetAdc(HAL_SOFT_PLAYER1_CHANNEL, (nextRandom() & 1) ? HAL_SOFT_IR_IDLE - 100 : HAL_SOFT_IR_IDLE);
+		halSoftSetAdc(HAL_SOFT_PLAYER2_CHANNEL, (nextRandom() & 1) ? HAL_SOFT_IR_IDLE + 100 : HAL_SOFT_IR_IDLE);
+		halSoftRun(800 + nextRandom() % 400);
+	}
+	halSoftSetAdc(HAL_SOFT_LIGHT_CHANNEL, HAL_SOFT_LIGHT_OPEN);
+	halSoftRun(1000);
+	finish();
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the script with the kernel, and gives the firmware threads their costs. Called on the main thread.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osSoftSetRunCost(osThreadGetId(), SIM_MAIN_COST_US);
+	osSoftSetRunCost(analogThread, SIM_ANALOG_COST_US);
+	osSoftSetRunCost(player1Paddles, SIM_PLAYER_COST_US);
+	osSoftSetRunCost(player2Paddles, SIM_PLAYER_COST_US);
+	osThreadCreate(osThread(scriptTask), NULL);
+}
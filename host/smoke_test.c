@@ -0,0 +1,86 @@
+/**
+  * @file smoke_test.c
+  * @brief Boots the whole firmware on the host and plays a short game: touches START GAME on the home screen,
+  *        then opens the lid during the game and closes it again. Checks the screen shown after each step.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cmsis_os_soft.h"
+#include "hal_soft.h"
+#include "screens.h"
+#include "events.h"
+#include "trace.h"
+
+/**
+  * @brief Centre of the START GAME button of the home screen.
+  */
+#define START_X 235
+#define START_Y 175
+
+/**
+  * @brief File the thread trace of the run is written to, for trace2json. Relative to host/, where make runs the test.
+  */
+#define SMOKE_TRACE "build/smoke_trace.csv"
+
+/**
+  * @brief Names of the screens, indexed by enum screen.
+  */
+static const char* const screenNames[] = {"Home", "Game", "Error"};
+
+/**
+  * @brief Runs the firmware for a while and checks the screen it ends up on. Exits the test if it is wrong.
+  * @param millisec Time to run.
+  * @param expected The screen that should be shown.
+  * @returns Void.
+  */
+static void expectScreen(uint32_t millisec, enum screen expected){
+	halSoftRun(millisec);
+	printf("%6u ms %s\n", (unsigned int)os_time, screenNames[screenCurrent()]);
+	if(screenCurrent() != expected){
+		printf("FAIL expected %s\n", screenNames[expected]);
+		exit(1);
+	}
+}
+
+/**
+  * @brief Thread function playing the test.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	FILE* trace;
+
+	expectScreen(300, Home);
+	postTouchEvent(TouchDown, START_X, START_Y);
+	postTouchEvent(TouchUp, START_X, START_Y);
+	expectScreen(300, Game);
+	halSoftSetAdc(HAL_SOFT_LIGHT_CHANNEL, HAL_SOFT_LIGHT_OPEN);
+	expectScreen(500, Error);
+	halSoftSetAdc(HAL_SOFT_LIGHT_CHANNEL, HAL_SOFT_LIGHT_CLOSED);
+	expectScreen(500, Game);
+	trace = fopen(SMOKE_TRACE, "w");
+	if(trace != NULL){
+		traceWriteCSV(trace);
+		fclose(trace);
+	}
+	printf("PASS\n");
+	exit(0);
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the script with the kernel.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osThreadCreate(osThread(scriptTask), NULL);
+}
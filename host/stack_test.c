@@ -0,0 +1,192 @@
+/**
+  * @file stack_test.c
+  * @brief Boots the whole firmware on the host, where cmsis_os_soft.c paints every thread stack it creates,
+  *        and checks the report of stack_watch.c. The script thread watches its own stack and uses a known
+  *        amount of it, which the peak must cover without counting much more. A painted buffer with its
+  *        canary overwritten must be reported as overflowed. The report is written to build/stack_report.csv,
+  *        read back, and must list the firmware threads with peaks inside their stacks and the suggested size
+  *        stackWatchSuggest gives for each peak.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cmsis_os_soft.h"
+#include "hal_soft.h"
+#include "stack_watch.h"
+
+/**
+  * @brief Bytes of stack the script uses on purpose, and how far above it the peak may be:
+  *        the frames of the script and of the calls it makes.
+  */
+#define STACK_TEST_BYTES (16 * 1024)
+#define STACK_TEST_SLACK (4 * 1024)
+
+/**
+  * @brief The report, relative to host/, where make runs the test.
+  */
+#define STACK_REPORT "build/stack_report.csv"
+
+/**
+  * @brief Threads of the firmware that watch their own stacks.
+  */
+static const char* const firmwareThreads[] = {"player1", "player2", "analog", "touch"};
+
+/**
+  * @brief A stack that is never run on, painted and then overflowed by hand.
+  */
+static uint32_t overflowed[256];
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Writes to STACK_TEST_BYTES of stack, as a thread that needs that much would.
+  *        Not inlined, so the buffer is in a frame of its own below the caller's.
+  * @param seed Written to the buffer, so it is not optimised away.
+  * @returns A sum of the buffer.
+  */
+static __attribute__((noinline)) uint32_t useStack(uint32_t seed){
+	volatile uint8_t buffer[STACK_TEST_BYTES];
+	uint32_t sum = 0;
+	uint32_t i;
+
+	for(i = 0; i < sizeof(buffer); i++){
+		buffer[i] = (uint8_t)(seed + i);
+	}
+	for(i = 0; i < sizeof(buffer); i += 64){
+		sum += buffer[i];
+	}
+	return sum;
+}
+
+/**
+  * @brief Reads the report back and checks every line of it.
+  * @param None.
+  * @returns Number of lines read.
+  */
+static int checkReport(void){
+	char line[128];
+	char name[32];
+	unsigned int size;
+	unsigned int peak;
+	unsigned int suggested;
+	int overflow;
+	int lines = 0;
+	int found[sizeof(firmwareThreads) / sizeof(firmwareThreads[0])] = {0};
+	unsigned int i;
+	FILE* in = fopen(STACK_REPORT, "r");
+
+	if(in == NULL){
+		check(0, "the report is written");
+		return 0;
+	}
+	check(fgets(line, sizeof(line), in) != NULL
+			&& strcmp(line, "thread,stack_bytes,peak_bytes,suggested_bytes,overflowed\n") == 0,
+			"the report header");
+	while(fgets(line, sizeof(line), in) != NULL){
+		if(sscanf(line, "%31[^,],%u,%u,%u,%d", name, &size, &peak, &suggested, &overflow) != 5){
+			printf("FAIL report line: %s", line);
+			failures++;
+			continue;
+		}
+		lines++;
+		check(suggested == stackWatchSuggest(peak), "each suggested size is the peak with its margin");
+		if(strcmp(name, "overflowed") == 0){
+			check(overflow == 1, "a changed canary is reported as an overflow");
+			continue;
+		}
+		check(overflow == 0, "no firmware stack overflowed");
+		check(peak > 0 && peak < size, "each peak lies inside its stack");
+		for(i = 0; i < sizeof(firmwareThreads) / sizeof(firmwareThreads[0]); i++){
+			found[i] |= strcmp(name, firmwareThreads[i]) == 0;
+		}
+		printf("%-10s %6u of %6u bytes, suggested %6u\n", name, peak, size, suggested);
+	}
+	fclose(in);
+	for(i = 0; i < sizeof(firmwareThreads) / sizeof(firmwareThreads[0]); i++){
+		if(!found[i]){
+			printf("FAIL %s is not in the report\n", firmwareThreads[i]);
+			failures++;
+		}
+	}
+	return lines;
+}
+
+/**
+  * @brief Thread function playing the test.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+static void scriptTask(void const* argument){
+	stackUsage usage;
+	uint32_t before;
+	int script = stackWatchAddCurrent("script", STACK_WATCH_DEFAULT_SIZE);
+	int lines;
+	FILE* out;
+
+	check(script >= 0, "the script finds its painted stack");
+	halSoftRun(1000);
+
+	stackWatchUsage(script, &usage);
+	before = usage.peak;
+	useStack(before);
+	stackWatchUsage(script, &usage);
+	printf("script peak %u bytes before, %u after using %u\n", (unsigned int)before, (unsigned int)usage.peak,
+			(unsigned int)STACK_TEST_BYTES);
+	check(usage.peak >= STACK_TEST_BYTES, "the peak covers the stack used");
+	check(usage.peak <= before + STACK_TEST_BYTES + STACK_TEST_SLACK, "the peak counts little beyond it");
+	check(!usage.overflowed, "the script stack did not overflow");
+
+	stackWatchPaint(overflowed, sizeof(overflowed));
+	stackWatchAdd("overflowed", overflowed, sizeof(overflowed));
+	overflowed[0] = 0;
+
+	out = fopen(STACK_REPORT, "w");
+	if(out == NULL){
+		perror(STACK_REPORT);
+		exit(1);
+	}
+	stackWatchWriteCSV(out);
+	fclose(out);
+	lines = checkReport();
+	check(lines == stackWatchCount(), "a report line for every watched stack");
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		exit(1);
+	}
+	printf("PASS\n");
+	exit(0);
+}
+
+/**
+  * @brief Defining thread configuration struct for the script thread.
+  */
+osThreadDef(scriptTask, osPriorityHigh, 1, 0);
+
+/**
+  * @brief Starts the script with the kernel.
+  * @param None.
+  * @returns Void.
+  */
+void osSoftStarting(void){
+	osThreadCreate(osThread(scriptTask), NULL);
+}
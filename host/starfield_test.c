@@ -0,0 +1,239 @@
+/**
+  * @file starfield_test.c
+  * @brief Checks starfield.c: runs the field from a fixed PrngStarfield seed twice and compares a hash of
+  *        the frame buffer after every frame, checks that no star lands in an excluded rectangle, then makes
+  *        every pixel write expensive and checks the quota frame by frame: an over-budget frame halves it, down
+  *        to an eighth of the stars, a frame under half the budget raises it, and once settled few frames run
+  *        over. The quota recovers once the pixels are cheap again. Built with GLCD_L8 the indexed frame buffer
+  *        is expanded through the palette before it is read.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+#include "glcd_soft.h"
+#include "layers.h"
+#include "prng.h"
+#include "starfield.h"
+
+/**
+  * @brief Frames of each run.
+  */
+#define FRAMES 600
+
+/**
+  * @brief Seed of the runs.
+  */
+#define SEED 2026
+
+/**
+  * @brief The rectangle kept free of stars, the START GAME button of the home screen.
+  */
+#define EXCLUDE_X 170
+#define EXCLUDE_Y 150
+#define EXCLUDE_WIDTH 130
+#define EXCLUDE_HEIGHT 50
+
+/**
+  * @brief Budget of a frame in modelled host cycles, as starfield.c works it out.
+  */
+#define BUDGET (STARFIELD_BUDGET_US * STARFIELD_HOST_MHZ)
+
+/**
+  * @brief Modelled cycles of a pixel write that let 60 pixels fit a frame. A star that moves writes two,
+  *        so moving every star is three times over budget.
+  */
+#define SLOW_PIXEL_CYCLES (BUDGET / 60)
+
+/**
+  * @brief Frames run with slow pixels, the first of them settling the quota.
+  */
+#define SLOW_FRAMES 200
+#define SETTLE_FRAMES 10
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Returns the pixels on the screen, expanding the indexed frame buffer first when built with GLCD_L8.
+  * @param None.
+  * @returns GLCD_WIDTH * GLCD_HEIGHT RGB565 pixels, row by row.
+  */
+static const uint16_t* screenPixels(void){
+#ifdef GLCD_L8
+	glcdL8ToRGB565(glcdSoftFrameBuffer());
+#endif
+	return glcdSoftFrameBuffer();
+}
+
+/**
+  * @brief Hashes the frame buffer into a running hash, FNV-1a over the pixels.
+  * @param hash The hash so far.
+  * @returns The new hash.
+  */
+static uint64_t hashFrame(uint64_t hash){
+	const uint16_t* pixel = screenPixels();
+	uint32_t i;
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		hash = (hash ^ pixel[i]) * 1099511628211u;
+	}
+	return hash;
+}
+
+/**
+  * @brief Checks that the excluded rectangle still has the background colour.
+  * @param None.
+  * @returns true if no star was drawn in it.
+  */
+static int excludeClear(void){
+	const uint16_t* pixel = screenPixels();
+	uint32_t x;
+	uint32_t y;
+	for(y = EXCLUDE_Y; y < EXCLUDE_Y + EXCLUDE_HEIGHT; y++){
+		for(x = EXCLUDE_X; x < EXCLUDE_X + EXCLUDE_WIDTH; x++){
+			if(pixel[y * GLCD_WIDTH + x] != LAYER_HUD_BACKGROUND){
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+/**
+  * @brief Clears the screen and starts a new field from a seed.
+  * @param seed Seed of the PrngStarfield stream.
+  * @returns Void.
+  */
+static void startField(uint32_t seed){
+	GLCD_SetBackgroundColor(LAYER_HUD_BACKGROUND);
+	GLCD_ClearScreen();
+	prngSeed(prngStream(PrngStarfield), seed);
+	starfieldSoftSetPixelCycles(STARFIELD_HOST_PIXEL_CYCLES);
+	starfieldReset();
+	starfieldExclude(EXCLUDE_X, EXCLUDE_Y, EXCLUDE_WIDTH, EXCLUDE_HEIGHT);
+}
+
+/**
+  * @brief Runs a field from a seed and hashes every frame.
+  * @param seed Seed of the PrngStarfield stream.
+  * @returns Hash of all the frames.
+  */
+static uint64_t runField(uint32_t seed){
+	uint64_t hash = 14695981039346656037u;
+	int clear = 1;
+	int frame;
+
+	startField(seed);
+	for(frame = 0; frame < FRAMES; frame++){
+		starfieldStep();
+		hash = hashFrame(hash);
+		clear &= excludeClear();
+	}
+	check(clear, "no star in the excluded rectangle");
+	return hash;
+}
+
+/**
+  * @brief Checks that the same seed draws the same frames and another seed does not.
+  * @param None.
+  * @returns Void.
+  */
+static void checkRepeatable(void){
+	uint64_t first = runField(SEED);
+	uint64_t second = runField(SEED);
+	uint64_t other = runField(SEED + 1);
+
+	printf("frames hash %016llx\n", (unsigned long long)first);
+	check(first == second, "same seed, same frames");
+	check(first != other, "different seed, different frames");
+}
+
+/**
+  * @brief Makes pixels expensive and checks how the field degrades and recovers.
+  * @param None.
+  * @returns Void.
+  */
+static void checkOverBudget(void){
+	uint32_t quota;
+	uint32_t expected;
+	uint32_t cost;
+	uint64_t before;
+	int moving = 1;
+	int followed = 1;
+	int over = 0;
+	int frame;
+
+	startField(SEED);
+	for(frame = 0; frame < 20; frame++){
+		starfieldStep();
+	}
+	check(starfieldQuota() == STARFIELD_STARS && starfieldLastCost() <= BUDGET, "every star moves within budget");
+
+	starfieldSoftSetPixelCycles(SLOW_PIXEL_CYCLES);
+	starfieldStep();
+	check(starfieldLastCost() > BUDGET, "slow pixels put the frame over budget");
+	check(starfieldQuota() == STARFIELD_STARS / 2, "an over-budget frame halves the stars moved");
+	for(frame = 0; frame < SLOW_FRAMES; frame++){
+		quota = starfieldQuota();
+		before = hashFrame(0);
+		starfieldStep();
+		moving &= hashFrame(0) != before;
+		cost = starfieldLastCost();
+		expected = quota;
+		if(cost > BUDGET){
+			expected = (quota / 2 > STARFIELD_STARS / 8) ? quota / 2 : STARFIELD_STARS / 8;
+			over += frame >= SETTLE_FRAMES;
+		}else if(cost < BUDGET / 2 && quota < STARFIELD_STARS){
+			expected = (quota + STARFIELD_STARS / 8 < STARFIELD_STARS) ? quota + STARFIELD_STARS / 8 : STARFIELD_STARS;
+		}
+		followed &= starfieldQuota() == expected;
+	}
+	printf("slow pixels: %u stars a frame, %d of %d frames over budget\n", (unsigned int)starfieldQuota(), over,
+			SLOW_FRAMES - SETTLE_FRAMES);
+	check(followed, "the quota follows the frame cost");
+	check(starfieldQuota() < STARFIELD_STARS, "fewer stars move while pixels are slow");
+	check(over * 10 < SLOW_FRAMES - SETTLE_FRAMES, "few settled frames run over budget");
+	check(moving, "the field keeps moving");
+
+	starfieldSoftSetPixelCycles(STARFIELD_HOST_PIXEL_CYCLES);
+	for(frame = 0; frame < 20; frame++){
+		starfieldStep();
+	}
+	check(starfieldQuota() == STARFIELD_STARS, "every star moves again once pixels are fast");
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	GLCD_Initialize();
+	checkRepeatable();
+	checkOverBudget();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,25 @@
+/**
+  * @file Board_GLCD.h
+  * @brief Target-path stand-in for the GLCD calls of the board support pack, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef BG
+#define BG
+#include <stdint.h>
+#include <stdbool.h>
+typedef struct { uint16_t width, height, offset, count; const uint8_t *bitmap; } GLCD_FONT;
+int32_t GLCD_Initialize(void); int32_t GLCD_Uninitialize(void);
+int32_t GLCD_SetForegroundColor(uint32_t c); int32_t GLCD_SetBackgroundColor(uint32_t c);
+int32_t GLCD_ClearScreen(void); int32_t GLCD_SetFont(GLCD_FONT *f);
+int32_t GLCD_DrawPixel(uint32_t x, uint32_t y); int32_t GLCD_DrawHLine(uint32_t x, uint32_t y, uint32_t l);
+int32_t GLCD_DrawVLine(uint32_t x, uint32_t y, uint32_t l); int32_t GLCD_DrawRectangle(uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+int32_t GLCD_DrawChar(uint32_t x, uint32_t y, int32_t ch); int32_t GLCD_DrawString(uint32_t x, uint32_t y, const char *s);
+int32_t GLCD_DrawBargraph(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint32_t v);
+int32_t GLCD_DrawBitmap(uint32_t x, uint32_t y, uint32_t w, uint32_t h, const uint8_t *b);
+int32_t GLCD_VScroll(uint32_t dy); int32_t GLCD_FrameBufferAccess(bool e); uint32_t GLCD_FrameBufferAddress(void);
+#endif
@@ -0,0 +1,11 @@
+/**
+  * @file Board_LED.h
+  * @brief Target-path stand-in for the LED calls of the board support pack, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+
@@ -0,0 +1,16 @@
+/**
+  * @file Board_Touch.h
+  * @brief Target-path stand-in for the touch controller calls of the board support pack, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef BT
+#define BT
+#include <stdint.h>
+typedef struct { uint8_t pressed; int16_t x; int16_t y; } TOUCH_STATE;
+int32_t Touch_Initialize(void); int32_t Touch_Uninitialize(void); int32_t Touch_GetState(TOUCH_STATE *s);
+#endif
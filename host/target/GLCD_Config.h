@@ -0,0 +1,20 @@
+/**
+  * @file GLCD_Config.h
+  * @brief Target-path stand-in for the display size and colours of the board support pack, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define GLCD_WIDTH 480
+#define GLCD_HEIGHT 272
+#define GLCD_COLOR_BLACK 0x0000
+#define GLCD_COLOR_WHITE 0xFFFF
+#define GLCD_COLOR_YELLOW 0xFFE0
+#define GLCD_COLOR_DARK_GREY 0x7BEF
+#define GLCD_COLOR_LIGHT_GREY 0xC618
+#define GLCD_COLOR_RED 0xF800
+#define GLCD_COLOR_GREEN 0x07E0
+#define GLCD_COLOR_BLUE 0x001F
@@ -0,0 +1,63 @@
+/**
+  * @file cmsis_os.h
+  * @brief Target-path stand-in for the CMSIS-RTOS v1 API of RTX, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef CMSIS_OS_STUB
+#define CMSIS_OS_STUB
+#include <stdint.h>
+#include <stddef.h>
+#define __RTX
+typedef enum { osPriorityIdle=-3, osPriorityLow=-2, osPriorityBelowNormal=-1, osPriorityNormal=0, osPriorityAboveNormal=1, osPriorityHigh=2, osPriorityRealtime=3, osPriorityError=0x84 } osPriority;
+typedef enum { osOK=0, osEventSignal=0x08, osEventMessage=0x10, osEventMail=0x20, osEventTimeout=0x40, osErrorParameter=0x80, osErrorResource=0x81, osErrorTimeoutResource=0xC1, osErrorISR=0x82, osErrorValue=0x86, osErrorNoMemory=0x85, osErrorOS=0xFF } osStatus;
+typedef enum { osTimerOnce=0, osTimerPeriodic=1 } os_timer_type;
+#define osWaitForever 0xFFFFFFFF
+#define osKernelSysTickFrequency 216000000
+typedef void (*os_pthread)(void const *argument);
+typedef void (*os_ptimer)(void const *argument);
+typedef struct os_thread_cb *osThreadId;
+typedef struct os_timer_cb *osTimerId;
+typedef struct os_mutex_cb *osMutexId;
+typedef struct os_semaphore_cb *osSemaphoreId;
+typedef struct os_pool_cb *osPoolId;
+typedef struct os_messageQ_cb *osMessageQId;
+typedef struct os_mailQ_cb *osMailQId;
+typedef struct os_thread_def { os_pthread pthread; osPriority tpriority; uint32_t instances; uint32_t stacksize; } osThreadDef_t;
+typedef struct os_timer_def { os_ptimer ptimer; void *timer; } osTimerDef_t;
+typedef struct os_mutex_def { void *mutex; } osMutexDef_t;
+typedef struct os_semaphore_def { void *semaphore; } osSemaphoreDef_t;
+typedef struct os_pool_def { uint32_t pool_sz; uint32_t item_sz; void *pool; } osPoolDef_t;
+typedef struct os_messageQ_def { uint32_t queue_sz; void *pool; } osMessageQDef_t;
+typedef struct os_mailQ_def { uint32_t queue_sz; uint32_t item_sz; void *pool; } osMailQDef_t;
+typedef struct { osStatus status; union { uint32_t v; void *p; int32_t signals; } value; union { osMailQId mail_id; osMessageQId message_id; } def; } osEvent;
+#define osThreadDef(name, priority, instances, stacksz) const osThreadDef_t os_thread_def_##name = { (name), (priority), (instances), (stacksz) }
+#define osThread(name) &os_thread_def_##name
+#define osTimerDef(name, function) uint32_t os_timer_cb_##name[6]; const osTimerDef_t os_timer_def_##name = { (function), ((void *)os_timer_cb_##name) }
+#define osTimer(name) &os_timer_def_##name
+#define osMutexDef(name) uint32_t os_mutex_cb_##name[4] = { 0 }; const osMutexDef_t os_mutex_def_##name = { (os_mutex_cb_##name) }
+#define osMutex(name) &os_mutex_def_##name
+#define osSemaphoreDef(name) uint32_t os_semaphore_cb_##name[2] = { 0 }; const osSemaphoreDef_t os_semaphore_def_##name = { (os_semaphore_cb_##name) }
+#define osSemaphore(name) &os_semaphore_def_##name
+#define osPoolDef(name, no, type) uint32_t os_pool_m_##name[3+((sizeof(type)+3)/4)*(no)]; const osPoolDef_t os_pool_def_##name = { (no), sizeof(type), (os_pool_m_##name) }
+#define osPool(name) &os_pool_def_##name
+#define osMessageQDef(name, queue_sz, type) uint32_t os_messageQ_q_##name[4+(queue_sz)] = { 0 }; const osMessageQDef_t os_messageQ_def_##name = { (queue_sz), ((void *)(os_messageQ_q_##name)) }
+#define osMessageQ(name) &os_messageQ_def_##name
+#define osMailQDef(name, queue_sz, type) uint32_t os_mailQ_q_##name[4+(queue_sz)] = { 0 }; uint32_t os_mailQ_m_##name[3+((sizeof(type)+3)/4)*(queue_sz)]; void *os_mailQ_p_##name[2] = { (os_mailQ_q_##name), os_mailQ_m_##name }; const osMailQDef_t os_mailQ_def_##name = { (queue_sz), sizeof(type), (os_mailQ_p_##name) }
+#define osMailQ(name) &os_mailQ_def_##name
+osStatus osKernelInitialize(void); osStatus osKernelStart(void); int32_t osKernelRunning(void); uint32_t osKernelSysTick(void);
+osThreadId osThreadCreate(const osThreadDef_t *d, void *a); osThreadId osThreadGetId(void); osStatus osThreadTerminate(osThreadId t); osStatus osThreadYield(void);
+osStatus osThreadSetPriority(osThreadId t, osPriority p); osPriority osThreadGetPriority(osThreadId t);
+osStatus osDelay(uint32_t ms); osEvent osWait(uint32_t ms);
+osTimerId osTimerCreate(const osTimerDef_t *d, os_timer_type t, void *a); osStatus osTimerStart(osTimerId t, uint32_t ms); osStatus osTimerStop(osTimerId t); osStatus osTimerDelete(osTimerId t);
+int32_t osSignalSet(osThreadId t, int32_t s); int32_t osSignalClear(osThreadId t, int32_t s); osEvent osSignalWait(int32_t s, uint32_t ms);
+osMutexId osMutexCreate(const osMutexDef_t *d); osStatus osMutexWait(osMutexId m, uint32_t ms); osStatus osMutexRelease(osMutexId m); osStatus osMutexDelete(osMutexId m);
+osSemaphoreId osSemaphoreCreate(const osSemaphoreDef_t *d, int32_t c); int32_t osSemaphoreWait(osSemaphoreId s, uint32_t ms); osStatus osSemaphoreRelease(osSemaphoreId s);
+osPoolId osPoolCreate(const osPoolDef_t *d); void *osPoolAlloc(osPoolId p); void *osPoolCAlloc(osPoolId p); osStatus osPoolFree(osPoolId p, void *b);
+osMessageQId osMessageCreate(const osMessageQDef_t *d, osThreadId t); osStatus osMessagePut(osMessageQId q, uint32_t info, uint32_t ms); osEvent osMessageGet(osMessageQId q, uint32_t ms);
+osMailQId osMailCreate(const osMailQDef_t *d, osThreadId t); void *osMailAlloc(osMailQId q, uint32_t ms); void *osMailCAlloc(osMailQId q, uint32_t ms); osStatus osMailPut(osMailQId q, void *m); osEvent osMailGet(osMailQId q, uint32_t ms); osStatus osMailFree(osMailQId q, void *m);
+#endif
@@ -0,0 +1,20 @@
+/**
+  * @file rl_usb.h
+  * @brief Target-path stand-in for the USB device calls of the MDK middleware, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef RL_USB_H
+#define RL_USB_H
+#include <stdint.h>
+#include <stdbool.h>
+typedef int usbStatus;
+usbStatus USBD_Initialize(uint8_t device);
+usbStatus USBD_Connect(uint8_t device);
+bool USBD_Configured(uint8_t device);
+int32_t USBD_CDC_ACM_WriteData(uint8_t instance, const uint8_t* buf, int32_t len);
+#endif
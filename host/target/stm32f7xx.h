@@ -0,0 +1,11 @@
+/**
+  * @file stm32f7xx.h
+  * @brief Target-path stand-in for the STM32F7 device header, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "stm32f7xx_hal.h"
@@ -0,0 +1,284 @@
+/**
+  * @file stm32f7xx_hal.h
+  * @brief Target-path stand-in for the STM32F7 HAL, the device registers and the CMSIS core functions, for `make target-check`.
+  *        Declares what the firmware uses at the addresses and sizes of the board, so the sources compile
+  *        without GLCD_SOFT; nothing here is meant to run.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef HAL_STUB
+#define HAL_STUB
+#include <stdint.h>
+#define __IO volatile
+#define __STATIC_INLINE static inline
+#define __WFI() do{}while(0)
+#define __DSB() do{}while(0)
+#define __ISB() do{}while(0)
+#define __NOP() do{}while(0)
+#define __disable_irq() do{}while(0)
+#define __enable_irq() do{}while(0)
+#define __get_PRIMASK() 0u
+#define __get_PSP() 0x20010000u
+#define __set_PRIMASK(x) ((void)(x))
+#define __get_IPSR() 0u
+#define __CLZ(x) ((uint32_t)__builtin_clz(x))
+#define __RBIT(x) (x)
+#define __LDREXW(p) (*(p))
+#define __STREXW(v,p) (*(p)=(v),0u)
+#define __DMB() do{}while(0)
+typedef enum { HAL_OK, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { RESET = 0, SET = 1 } FlagStatus;
+typedef enum { DISABLE = 0, ENABLE = 1 } FunctionalState;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+typedef struct { __IO uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2]; } GPIO_TypeDef;
+typedef struct { uint32_t Pin, Mode, Pull, Speed, Alternate; } GPIO_InitTypeDef;
+#define GPIOA ((GPIO_TypeDef*)0x40020000)
+#define GPIOB ((GPIO_TypeDef*)0x40020400)
+#define GPIOC ((GPIO_TypeDef*)0x40020800)
+#define GPIOD ((GPIO_TypeDef*)0x40020c00)
+#define GPIOE ((GPIO_TypeDef*)0x40021000)
+#define GPIOF ((GPIO_TypeDef*)0x40021400)
+#define GPIOG ((GPIO_TypeDef*)0x40021800)
+#define GPIOH ((GPIO_TypeDef*)0x40021c00)
+#define GPIOI ((GPIO_TypeDef*)0x40022000)
+#define GPIOJ ((GPIO_TypeDef*)0x40022400)
+#define GPIOK ((GPIO_TypeDef*)0x40022800)
+#define GPIO_PIN_0 0x0001u
+#define GPIO_PIN_1 0x0002u
+#define GPIO_PIN_2 0x0004u
+#define GPIO_PIN_3 0x0008u
+#define GPIO_PIN_4 0x0010u
+#define GPIO_PIN_5 0x0020u
+#define GPIO_PIN_6 0x0040u
+#define GPIO_PIN_7 0x0080u
+#define GPIO_PIN_8 0x0100u
+#define GPIO_PIN_10 0x0400u
+#define GPIO_PIN_13 0x2000u
+#define GPIO_MODE_INPUT 0
+#define GPIO_MODE_OUTPUT_PP 1
+#define GPIO_MODE_AF_PP 2
+#define GPIO_MODE_ANALOG 3
+#define GPIO_MODE_IT_FALLING 0x10210000u
+#define GPIO_MODE_IT_RISING 0x10110000u
+#define GPIO_NOPULL 0
+#define GPIO_PULLUP 1
+#define GPIO_PULLDOWN 2
+#define GPIO_SPEED_HIGH 2
+#define GPIO_SPEED_FREQ_LOW 0
+#define GPIO_AF2_TIM3 2
+#define GPIO_AF9_TIM12 9
+void HAL_GPIO_Init(GPIO_TypeDef *p, GPIO_InitTypeDef *i);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *p, uint16_t pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef *p, uint16_t pin, GPIO_PinState s);
+void HAL_GPIO_EXTI_IRQHandler(uint16_t pin);
+void HAL_GPIO_EXTI_Callback(uint16_t pin);
+typedef enum { SysTick_IRQn = -1, EXTI15_10_IRQn = 40, ADC_IRQn = 18, LTDC_IRQn = 88, DMA2D_IRQn = 90, TIM3_IRQn = 29, OTG_FS_IRQn = 67 } IRQn_Type;
+void HAL_NVIC_SetPriority(IRQn_Type n, uint32_t p, uint32_t s); void HAL_NVIC_EnableIRQ(IRQn_Type n); void HAL_NVIC_DisableIRQ(IRQn_Type n);
+HAL_StatusTypeDef HAL_Init(void); uint32_t HAL_GetTick(void); void HAL_Delay(uint32_t);
+typedef struct { __IO uint32_t CR1, CR2, SMCR, DIER, SR, EGR, CCMR1, CCMR2, CCER, CNT, PSC, ARR, RCR, CCR1, CCR2, CCR3, CCR4; } TIM_TypeDef;
+#define TIM2 ((TIM_TypeDef*)0x40000000)
+#define TIM3 ((TIM_TypeDef*)0x40000400)
+#define TIM12 ((TIM_TypeDef*)0x40001800)
+#define TIM1 ((TIM_TypeDef*)0x40010000)
+typedef struct { uint32_t Prescaler, CounterMode, Period, ClockDivision, RepetitionCounter, AutoReloadPreload; } TIM_Base_InitTypeDef;
+typedef struct { TIM_TypeDef *Instance; TIM_Base_InitTypeDef Init; } TIM_HandleTypeDef;
+typedef struct { uint32_t ClockSource, ClockPolarity, ClockPrescaler, ClockFilter; } TIM_ClockConfigTypeDef;
+typedef struct { uint32_t MasterOutputTrigger, MasterSlaveMode; } TIM_MasterConfigTypeDef;
+typedef struct { uint32_t OCMode, Pulse, OCPolarity, OCNPolarity, OCFastMode, OCIdleState, OCNIdleState; } TIM_OC_InitTypeDef;
+#define TIM_COUNTERMODE_UP 0
+#define TIM_CLOCKDIVISION_DIV1 0
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0
+#define TIM_CLOCKSOURCE_INTERNAL 0
+#define TIM_TRGO_RESET 0
+#define TIM_MASTERSLAVEMODE_DISABLE 0
+#define TIM_OCMODE_PWM1 0x60
+#define TIM_OCPOLARITY_HIGH 0
+#define TIM_OCFAST_DISABLE 0
+#define TIM_CHANNEL_1 0
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *h); HAL_StatusTypeDef HAL_TIM_ConfigClockSource(TIM_HandleTypeDef *h, TIM_ClockConfigTypeDef *c);
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *h); HAL_StatusTypeDef HAL_TIMEx_MasterConfigSynchronization(TIM_HandleTypeDef *h, TIM_MasterConfigTypeDef *c);
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *h, TIM_OC_InitTypeDef *c, uint32_t ch); HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *h, uint32_t ch);
+#define __HAL_TIM_SET_PRESCALER(h, v) ((h)->Instance->PSC = (v))
+#define __HAL_TIM_SET_AUTORELOAD(h, v) ((h)->Instance->ARR = (v))
+typedef struct { __IO uint32_t SR, CR1, CR2; } ADC_TypeDef;
+#define ADC3 ((ADC_TypeDef*)0x40012200)
+typedef struct { uint32_t ClockPrescaler, Resolution, DataAlign, ScanConvMode, EOCSelection, ContinuousConvMode, NbrOfConversion, DiscontinuousConvMode, NbrOfDiscConversion, ExternalTrigConv, ExternalTrigConvEdge, DMAContinuousRequests; } ADC_InitTypeDef;
+typedef struct { ADC_TypeDef *Instance; ADC_InitTypeDef Init; } ADC_HandleTypeDef;
+typedef struct { uint32_t Channel, Rank, SamplingTime, Offset; } ADC_ChannelConfTypeDef;
+#define ADC_CHANNEL_0 0
+#define ADC_CHANNEL_6 6
+#define ADC_CHANNEL_8 8
+#define ADC_REGULAR_RANK_1 1
+#define ADC_SAMPLETIME_480CYCLES 7
+#define ADC_CLOCKPRESCALER_PCLK_DIV2 0
+#define ADC_CLOCKPRESCALER_PCLK_DIV4 1
+#define ADC_RESOLUTION_12B 0
+#define ADC_EXTERNALTRIGCONVEDGE_NONE 0
+#define ADC_EXTERNALTRIGCONV_T1_CC1 0
+#define ADC_DATAALIGN_RIGHT 0
+HAL_StatusTypeDef HAL_ADC_Init(ADC_HandleTypeDef *h); HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef *h); HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef *h);
+HAL_StatusTypeDef HAL_ADC_ConfigChannel(ADC_HandleTypeDef *h, ADC_ChannelConfTypeDef *c); HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef *h, uint32_t t); uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef *h);
+typedef struct { uint32_t PLLState, PLLSource, PLLM, PLLN, PLLP, PLLQ; } RCC_PLLInitTypeDef;
+typedef struct { uint32_t OscillatorType, HSEState, LSEState, HSIState, HSICalibrationValue, LSIState; RCC_PLLInitTypeDef PLL; } RCC_OscInitTypeDef;
+typedef struct { uint32_t ClockType, SYSCLKSource, AHBCLKDivider, APB1CLKDivider, APB2CLKDivider; } RCC_ClkInitTypeDef;
+#define RCC_OSCILLATORTYPE_HSE 1
+#define RCC_OSCILLATORTYPE_HSI 2
+#define RCC_HSE_ON 1
+#define RCC_HSI_ON 1
+#define RCC_PLL_ON 2
+#define RCC_PLL_NONE 0
+#define RCC_PLLSOURCE_HSE 0x400000
+#define RCC_PLLP_DIV2 2
+#define RCC_PLLP_DIV4 4
+#define RCC_PLLP_DIV6 6
+#define RCC_PLLP_DIV8 8
+#define RCC_CLOCKTYPE_SYSCLK 1
+#define RCC_CLOCKTYPE_HCLK 2
+#define RCC_CLOCKTYPE_PCLK1 4
+#define RCC_CLOCKTYPE_PCLK2 8
+#define RCC_SYSCLKSOURCE_PLLCLK 2
+#define RCC_SYSCLKSOURCE_HSE 1
+#define RCC_SYSCLK_DIV1 0
+#define RCC_SYSCLK_DIV2 0x80
+#define RCC_HCLK_DIV1 0
+#define RCC_HCLK_DIV2 0x1000
+#define RCC_HCLK_DIV4 0x1400
+#define RCC_HCLK_DIV8 0x1800
+#define FLASH_LATENCY_0 0
+#define FLASH_LATENCY_1 1
+#define FLASH_LATENCY_2 2
+#define FLASH_LATENCY_3 3
+#define FLASH_LATENCY_4 4
+#define FLASH_LATENCY_5 5
+#define FLASH_LATENCY_6 6
+#define FLASH_LATENCY_7 7
+#define PWR_REGULATOR_VOLTAGE_SCALE1 0xC000
+#define PWR_REGULATOR_VOLTAGE_SCALE2 0x8000
+#define PWR_REGULATOR_VOLTAGE_SCALE3 0x4000
+HAL_StatusTypeDef HAL_RCC_OscConfig(RCC_OscInitTypeDef *o); HAL_StatusTypeDef HAL_RCC_ClockConfig(RCC_ClkInitTypeDef *c, uint32_t l);
+uint32_t HAL_RCC_GetSysClockFreq(void); uint32_t HAL_RCC_GetHCLKFreq(void); uint32_t HAL_RCC_GetPCLK1Freq(void); uint32_t HAL_RCC_GetPCLK2Freq(void);
+HAL_StatusTypeDef HAL_PWREx_EnableOverDrive(void); HAL_StatusTypeDef HAL_PWREx_DisableOverDrive(void);
+HAL_StatusTypeDef HAL_PWREx_ControlVoltageScaling(uint32_t s);
+extern uint32_t SystemCoreClock; void SystemCoreClockUpdate(void);
+#define __HAL_RCC_PWR_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM3_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_TIM12_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOA_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOB_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOC_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOG_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOH_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_GPIOI_CLK_ENABLE() do{}while(0)
+#define __HAL_RCC_DMA2D_CLK_ENABLE() do{}while(0)
+#define __GPIOA_CLK_ENABLE() do{}while(0)
+#define __GPIOF_CLK_ENABLE() do{}while(0)
+#define __ADC3_CLK_ENABLE() do{}while(0)
+#define __HAL_PWR_VOLTAGESCALING_CONFIG(x) ((void)(x))
+typedef struct { __IO uint32_t CR, ISR, IFCR, FGMAR, FGOR, BGMAR, BGOR, FGPFCCR, FGCOLR, BGPFCCR, BGCOLR, FGCMAR, BGCMAR, OPFCCR, OCOLR, OMAR, OOR, NLR, LWR, AMTCR; uint32_t r[236]; __IO uint32_t FGCLUT[256]; __IO uint32_t BGCLUT[256]; } DMA2D_TypeDef;
+#define DMA2D ((DMA2D_TypeDef*)0x4002b000)
+#define DMA2D_CR_START 1u
+#define DMA2D_CR_MODE_Pos 16u
+#define DMA2D_ISR_TCIF 2u
+#define DMA2D_IFCR_CTCIF 2u
+#define DMA2D_NLR_PL_Pos 16u
+#define DMA2D_FGPFCCR_CM_Pos 0
+#define DMA2D_FGPFCCR_AM_Pos 16
+#define DMA2D_FGPFCCR_ALPHA_Pos 24
+#define DMA2D_FGPFCCR_CS_Pos 8
+#define DMA2D_FGPFCCR_START (1u<<5)
+typedef struct { __IO uint32_t CR, WHPCR, WVPCR, CKCR, PFCR, CACR, DCCR, BFCR, r0[2], CFBAR, CFBLR, CFBLNR, r1[3], CLUTWR; } LTDC_Layer_TypeDef;
+typedef struct { __IO uint32_t SSCR, BPCR, AWCR, TWCR, GCR, r0[2], SRCR, r1, BCCR, r2, IER, ISR, ICR, LIPCR, CPSR, CDSR; } LTDC_TypeDef;
+#define LTDC ((LTDC_TypeDef*)0x40016800)
+#define LTDC_Layer1 ((LTDC_Layer_TypeDef*)0x40016884)
+#define LTDC_Layer2 ((LTDC_Layer_TypeDef*)0x40016904)
+#define LTDC_SRCR_IMR 1u
+#define LTDC_SRCR_VBR 2u
+#define LTDC_IER_LIE 1u
+#define LTDC_IER_RRIE 8u
+#define LTDC_ISR_LIF 1u
+#define LTDC_ICR_CLIF 1u
+#define LTDC_ICR_CRRIF 8u
+#define LTDC_LxCR_LEN 1u
+#define LTDC_LxCR_COLKEN 2u
+#define LTDC_LxCR_CLUTEN 0x10u
+#define LTDC_BPCR_AVBP_Msk 0x7FFu
+#define LTDC_BPCR_AHBP_Pos 16u
+#define LTDC_AWCR_AAH_Msk 0x7FFu
+#define LTDC_AWCR_AAH LTDC_AWCR_AAH_Msk
+typedef struct { __IO uint32_t CPUID, ICSR, VTOR, AIRCR, SCR, CCR; __IO uint8_t SHPR[12]; __IO uint32_t SHCSR, CFSR, HFSR, DFSR, MMFAR, BFAR, AFSR; } SCB_Type;
+#define SCB ((SCB_Type*)0xe000ed00)
+#define SCB_CCR_IC_Msk (1u<<17)
+#define SCB_CCR_DC_Msk (1u<<16)
+#define SCB_SCR_SLEEPDEEP_Msk 4u
+void SCB_EnableICache(void); void SCB_DisableICache(void); void SCB_EnableDCache(void); void SCB_DisableDCache(void);
+void SCB_CleanDCache_by_Addr(uint32_t *a, int32_t s); void SCB_InvalidateDCache_by_Addr(uint32_t *a, int32_t s); void SCB_CleanInvalidateDCache_by_Addr(uint32_t *a, int32_t s);
+void SCB_CleanDCache(void); void SCB_InvalidateDCache(void);
+typedef struct { __IO uint32_t CTRL, CYCCNT; } DWT_Type;
+#define DWT ((DWT_Type*)0xe0001000)
+#define DWT_CTRL_CYCCNTENA_Msk 1u
+typedef struct { __IO uint32_t DHCSR, DCRSR, DCRDR, DEMCR; } CoreDebug_Type;
+#define CoreDebug ((CoreDebug_Type*)0xe000edf0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1u<<24)
+typedef struct { __IO uint32_t LAR; } ITM_LAR_Type;
+typedef struct { __IO uint32_t CTRL, LOAD, VAL, CALIB; } SysTick_Type;
+#define SysTick ((SysTick_Type*)0xe000e010)
+typedef struct { uint8_t Enable, Number; uint32_t BaseAddress; uint8_t Size, SubRegionDisable, TypeExtField, AccessPermission, DisableExec, IsShareable, IsCacheable, IsBufferable; } MPU_Region_InitTypeDef;
+#define MPU_REGION_ENABLE 1
+#define MPU_REGION_NUMBER0 0
+#define MPU_REGION_NUMBER1 1
+#define MPU_REGION_SIZE_8MB 0x16
+#define MPU_REGION_SIZE_256KB 0x11
+#define MPU_REGION_SIZE_512KB 0x12
+#define MPU_REGION_SIZE_64KB 0x0F
+#define MPU_TEX_LEVEL0 0
+#define MPU_TEX_LEVEL1 1
+#define MPU_REGION_FULL_ACCESS 3
+#define MPU_INSTRUCTION_ACCESS_DISABLE 1
+#define MPU_INSTRUCTION_ACCESS_ENABLE 0
+#define MPU_ACCESS_SHAREABLE 1
+#define MPU_ACCESS_NOT_SHAREABLE 0
+#define MPU_ACCESS_CACHEABLE 1
+#define MPU_ACCESS_NOT_CACHEABLE 0
+#define MPU_ACCESS_BUFFERABLE 1
+#define MPU_ACCESS_NOT_BUFFERABLE 0
+#define MPU_PRIVILEGED_DEFAULT 4
+void HAL_MPU_Disable(void); void HAL_MPU_Enable(uint32_t c); void HAL_MPU_ConfigRegion(MPU_Region_InitTypeDef *r);
+#endif
+/* added for clock profiles */
+#ifndef STUB_CLOCK_EXTRA
+#define STUB_CLOCK_EXTRA
+#define RCC_SYSCLK_DIV4 0x90
+#define RCC_SYSCLK_DIV8 0xA0
+#define RCC_SYSCLK_DIV16 0xB0
+#define RCC_SYSCLK_DIV64 0xC0
+#define RCC_SYSCLK_DIV128 0xD0
+#define RCC_SYSCLK_DIV256 0xE0
+#define RCC_SYSCLK_DIV512 0xF0
+#define RCC_HCLK_DIV8 0x1800
+#define RCC_HCLK_DIV16 0x1C00
+#define RCC_OSCILLATORTYPE_NONE 0
+#define RCC_FLAG_PLLRDY 0x39
+#define __HAL_RCC_GET_FLAG(f) (RCC->CR & (1u<<25))
+#define __HAL_RCC_PLL_DISABLE() (RCC->CR &= ~(1u<<24))
+#define __HAL_FLASH_GET_LATENCY() (0)
+#define ADC_CLOCKPRESCALER_PCLK_DIV6 2
+#define ADC_CLOCKPRESCALER_PCLK_DIV8 3
+#define ADC_CCR_ADCPRE (3u<<16)
+typedef struct { volatile uint32_t CSR, CCR, CDR; } ADC_Common_TypeDef;
+#define ADC123_COMMON ((ADC_Common_TypeDef*)0x40012300)
+typedef struct { volatile uint32_t SDCR[2], SDTR[2], SDCMR, SDRTR, SDSR; } FMC_Bank5_6_TypeDef;
+#define FMC_Bank5_6 ((FMC_Bank5_6_TypeDef*)0xA0000140)
+#define FMC_SDRTR_COUNT (0x1FFFu<<1)
+#define FMC_SDRTR_COUNT_Pos 1
+#define RCC_AHB3ENR_FMCEN 1u
+typedef struct { volatile uint32_t CR, PLLCFGR, CFGR, CIR, AHB1RSTR, AHB2RSTR, AHB3RSTR, r0, APB1RSTR, APB2RSTR, r1[2], AHB1ENR, AHB2ENR, AHB3ENR; } RCC_TypeDef;
+#define RCC ((RCC_TypeDef*)0x40023800)
+#endif
+#ifndef STUB_SYSTICK_EXTRA
+#define STUB_SYSTICK_EXTRA
+#define SysTick_CTRL_ENABLE_Msk 1u
+#define SCB_ICSR_PENDSTSET_Msk (1u << 26)
+static inline uint32_t SysTick_Config(uint32_t t){ (void)t; return 0; }
+#endif
@@ -0,0 +1,90 @@
+/**
+  * @file touch_test.c
+  * @brief Runs the touch thread against the fake touch controller of touch_input.c and checks the events it posts
+  *        for a press, a hold that stands still and then moves, and a release, then for a second touch.
+  *        Only the kernel, the event queue and the touch thread run: the test reads the queue in place of the UI.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "main.h"
+#include "cmsis_os_soft.h"
+#include "touch_input.h"
+#include "events.h"
+
+/**
+  * @brief Names of the touch event types, indexed by enum touchType.
+  */
+static const char* const touchNames[] = {"down", "move", "up"};
+
+/**
+  * @brief Lets the touch thread run for a while, then checks the next event it posted.
+  * @param millisec Time to wait.
+  * @param type The touch event expected.
+  * @param x,y Co-ordinates expected.
+  * @returns Void.
+  */
+static void expectTouch(uint32_t millisec, enum touchType type, int x, int y){
+	event e;
+
+	osDelay(millisec);
+	if(!waitEvent(&e, 0) || e.type != EventTouch){
+		printf("FAIL expected %s, no touch event\n", touchNames[type]);
+		exit(1);
+	}
+	printf("%6u ms %s %d,%d\n", (unsigned int)os_time, touchNames[e.touch.type], e.touch.x, e.touch.y);
+	if(e.touch.type != type || e.touch.x != x || e.touch.y != y){
+		printf("FAIL expected %s %d,%d\n", touchNames[type], x, y);
+		exit(1);
+	}
+}
+
+/**
+  * @brief Lets the touch thread run for a while and checks it posted nothing.
+  * @param millisec Time to wait.
+  * @returns Void.
+  */
+static void expectNone(uint32_t millisec){
+	event e;
+
+	osDelay(millisec);
+	if(waitEvent(&e, 0)){
+		printf("FAIL expected no event, got type %d\n", (int)e.type);
+		exit(1);
+	}
+}
+
+/**
+  * @brief Main runner of the test. Starts the touch thread, then plays the touches from the main thread.
+  * @param None.
+  * @returns 0 if every event was as expected, 1 otherwise.
+  */
+int main(void){
+	osKernelInitialize();
+	eventsInitialize();
+	Touch_Initialize();
+	touchInputInitialize();
+	osKernelStart();
+
+	expectNone(50);
+	touchSoftPress(100, 50);
+	expectTouch(1, TouchDown, 100, 50);
+	// Held still, the thread samples without posting
+	expectNone(5 * TOUCH_SAMPLE_MS);
+	touchSoftPress(110, 60);
+	expectTouch(2 * TOUCH_SAMPLE_MS, TouchMove, 110, 60);
+	expectNone(5 * TOUCH_SAMPLE_MS);
+	touchSoftRelease();
+	expectTouch(2 * TOUCH_SAMPLE_MS, TouchUp, 110, 60);
+	expectNone(5 * TOUCH_SAMPLE_MS);
+	// The thread is back waiting for the interrupt
+	touchSoftPress(300, 200);
+	expectTouch(1, TouchDown, 300, 200);
+	touchSoftRelease();
+	expectTouch(2 * TOUCH_SAMPLE_MS, TouchUp, 300, 200);
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,44 @@
+/**
+  * @file trace2json.c
+  * @brief Converts a thread trace written by traceWriteCSV, on the board or the host, to Chrome trace JSON
+  *        that chrome://tracing and Perfetto open.
+  *        Usage: trace2json [trace.csv [trace.json]], reading stdin and writing stdout when a file is left out.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "trace.h"
+
+/**
+  * @brief Main runner of the converter.
+  * @param argc Number of arguments.
+  * @param argv The input and output file names.
+  * @returns 0 on success, 1 if a file could not be opened or the input is not a trace.
+  */
+int main(int argc, char** argv){
+	FILE* in = stdin;
+	FILE* out = stdout;
+	int converted;
+
+	if(argc > 3){
+		fprintf(stderr, "usage: %s [trace.csv [trace.json]]\n", argv[0]);
+		return 1;
+	}
+	if(argc > 1 && (in = fopen(argv[1], "r")) == NULL){
+		perror(argv[1]);
+		return 1;
+	}
+	if(argc > 2 && (out = fopen(argv[2], "w")) == NULL){
+		perror(argv[2]);
+		return 1;
+	}
+	converted = traceConvertCSV(in, out);
+	if(converted < 0){
+		fprintf(stderr, "%s: not a trace\n", (argc > 1) ? argv[1] : "stdin");
+		return 1;
+	}
+	fprintf(stderr, "%d switches\n", converted);
+	return (fclose(out) == 0) ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/**
+  * @file transitions_test.c
+  * @brief Steps every transition of transitions.c frame by frame on the snapshot path and checks what
+  *        transitionCompose shows: the old screen while the new one is drawn, then a wipe growing from the left,
+  *        a slide growing from the right, a fade blending the two and a cut, and the new screen alone at the end.
+  *        Built with GLCD_L8 there is no second palette to hold the old screen, and the new screen shows as
+  *        soon as it is drawn.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+#include "transitions.h"
+
+/**
+  * @brief Frames each transition takes in the test.
+  */
+#define FRAMES 4
+
+/**
+  * @brief Colours of the old and the new screen.
+  */
+#define OLD_COLOR GLCD_COLOR_BLUE
+#define NEW_COLOR GLCD_COLOR_RED
+
+/**
+  * @brief Names of the transitions, indexed by enum transitionType.
+  */
+static const char* const transitionNames[] = {"cut", "fade", "slide", "wipe"};
+
+/**
+  * @brief Returns the colour a pixel should show in a frame of a transition.
+  */
+typedef uint16_t (*colorRule)(enum transitionType type, uint32_t frame, uint32_t x);
+
+/**
+  * @brief The composed image.
+  */
+static uint16_t composed[GLCD_WIDTH * GLCD_HEIGHT];
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Fills the screen with one colour.
+  * @param color RGB565 colour.
+  * @returns Void.
+  */
+static void fillScreen(uint16_t color){
+	GLCD_SetBackgroundColor(color);
+	GLCD_ClearScreen();
+}
+
+/**
+  * @brief Returns the colour a pixel should show in a frame of a transition from OLD_COLOR to NEW_COLOR.
+  * @param type The transition.
+  * @param frame Frames shown, 0 to FRAMES.
+  * @param x Column of the pixel.
+  * @returns RGB565 colour.
+  */
+static uint16_t expectedColor(enum transitionType type, uint32_t frame, uint32_t x){
+	uint32_t columns = GLCD_WIDTH * frame / FRAMES;
+	uint32_t alpha = 255 * frame / FRAMES;
+
+#ifdef GLCD_L8
+	return NEW_COLOR;
+#endif
+	switch(type){
+		case TransitionFade:
+			// Red rises from the new screen as blue falls from the old one
+			return (uint16_t)(((31 * alpha / 255) << 11) | (31 * (255 - alpha) / 255));
+		case TransitionSlide:
+			return (x >= GLCD_WIDTH - columns) ? NEW_COLOR : OLD_COLOR;
+		case TransitionWipe:
+			return (x < columns) ? NEW_COLOR : OLD_COLOR;
+		default:
+			return NEW_COLOR;
+	}
+}
+
+/**
+  * @brief Returns the new screen's colour, shown once a transition ends.
+  * @param type,frame,x Unused.
+  * @returns NEW_COLOR.
+  */
+static uint16_t newColor(enum transitionType type, uint32_t frame, uint32_t x){
+	return NEW_COLOR;
+}
+
+/**
+  * @brief Composes the shown image and checks a row of it.
+  * @param type The transition, for the message.
+  * @param frame The frame, for the message.
+  * @param expected Gives the colour expected at each checked column.
+  * @returns Void.
+  */
+static void checkFrame(enum transitionType type, uint32_t frame, colorRule expected){
+	static const uint32_t columns[] = {0, GLCD_WIDTH / 4 - 1, GLCD_WIDTH / 4, GLCD_WIDTH / 2, GLCD_WIDTH - 1};
+	const uint16_t* row = composed + (GLCD_HEIGHT / 2) * GLCD_WIDTH;
+	unsigned int i;
+
+	transitionCompose(composed);
+	for(i = 0; i < sizeof(columns) / sizeof(columns[0]); i++){
+		if(row[columns[i]] != expected(type, frame, columns[i])){
+			printf("FAIL %s frame %u column %u: %04x, expected %04x\n", transitionNames[type], (unsigned int)frame,
+					(unsigned int)columns[i], row[columns[i]], expected(type, frame, columns[i]));
+			failures++;
+			return;
+		}
+	}
+}
+
+/**
+  * @brief Returns the old screen's colour, shown before a transition starts.
+  * @param type,frame,x Unused.
+  * @returns OLD_COLOR.
+  */
+static uint16_t oldColor(enum transitionType type, uint32_t frame, uint32_t x){
+	return OLD_COLOR;
+}
+
+/**
+  * @brief Runs one transition from OLD_COLOR to NEW_COLOR and checks every frame.
+  * @param type The transition.
+  * @returns Void.
+  */
+static void checkTransition(enum transitionType type){
+	uint32_t frame = 0;
+	uint32_t steps = 0;
+
+	fillScreen(OLD_COLOR);
+	transitionBegin();
+	fillScreen(NEW_COLOR);
+#ifdef GLCD_L8
+	checkFrame(type, 0, newColor);
+#else
+	checkFrame(type, 0, oldColor);
+#endif
+	transitionStart(type, FRAMES);
+	if(type != TransitionCut){
+		checkFrame(type, 0, expectedColor);
+	}
+	while(transitionStep()){
+		frame++;
+		steps++;
+		checkFrame(type, frame, expectedColor);
+	}
+#ifdef GLCD_L8
+	// Every transition is a cut
+	if(steps != 0){
+#else
+	if(steps != ((type == TransitionCut) ? 0 : FRAMES - 1)){
+#endif
+		printf("FAIL %s took %u steps\n", transitionNames[type], (unsigned int)steps);
+		failures++;
+	}
+	checkFrame(type, FRAMES, newColor);
+	// Drawing after the end shows at once
+	fillScreen(GLCD_COLOR_GREEN);
+	transitionCompose(composed);
+	if(composed[0] != GLCD_COLOR_GREEN){
+		printf("FAIL %s left the display frozen\n", transitionNames[type]);
+		failures++;
+	}
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	GLCD_Initialize();
+	checkTransition(TransitionWipe);
+	checkTransition(TransitionSlide);
+	checkTransition(TransitionFade);
+	checkTransition(TransitionCut);
+	if(transitionStep()){
+		printf("FAIL step without a transition\n");
+		failures++;
+	}
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
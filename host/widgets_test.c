@@ -0,0 +1,199 @@
+/**
+  * @file widgets_test.c
+  * @brief Checks the hit-test grid of widgets.c: the edges and corners of a button, a button spanning several
+  *        cells, buttons overlapping in a cell, a miss and a touch off the screen, a label that is never hit,
+  *        and a cell that is full. Then compares widgetHit with a scan of every button for every pixel.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdio.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "widgets.h"
+
+/**
+  * @brief Font of the buttons, only its size is used.
+  */
+static GLCD_FONT font = {8, 8, 0, 0, NULL};
+
+/**
+  * @brief Area of each button added, by id, to scan against.
+  */
+static uint16_t areas[WIDGET_MAX][4];
+
+/**
+  * @brief Whether each id is a button.
+  */
+static int isButton[WIDGET_MAX];
+
+/**
+  * @brief Checks that failed.
+  */
+static int failures = 0;
+
+/**
+  * @brief Counts a failed check and prints what failed.
+  * @param passed Whether the check passed.
+  * @param what What was checked.
+  * @returns Void.
+  */
+static void check(int passed, const char* what){
+	if(!passed){
+		printf("FAIL %s\n", what);
+		failures++;
+	}
+}
+
+/**
+  * @brief Adds a button and keeps its area for the scan.
+  * @param x,y,width,height Area of the button.
+  * @returns Id of the button, -1 if it was refused.
+  */
+static int addButton(unsigned int x, unsigned int y, unsigned int width, unsigned int height){
+	int id = widgetAddButton(x, y, width, height, "", &font, GLCD_COLOR_WHITE, GLCD_COLOR_BLUE);
+	if(id >= 0){
+		areas[id][0] = (uint16_t)x;
+		areas[id][1] = (uint16_t)y;
+		areas[id][2] = (uint16_t)width;
+		areas[id][3] = (uint16_t)height;
+		isButton[id] = 1;
+	}
+	return id;
+}
+
+/**
+  * @brief Removes every widget, here and in widgets.c.
+  * @param None.
+  * @returns Void.
+  */
+static void clearWidgets(void){
+	int id;
+	widgetsClear();
+	for(id = 0; id < WIDGET_MAX; id++){
+		isButton[id] = 0;
+	}
+}
+
+/**
+  * @brief Finds the button under a pixel by checking every button, the last added on top.
+  * @param x,y Co-ordinates of the pixel.
+  * @returns Id of the button, -1 if there is none.
+  */
+static int scanHit(int x, int y){
+	int id;
+	for(id = WIDGET_MAX - 1; id >= 0; id--){
+		if(isButton[id] && x >= areas[id][0] && x < areas[id][0] + areas[id][2]
+				&& y >= areas[id][1] && y < areas[id][1] + areas[id][3]){
+			return id;
+		}
+	}
+	return -1;
+}
+
+/**
+  * @brief Checks the hits of the layout.
+  * @param None.
+  * @returns Void.
+  */
+static void checkLayout(void){
+	int corner;
+	int wide;
+	int under;
+	int over;
+	int label;
+
+	clearWidgets();
+	// Inside one cell, away from the cell edges
+	corner = addButton(40, 40, 20, 10);
+	// From the middle of one cell to the middle of another, three cells across and two down
+	wide = addButton(WIDGET_CELL_SIZE * 4 + 16, WIDGET_CELL_SIZE * 2 + 16, WIDGET_CELL_SIZE * 2, WIDGET_CELL_SIZE);
+	// Overlapping, the later one on top
+	under = addButton(300, 200, 60, 40);
+	over = addButton(330, 210, 60, 40);
+	label = widgetAddLabel(0, 0, "LABEL", &font, GLCD_COLOR_WHITE, GLCD_COLOR_BLACK);
+
+	check(widgetHit(40, 40) == corner, "top left corner");
+	check(widgetHit(59, 40) == corner, "top right corner");
+	check(widgetHit(40, 49) == corner, "bottom left corner");
+	check(widgetHit(59, 49) == corner, "bottom right corner");
+	check(widgetHit(39, 45) == -1 && widgetHit(60, 45) == -1, "left and right of the edges");
+	check(widgetHit(50, 39) == -1 && widgetHit(50, 50) == -1, "above and below the edges");
+
+	check(widgetHit(WIDGET_CELL_SIZE * 4 + 16, WIDGET_CELL_SIZE * 2 + 16) == wide, "spanning button, first cell");
+	check(widgetHit(WIDGET_CELL_SIZE * 5, WIDGET_CELL_SIZE * 3) == wide, "spanning button, middle cell");
+	check(widgetHit(WIDGET_CELL_SIZE * 6 + 15, WIDGET_CELL_SIZE * 3 + 15) == wide, "spanning button, last cell");
+	check(widgetHit(WIDGET_CELL_SIZE * 6 + 16, WIDGET_CELL_SIZE * 3) == -1, "spanning button, past its edge");
+
+	check(widgetHit(310, 205) == under, "lower button where it is alone");
+	check(widgetHit(340, 220) == over, "upper button where both are");
+	check(widgetHit(385, 245) == over, "upper button where it is alone");
+
+	check(widgetHit(5, 5) == -1 && label >= 0, "labels are not hit");
+	check(widgetHit(200, 150) == -1, "a miss");
+	check(widgetHit(-1, 10) == -1 && widgetHit(10, -1) == -1
+			&& widgetHit(GLCD_WIDTH, 10) == -1 && widgetHit(10, GLCD_HEIGHT) == -1, "off the screen");
+}
+
+/**
+  * @brief Fills one cell and checks that a button that does not fit is refused and changes nothing.
+  * @param None.
+  * @returns Void.
+  */
+static void checkFullCell(void){
+	int ids[WIDGET_CELL_SLOTS];
+	int i;
+
+	clearWidgets();
+	for(i = 0; i < WIDGET_CELL_SLOTS; i++){
+		ids[i] = addButton(i, i, WIDGET_CELL_SIZE - i, WIDGET_CELL_SIZE - i);
+	}
+	check(ids[WIDGET_CELL_SLOTS - 1] >= 0, "a cell holds WIDGET_CELL_SLOTS buttons");
+	// Spans the full cell and the empty one to the right
+	check(addButton(10, 10, WIDGET_CELL_SIZE, 4) == -1, "a button over a full cell is refused");
+	check(widgetHit(WIDGET_CELL_SIZE + 5, 12) == -1, "a refused button leaves no trace in its other cells");
+	check(widgetHit(WIDGET_CELL_SIZE - 1 - (WIDGET_CELL_SLOTS - 1), WIDGET_CELL_SLOTS - 1)
+			== ids[WIDGET_CELL_SLOTS - 1], "the top button of the full cell");
+	check(addButton(WIDGET_CELL_SIZE, 0, 4, 4) >= 0, "the next cell still takes buttons");
+	check(addButton(GLCD_WIDTH - 4, 0, 8, 4) == -1, "a button past the screen is refused");
+}
+
+/**
+  * @brief Compares widgetHit with the scan for every pixel of the screen.
+  * @param None.
+  * @returns Void.
+  */
+static void checkEveryPixel(void){
+	int mismatches = 0;
+	int x;
+	int y;
+
+	for(y = 0; y < GLCD_HEIGHT; y++){
+		for(x = 0; x < GLCD_WIDTH; x++){
+			mismatches += widgetHit(x, y) != scanHit(x, y);
+		}
+	}
+	if(mismatches != 0){
+		printf("FAIL %d pixels hit another button than the scan finds\n", mismatches);
+		failures++;
+	}
+}
+
+/**
+  * @brief Main runner of the test.
+  * @param None.
+  * @returns 0 if every check passed, 1 otherwise.
+  */
+int main(void){
+	checkLayout();
+	checkEveryPixel();
+	checkFullCell();
+	checkEveryPixel();
+	if(failures != 0){
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,207 @@
+/**
+  * @file layers.c
+  * @brief Define functions that split the display over the two LTDC layers.
+  *        Layer 1 shows a cached copy of the background, layer 2 shows the board driver's frame buffer
+  *        with LAYER_KEY_COLOR keyed out, so every GLCD call draws the HUD. Screens draw their background
+  *        first and move it down with layerCommitBackground. Define GLCD_SOFT when linking with glcd_soft.c
+  *        instead; layersCompose then blends the layers the way the LTDC does.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <string.h>
+#include "GLCD_Config.h"
+#include "glcd_l8.h"
+#include "mirror.h"
+#include "layers.h"
+#include "dma2d.h"
+#ifndef GLCD_SOFT
+#include "cmsis_os.h"
+#include "stm32f7xx_hal.h"
+#endif
+
+#ifdef GLCD_LAYERS
+
+/**
+  * @brief LTDC pixel format code of an RGB565 layer.
+  */
+#define LTDC_PIXEL_FORMAT_RGB565 2
+
+/**
+  * @brief LTDC blending factors: pixel alpha times constant alpha, and one minus that.
+  */
+#define LTDC_BLEND_PAXCA    6
+#define LTDC_BLEND_1_PAXCA  7
+
+/**
+  * @brief Time between two steps of a fade, about one frame.
+  */
+#define LAYER_FADE_STEP_MS 16
+
+/**
+  * @brief The background layer, placed in SDRAM behind the indexed frame buffer of glcd_l8.c.
+  */
+#ifdef GLCD_SOFT
+static uint16_t background_buf[GLCD_WIDTH * GLCD_HEIGHT];
+#else
+static uint16_t background_buf[GLCD_WIDTH * GLCD_HEIGHT] __attribute__((section(".ARM.__at_0xC0060000")));
+#endif
+
+/**
+  * @brief Constant alpha of each layer, indexed by enum layer.
+  */
+static uint8_t alphas[2] = {255, 255};
+
+/**
+  * @brief Expands an RGB565 colour to the RGB888 value the LTDC compares and blends.
+  * @param color RGB565 colour.
+  * @returns RGB888 colour.
+  */
+static uint32_t expandColor(uint32_t color){
+	uint32_t r = (color >> 11) & 0x1F;
+	uint32_t g = (color >> 5) & 0x3F;
+	uint32_t b = color & 0x1F;
+	return (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+/**
+  * @brief Blends one RGB888 colour over another.
+  * @param top,below RGB888 colours.
+  * @param alpha Weight of the top colour, 0 to 255.
+  * @returns RGB888 colour.
+  */
+static uint32_t blend(uint32_t top, uint32_t below, uint32_t alpha){
+	uint32_t result = 0;
+	uint32_t shift;
+	for(shift = 0; shift < 24; shift += 8){
+		result |= ((((top >> shift) & 0xFF) * alpha + ((below >> shift) & 0xFF) * (255 - alpha)) / 255) << shift;
+	}
+	return result;
+}
+
+/**
+  * @brief Moves the board driver's frame buffer up to layer 2 and shows the background buffer on layer 1.
+  *        Call after GLCD_Initialize; whatever was drawn before becomes the background.
+  * @param None.
+  * @returns Void.
+  */
+void layersInitialize(void){
+	layerCommitBackground();
+#ifndef GLCD_SOFT
+	LTDC_Layer2->WHPCR = LTDC_Layer1->WHPCR;
+	LTDC_Layer2->WVPCR = LTDC_Layer1->WVPCR;
+	LTDC_Layer2->PFCR = LTDC_PIXEL_FORMAT_RGB565;
+	LTDC_Layer2->CFBAR = GLCD_FrameBufferAddress();
+	LTDC_Layer2->CFBLR = LTDC_Layer1->CFBLR;
+	LTDC_Layer2->CFBLNR = LTDC_Layer1->CFBLNR;
+	LTDC_Layer2->CKCR = expandColor(LAYER_KEY_COLOR);
+	// Keyed pixels get a zero pixel alpha, so only pixel-alpha blending makes them see-through
+	LTDC_Layer2->BFCR = (LTDC_BLEND_PAXCA << 8) | LTDC_BLEND_1_PAXCA;
+	LTDC_Layer2->CACR = alphas[LayerHud];
+	LTDC_Layer2->DCCR = 0;
+	LTDC_Layer2->CR = LTDC_LxCR_LEN | LTDC_LxCR_COLKEN;
+
+	LTDC_Layer1->BFCR = (LTDC_BLEND_PAXCA << 8) | LTDC_BLEND_1_PAXCA;
+	LTDC_Layer1->CACR = alphas[LayerBackground];
+	LTDC_Layer1->CFBAR = (uint32_t)background_buf;
+	LTDC->SRCR = LTDC_SRCR_VBR;
+#endif
+}
+
+/**
+  * @brief Copies everything drawn so far to the background layer and clears the HUD layer to transparent.
+  *        Pixels still at the key colour are copied as they are, so draw the whole background first.
+  * @param None.
+  * @returns Void.
+  */
+void layerCommitBackground(void){
+	uint16_t* hud = glcdFrameBuffer();
+	dma2dCopy(background_buf, GLCD_WIDTH, hud, GLCD_WIDTH, GLCD_WIDTH, GLCD_HEIGHT, 2);
+	dma2dFill(hud, GLCD_WIDTH, GLCD_WIDTH, GLCD_HEIGHT, LAYER_KEY_COLOR, 2);
+	dma2dWait();
+	mirrorMarkDirty(0, 0, GLCD_WIDTH, GLCD_HEIGHT);
+}
+
+/**
+  * @brief Sets the constant alpha of a layer, applied at the next vertical blank.
+  * @param l The layer.
+  * @param alpha 0 for invisible to 255 for opaque.
+  * @returns Void.
+  */
+void layerSetAlpha(enum layer l, uint8_t alpha){
+	alphas[l] = alpha;
+#ifndef GLCD_SOFT
+	if(l == LayerBackground){
+		LTDC_Layer1->CACR = alpha;
+	}else{
+		LTDC_Layer2->CACR = alpha;
+	}
+	LTDC->SRCR = LTDC_SRCR_VBR;
+#endif
+}
+
+/**
+  * @brief Returns the constant alpha of a layer.
+  * @param l The layer.
+  * @returns 0 for invisible to 255 for opaque.
+  */
+uint8_t layerAlpha(enum layer l){
+	return alphas[l];
+}
+
+/**
+  * @brief Fades both layers from the alpha of the HUD layer to a new alpha.
+  *        The LTDC does the blending, the calling thread only sleeps between steps.
+  * @param alpha The alpha to end at, 0 fades to black.
+  * @param ms Length of the fade in milliseconds.
+  * @returns Void.
+  */
+void layerFade(uint8_t alpha, uint32_t ms){
+	int32_t from = alphas[LayerHud];
+	uint32_t steps = ms / LAYER_FADE_STEP_MS;
+	uint32_t step;
+	uint8_t value;
+
+	for(step = 1; step <= steps; step++){
+		value = (uint8_t)(from + ((int32_t)alpha - from) * (int32_t)step / (int32_t)steps);
+		layerSetAlpha(LayerBackground, value);
+		layerSetAlpha(LayerHud, value);
+#ifndef GLCD_SOFT
+		osDelay(LAYER_FADE_STEP_MS);
+#endif
+	}
+	layerSetAlpha(LayerBackground, alpha);
+	layerSetAlpha(LayerHud, alpha);
+}
+
+/**
+  * @brief Returns the background layer's pixels.
+  * @param None.
+  * @returns Pointer to GLCD_WIDTH * GLCD_HEIGHT RGB565 pixels.
+  */
+uint16_t* layerBackgroundBuffer(void){
+	return background_buf;
+}
+
+/**
+  * @brief Blends both layers into one image the way the LTDC shows them:
+  *        the background over black, then the HUD with its key colour see-through.
+  * @param out GLCD_WIDTH * GLCD_HEIGHT RGB565 pixels to fill.
+  * @returns Void.
+  */
+void layersCompose(uint16_t* out){
+	const uint16_t* hud = glcdFrameBuffer();
+	uint32_t i;
+	uint32_t color;
+
+	for(i = 0; i < GLCD_WIDTH * GLCD_HEIGHT; i++){
+		color = blend(expandColor(background_buf[i]), 0, alphas[LayerBackground]);
+		if(hud[i] != LAYER_KEY_COLOR){
+			color = blend(expandColor(hud[i]), color, alphas[LayerHud]);
+		}
+		out[i] = (uint16_t)(((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F));
+	}
+}
+
+#endif
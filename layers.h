@@ -0,0 +1,66 @@
+/**
+  * @file layers.h
+  * @brief Header file of the layers.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef LAYERS_H
+#define LAYERS_H
+
+#include <stdint.h>
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+
+/**
+  * @brief Show the screens on two LTDC layers: a cached background below and the HUD on top.
+  *        Uncomment to stop HUD updates and transitions from redrawing the background.
+  */
+//#define GLCD_LAYERS
+
+/**
+  * @brief RGB565 colour keyed out of the HUD layer, the background shows through it.
+  *        Near black and not one of the GLCD colours, so nothing draws it by accident.
+  */
+#define LAYER_KEY_COLOR 0x0821
+
+/**
+  * @brief Length of the fade used for screen transitions, in milliseconds.
+  */
+#define LAYER_FADE_MS 160
+
+/**
+  * @brief Colour to draw behind HUD text, transparent when the layers are used.
+  */
+#ifdef GLCD_LAYERS
+#define LAYER_HUD_BACKGROUND LAYER_KEY_COLOR
+#else
+#define LAYER_HUD_BACKGROUND GLCD_COLOR_BLACK
+#endif
+
+#ifdef GLCD_LAYERS
+
+#ifdef GLCD_L8
+#error "GLCD_LAYERS needs the RGB565 frame buffer, undefine GLCD_L8"
+#endif
+
+enum layer{LayerBackground, LayerHud};
+
+void layersInitialize(void);
+void layerCommitBackground(void);
+void layerSetAlpha(enum layer l, uint8_t alpha);
+uint8_t layerAlpha(enum layer l);
+void layerFade(uint8_t alpha, uint32_t ms);
+uint16_t* layerBackgroundBuffer(void);
+void layersCompose(uint16_t* out);
+
+#else
+
+#define layersInitialize()
+#define layerCommitBackground()
+#define layerFade(alpha, ms)
+
+#endif
+
+#endif
@@ -12,6 +12,19 @@
 #include "main.h"
 #include "draw_functions.h"
 #include "screens.h"
+#include "glyph_atlas.h"
+#include "touch_input.h"
+#include "events.h"
+#include "layers.h"
+#include "prng.h"
+#include "mirror.h"
+#include "frame_pacer.h"
+#include "governor.h"
+#include "pool.h"
+#include "stack_watch.h"
+#include "bus.h"
+#include "trace.h"
+#include "platform.h"
 
 /**
   * @brief A variable of type GLCD_FONT denoting the font size of 6x8.
@@ -23,11 +36,6 @@ extern GLCD_FONT 		GLCD_Font_6x8;
 extern GLCD_FONT 		GLCD_Font_16x24;
 
 
-/**
-  * @brief An enum containing different type of GUI screens.
-  */
-enum screen currentScreen = Home;
-
 /**
   * @brief Thread function for player 1 paddles handling.
   */
@@ -70,34 +78,19 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
 void ConfigureADC(void);
 
 /**
-  * @brief Stores average values for ADC. For Infrared Sensor 1.
-  */
-int averageValue1;
-/**
-  * @brief Stores average values for ADC. For Infrared Sensor 2.
-  */
-int averageValue2;
-/**
-  * @brief Stores average values for ADC. For Light Sensor.
+  * @brief Previous IR sensor value of player 1, used to detect a drop caused by the ball.
   */
-int averageValue3;
-
+static int lastPlayer1 = 500;
 
 /**
-  * @brief A variable indicating the current score of player 1.
+  * @brief Previous IR sensor value of player 2, used to detect a drop caused by the ball.
   */
-int player1Score = 0;
+static int lastPlayer2 = 500;
+
 /**
-  * @brief A variable indicating the current score of player 2.
+  * @brief Last lid state published: 1 open, 0 closed, -1 not known yet.
   */
-int player2Score = 0;
-
-
-/*
-char buffer[5];
-char buffer2[5];
-char buffer3[5];
-*/
+static int lidState = -1;
 
 /**
   * @brief Thread ID struct for player 1 thread.
@@ -161,19 +154,39 @@ int PWM_LOW = 51;
 int PWM_HIGH = 58;
 
 
+/**
+  * @brief Publishes a flipper move on the bus. The move is only dropped if a subscriber lags behind.
+  * @param player The player, 1 or 2.
+  * @param pressed true when the flipper goes up.
+  * @returns Void.
+  */
+ITCM_CODE static void publishFlipper(int player, bool pressed){
+	// Each player's thread publishes on its own topic, a topic has one publisher
+	enum busTopic topic = (player == 1) ? TopicFlipper1 : TopicFlipper2;
+	busFlipper* flipper = (busFlipper*)busReserve(topic);
+	if(flipper != NULL){
+		flipper->player = player;
+		flipper->pressed = pressed;
+		busPublish(topic);
+	}
+}
+
 /**
   * @brief player 1 thread function. Controls Servos 1 and 2.
   * @param Thread function default argument paramater.
   * @returns Void.
   */
-void player1Task (void const* argument) {
+ITCM_CODE void player1Task (void const* argument) {
 	GPIO_PinState bitstatus;
+	stackWatchAddCurrent("player1", STACK_WATCH_DEFAULT_SIZE);
 	for(;;){
 		bitstatus = HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_6);
 		if(bitstatus != 0){
 			TIM3->CCR1 = PWM_LOW;
+			publishFlipper(1, true);
 			osDelay(300);
 			TIM3->CCR1 = PWM_HIGH;
+			publishFlipper(1, false);
 		}else{
 		}
 		osDelay(50);
@@ -186,14 +199,17 @@ void player1Task (void const* argument) {
   * @param Thread function default argument paramater.
   * @returns Void.
   */
-void player2Task(void const* argument) {
+ITCM_CODE void player2Task(void const* argument) {
 	GPIO_PinState bitstatus;
+	stackWatchAddCurrent("player2", STACK_WATCH_DEFAULT_SIZE);
 	for(;;){
 		bitstatus = HAL_GPIO_ReadPin(GPIOG, GPIO_PIN_6);
 		if(bitstatus != 0){
 			TIM12->CCR1 = PWM_HIGH;
+			publishFlipper(2, true);
 			osDelay(300);
 			TIM12->CCR1 = PWM_LOW;
+			publishFlipper(2, false);
 		}else{
 		}
 		osDelay(50);
@@ -202,66 +218,120 @@ void player2Task(void const* argument) {
 
 
 
+/**
+  * @brief Publishes a score on the bus.
+  * @param player The player who scored, 1 or 2.
+  * @returns Void.
+  */
+ITCM_CODE static void publishScore(int player){
+	busScore* score = (busScore*)busReserve(TopicScore);
+	if(score != NULL){
+		score->player = player;
+		busPublish(TopicScore);
+	}
+}
+
+/**
+  * @brief Publishes a lid change on the bus.
+  * @param open true when the lid opened.
+  * @returns Void.
+  */
+ITCM_CODE static void publishLid(bool open){
+	busLid* lid = (busLid*)busReserve(TopicLid);
+	if(lid != NULL){
+		lid->open = open;
+		busPublish(TopicLid);
+	}
+}
+
+/**
+  * @brief Turns a round of sensor averages into scores and lid changes on the bus.
+  * @param block The averages.
+  * @returns Void.
+  */
+ITCM_CODE static void postSensorEvents(const busSensorBlock* block){
+	if (lastPlayer1 - block->player1 > 50){
+		publishScore(1);
+	}
+	lastPlayer1 = block->player1;
+
+	if(block->player2 < 125){
+		publishScore(2);
+	}else if (lastPlayer2 - block->player2  > 40){
+		publishScore(2);
+	}
+	lastPlayer2 = block->player2;
+
+	// Thresholds are apart so a flickering light does not toggle the lid state
+	if(block->light < 3700 && lidState != 1){
+		lidState = 1;
+		publishLid(true);
+	}else if(block->light > 4050 && lidState != 0){
+		lidState = 0;
+		publishLid(false);
+	}
+}
+
+
+/**
+  * @brief Sensor filter: converts one ADC channel and averages repeated reads of the result.
+  * @param channel The ADC channel to convert.
+  * @param samples Number of reads averaged.
+  * @param average Set to the average, left unchanged if the conversion times out.
+  * @returns Void.
+  */
+ITCM_CODE void sensorAverage(uint32_t channel, int samples, int* average){
+	int runningAverage = 0;
+	int counter;
+
+	HAL_ADC_Stop(&AdcHandle1);
+	adcChannel1.Channel = channel;
+	HAL_ADC_ConfigChannel(&AdcHandle1, &adcChannel1);
+	HAL_ADC_Start(&AdcHandle1);
+	if (HAL_ADC_PollForConversion(&AdcHandle1, 1000000) == HAL_OK){
+		for (counter = 0; counter < samples; counter++){
+			runningAverage += HAL_ADC_GetValue(&AdcHandle1);
+		}
+		*average = runningAverage/samples;
+	}
+}
+
+/**
+  * @brief Latest sensor averages, a sensor keeps its value when its conversion times out.
+  */
+DTCM_DATA static busSensorBlock lastBlock;
+
 /**
   * @brief ADC thread function. Controls all analog peripherals.
+  *        Each round is averaged straight into a slot of the sensor topic and published.
   * @param Thread function default argument paramater.
   * @returns Void.
   */
 void analogTask(void const* argument) {
-	int runningAverage1;
-	int runningAverage2;
-	int runningAverage3;
-	int counter1 = 0;
-	int counter2 = 0;
-	int counter3 = 0;
-	
-	
+	busSensorBlock* block;
+	stackWatchAddCurrent("analog", STACK_WATCH_DEFAULT_SIZE);
 	for(;;){
-		HAL_ADC_Stop(&AdcHandle1);
-		adcChannel1.Channel = ADC_CHANNEL_0;
-		HAL_ADC_ConfigChannel(&AdcHandle1, &adcChannel1);
-		HAL_ADC_Start(&AdcHandle1);
-		if (HAL_ADC_PollForConversion(&AdcHandle1, 1000000) == HAL_OK){
-			runningAverage1 = 0;
-			for (counter1 = 0; counter1 < 100000; counter1++){
-				runningAverage1 += HAL_ADC_GetValue(&AdcHandle1);
-			}
-			averageValue1 = runningAverage1/100000;
-		}
-		HAL_ADC_Stop(&AdcHandle1);
-		adcChannel1.Channel = ADC_CHANNEL_8;
-		HAL_ADC_ConfigChannel(&AdcHandle1, &adcChannel1);
-		HAL_ADC_Start(&AdcHandle1);
-		if (HAL_ADC_PollForConversion(&AdcHandle1, 1000000) == HAL_OK){
-			runningAverage2 = 0;
-			for (counter2 = 0; counter2 < 100000; counter2++){
-				runningAverage2 += HAL_ADC_GetValue(&AdcHandle1);
-			}
-			averageValue2 = runningAverage2/100000;
+		block = (busSensorBlock*)busReserve(TopicSensor);
+		// A lagging subscriber only misses this round, the scores and the lid are still checked
+		if(block == NULL){
+			block = &lastBlock;
+		}else{
+			*block = lastBlock;
 		}
-
-		
-		HAL_ADC_Stop(&AdcHandle1);
-		adcChannel1.Channel = ADC_CHANNEL_6;
-		HAL_ADC_ConfigChannel(&AdcHandle1, &adcChannel1);
-		HAL_ADC_Start(&AdcHandle1);
-		
-		if (HAL_ADC_PollForConversion(&AdcHandle1, 1000000) == HAL_OK){
-			runningAverage3 = 0;
-			for (counter3 = 0; counter3 < 100; counter3++){
-				runningAverage3 += HAL_ADC_GetValue(&AdcHandle1);
-			}
-			averageValue3 = runningAverage3/100;
+		// Sample counts follow the core clock, so a round of readings takes as long in every profile
+		sensorAverage(ADC_CHANNEL_0, governorSamples(100000), &block->player1);
+		sensorAverage(ADC_CHANNEL_8, governorSamples(100000), &block->player2);
+		sensorAverage(ADC_CHANNEL_6, governorSamples(100), &block->light);
+		block->time = osKernelSysTick();
+		if(block != &lastBlock){
+			lastBlock = *block;
+			busPublish(TopicSensor);
 		}
-		sprintf(buffer, "%d", averageValue1);
-		sprintf(buffer2, "%d", averageValue2);
-		sprintf(buffer3, "%d", averageValue3);
+		postSensorEvents(&lastBlock);
 		osDelay(50);
-		
 	}
 }
 
-
 /**
   * @brief Main runner of the program.
   * @param None.
@@ -270,12 +340,16 @@ void analogTask(void const* argument) {
 int main (void) {
 	// Variable Setup	
 
-	TOUCH_STATE tsc_state;
 	settings curSettings = {false, 0, "foobar"};
 	
 	// Initialising and Preparing Screen and Touch
+	platformInitialize();
 	HAL_Init();
 	SystemClock_Config();
+	profilerInitialize();
+	poolsInitialize();
+	traceInitialize();
+	prngSeedAll(PRNG_DEFAULT_SEED);
 	
 	MX_GPIO_Init();
 	MX_TIM12_Init();
@@ -290,13 +364,30 @@ int main (void) {
 	HAL_TIM_PWM_Start(&htim3, TIM_CHANNEL_1);
 	
 	osKernelInitialize();
+	eventsInitialize();
+	busInitialize();
+	screensInitialize();
 	GLCD_Initialize();
+	layersInitialize();
 	Touch_Initialize();
+	// Score digits are drawn from pre-rasterised glyphs
+	atlasBuild(&GLCD_Font_16x24, "0123456789 ", GLCD_COLOR_YELLOW, LAYER_HUD_BACKGROUND);
+#ifdef PLATFORM_BENCHMARK
+	platformBenchmark(stdout);
+#endif
+	touchInputInitialize();
+	mirrorInitialize();
 	player1Paddles = osThreadCreate(osThread(player1Task), NULL);
   player2Paddles = osThreadCreate(osThread(player2Task), NULL);
 	analogThread = osThreadCreate(osThread(analogTask), NULL);
+	traceName(player1Paddles, "player1");
+	traceName(player2Paddles, "player2");
+	traceName(analogThread, "analog");
 	
   osKernelStart();
+	// main carries on as the main thread from here
+	stackWatchAddCurrent("main", STACK_WATCH_MAIN_SIZE);
+	traceName(osThreadGetId(), "main");
 	//Default screen settings 
   GLCD_SetFont            (&GLCD_Font_16x24);
 	GLCD_ClearScreen();
@@ -312,24 +403,10 @@ int main (void) {
 	initAsOutput(5);
 	
 
-	while(1){
-		switch(currentScreen) {
-			
-			case Home:
-				home(&currentScreen, &tsc_state, &curSettings);
-				break;
-			
-			case Game:
-				game(&currentScreen, &tsc_state, &curSettings);
-				break;
-			case Error:
-				error(&currentScreen, &tsc_state);
-				break;
-			default:
-				home(&currentScreen, &tsc_state, &curSettings);
-				break;
-		}
-	}
+	// Every screen is driven from the event queue from here on, and redrawn once per frame
+	governorInitialize();
+	framePacerInitialize();
+	screenRun(Home, &curSettings);
 }
 
 
@@ -343,7 +420,7 @@ static void MX_TIM3_Init(void){
   TIM_MasterConfigTypeDef sMasterConfig = {0};
   TIM_OC_InitTypeDef sConfigOC = {0};
   htim3.Instance = TIM3;
-  htim3.Init.Prescaler = 2550;
+  htim3.Init.Prescaler = platformServoPrescaler();
   htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
   htim3.Init.Period = 580;
   htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
@@ -372,7 +449,7 @@ static void MX_TIM12_Init(void){
   TIM_ClockConfigTypeDef sClockSourceConfig = {0};
   TIM_OC_InitTypeDef sConfigOC = {0};
   htim12.Instance = TIM12;
-  htim12.Init.Prescaler = 2550;
+  htim12.Init.Prescaler = platformServoPrescaler();
   htim12.Init.CounterMode = TIM_COUNTERMODE_UP;
   htim12.Init.Period = 580;
   htim12.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
@@ -428,7 +505,7 @@ void ConfigureADC(void){
 	HAL_NVIC_EnableIRQ(ADC_IRQn);
 
 	AdcHandle1.Instance = ADC3;
-	AdcHandle1.Init.ClockPrescaler = ADC_CLOCKPRESCALER_PCLK_DIV2;
+	AdcHandle1.Init.ClockPrescaler = platformAdcPrescaler();
 	AdcHandle1.Init.Resolution = ADC_RESOLUTION_12B;
 	AdcHandle1.Init.ScanConvMode = DISABLE;
 	AdcHandle1.Init.ContinuousConvMode = ENABLE;
@@ -17,3 +17,9 @@
 #include "GLCD_Config.h"
 #include "Board_GLCD.h"
 #include "Board_Touch.h"
+#include "glcd_l8.h"
+#include "mirror.h"
+#include "profiler.h"
+#include "platform.h"
+
+void sensorAverage(uint32_t channel, int samples, int* average);
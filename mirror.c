@@ -0,0 +1,602 @@
+/**
+  * @file mirror.c
+  * @brief Define functions that stream the display to a remote viewer, and decode that stream.
+  *        The drawing calls mark the tiles they touch as dirty. Each frame only dirty tiles are read and
+  *        hashed, and only those whose hash changed are encoded and sent, up to the byte budget of the frame.
+  *        Define GLCD_SOFT when linking with glcd_soft.c instead; the stream is then written to a file,
+  *        such as a pseudo-terminal.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define MIRROR_NO_REDIRECT
+#include <stdbool.h>
+#include <string.h>
+#include "glcd_l8.h"
+#include "mirror.h"
+#include "layers.h"
+#include "stack_watch.h"
+#include "trace.h"
+#ifndef GLCD_SOFT
+#include "cmsis_os.h"
+#include "rl_usb.h"
+#endif
+
+#if (GLCD_WIDTH % MIRROR_TILE_SIZE) != 0 || (GLCD_HEIGHT % MIRROR_TILE_SIZE) != 0
+#error "MIRROR_TILE_SIZE must divide the screen size"
+#endif
+
+/**
+  * @brief Most bytes one tile message takes.
+  */
+#define MIRROR_MAX_MESSAGE (MIRROR_HEADER_SIZE + MIRROR_TILE_PIXELS * 2)
+
+/**
+  * @brief Writes a message header.
+  * @param out Buffer of at least MIRROR_HEADER_SIZE bytes.
+  * @param tile Tile index, or MIRROR_END_OF_FRAME.
+  * @param encoding Encoding of the payload.
+  * @param length Payload length in bytes.
+  * @returns Void.
+  */
+static void writeHeader(uint8_t* out, uint16_t tile, enum mirrorEncoding encoding, uint32_t length){
+	out[0] = MIRROR_MAGIC;
+	out[1] = (uint8_t)tile;
+	out[2] = (uint8_t)(tile >> 8);
+	out[3] = (uint8_t)encoding;
+	out[4] = (uint8_t)length;
+	out[5] = (uint8_t)(length >> 8);
+}
+
+/**
+  * @brief Encodes one tile as a complete message, choosing the smallest encoding.
+  * @param pixels The MIRROR_TILE_PIXELS RGB565 pixels of the tile, row by row.
+  * @param out Buffer of at least MIRROR_HEADER_SIZE + MIRROR_TILE_PIXELS * 2 bytes.
+  * @param tile Index of the tile.
+  * @returns Length of the message in bytes.
+  */
+uint32_t mirrorEncodeTile(const uint16_t* pixels, uint8_t* out, uint16_t tile){
+	uint8_t* payload = out + MIRROR_HEADER_SIZE;
+	enum mirrorEncoding encoding = MirrorRun;
+	uint32_t length = 0;
+	uint32_t i = 0;
+	uint32_t run;
+
+	while(i < MIRROR_TILE_PIXELS){
+		// Runs longer than raw pixels lose, stop as soon as that is certain
+		if(length + 3 >= MIRROR_TILE_PIXELS * 2){
+			encoding = MirrorRaw;
+			break;
+		}
+		for(run = 1; i + run < MIRROR_TILE_PIXELS && run < 256 && pixels[i + run] == pixels[i]; run++){
+		}
+		payload[length++] = (uint8_t)(run - 1);
+		payload[length++] = (uint8_t)pixels[i];
+		payload[length++] = (uint8_t)(pixels[i] >> 8);
+		i += run;
+	}
+
+	if(encoding == MirrorRaw){
+		for(i = 0; i < MIRROR_TILE_PIXELS; i++){
+			payload[2 * i] = (uint8_t)pixels[i];
+			payload[2 * i + 1] = (uint8_t)(pixels[i] >> 8);
+		}
+		length = MIRROR_TILE_PIXELS * 2;
+	}else if(length == 3 && payload[0] == MIRROR_TILE_PIXELS - 1){
+		encoding = MirrorSolid;
+		payload[0] = payload[1];
+		payload[1] = payload[2];
+		length = 2;
+	}
+	writeHeader(out, tile, encoding, length);
+	return MIRROR_HEADER_SIZE + length;
+}
+
+/**
+  * @brief Sets up a decoder. The frame is only changed by the tiles received.
+  * @param decoder The decoder.
+  * @param frame GLCD_WIDTH * GLCD_HEIGHT RGB565 pixels the tiles are decoded into.
+  * @returns Void.
+  */
+void mirrorDecoderInitialize(mirrorDecoder* decoder, uint16_t* frame){
+	memset(decoder, 0, sizeof(*decoder));
+	decoder->frame = frame;
+}
+
+/**
+  * @brief Decodes the complete message held by a decoder into its frame.
+  * @param decoder The decoder.
+  * @returns true on success, false if the message is malformed.
+  */
+static bool applyTile(mirrorDecoder* decoder){
+	uint32_t tile = decoder->header[1] | ((uint32_t)decoder->header[2] << 8);
+	const uint8_t* payload = decoder->payload;
+	uint16_t pixels[MIRROR_TILE_PIXELS];
+	uint16_t* row;
+	uint32_t i = 0;
+	uint32_t p;
+	uint32_t run;
+	uint16_t color;
+
+	if(tile >= MIRROR_TILES){
+		return false;
+	}
+	switch(decoder->header[3]){
+		case MirrorRaw:
+			if(decoder->payloadLength != MIRROR_TILE_PIXELS * 2){
+				return false;
+			}
+			for(i = 0; i < MIRROR_TILE_PIXELS; i++){
+				pixels[i] = (uint16_t)(payload[2 * i] | (payload[2 * i + 1] << 8));
+			}
+			break;
+		case MirrorSolid:
+			if(decoder->payloadLength != 2){
+				return false;
+			}
+			color = (uint16_t)(payload[0] | (payload[1] << 8));
+			for(i = 0; i < MIRROR_TILE_PIXELS; i++){
+				pixels[i] = color;
+			}
+			break;
+		case MirrorRun:
+			for(p = 0; p + 3 <= decoder->payloadLength; p += 3){
+				run = payload[p] + 1u;
+				color = (uint16_t)(payload[p + 1] | (payload[p + 2] << 8));
+				if(i + run > MIRROR_TILE_PIXELS){
+					return false;
+				}
+				for(; run > 0; run--){
+					pixels[i++] = color;
+				}
+			}
+			if(i != MIRROR_TILE_PIXELS){
+				return false;
+			}
+			break;
+		default:
+			return false;
+	}
+
+	row = decoder->frame + (tile / MIRROR_TILE_COLUMNS) * MIRROR_TILE_SIZE * GLCD_WIDTH
+			+ (tile % MIRROR_TILE_COLUMNS) * MIRROR_TILE_SIZE;
+	for(i = 0; i < MIRROR_TILE_SIZE; i++, row += GLCD_WIDTH){
+		memcpy(row, &pixels[i * MIRROR_TILE_SIZE], MIRROR_TILE_SIZE * sizeof(uint16_t));
+	}
+	return true;
+}
+
+/**
+  * @brief Feeds stream bytes to a decoder, in pieces of any size.
+  *        Bytes before a message start are skipped and counted as errors.
+  * @param decoder The decoder.
+  * @param data,length The received bytes.
+  * @returns Number of frames completed by these bytes.
+  */
+uint32_t mirrorDecode(mirrorDecoder* decoder, const uint8_t* data, uint32_t length){
+	uint32_t frames = 0;
+	uint32_t count;
+
+	while(length > 0){
+		if(decoder->received < MIRROR_HEADER_SIZE){
+			if(decoder->received == 0 && *data != MIRROR_MAGIC){
+				decoder->errors++;
+				data++;
+				length--;
+				continue;
+			}
+			decoder->header[decoder->received++] = *data++;
+			length--;
+			if(decoder->received < MIRROR_HEADER_SIZE){
+				continue;
+			}
+			decoder->payloadLength = decoder->header[4] | ((uint32_t)decoder->header[5] << 8);
+			if(decoder->payloadLength > sizeof(decoder->payload)){
+				decoder->errors++;
+				decoder->received = 0;
+				continue;
+			}
+		}else{
+			count = MIRROR_HEADER_SIZE + decoder->payloadLength - decoder->received;
+			if(count > length){
+				count = length;
+			}
+			memcpy(&decoder->payload[decoder->received - MIRROR_HEADER_SIZE], data, count);
+			decoder->received += count;
+			data += count;
+			length -= count;
+		}
+
+		if(decoder->received == MIRROR_HEADER_SIZE + decoder->payloadLength){
+			if((decoder->header[1] | (decoder->header[2] << 8)) == MIRROR_END_OF_FRAME){
+				frames++;
+			}else if(!applyTile(decoder)){
+				decoder->errors++;
+			}
+			decoder->received = 0;
+		}
+	}
+	return frames;
+}
+
+#ifdef MIRROR_ENABLED
+
+/**
+  * @brief Stream bytes allowed per frame, and the most the tiles of a frame may use:
+  *        the rest is kept for the end of frame marker.
+  */
+#define MIRROR_FRAME_BYTES (MIRROR_BYTES_PER_SECOND / 1000 * MIRROR_FRAME_MS)
+#define MIRROR_TILE_BUDGET (MIRROR_FRAME_BYTES - MIRROR_HEADER_SIZE)
+
+/**
+  * @brief Hash of every tile as last sent, whether it was sent since the last mirrorInvalidate,
+  *        and whether it was drawn on since it was last read.
+  */
+static uint32_t tileHash[MIRROR_TILES];
+static bool tileSent[MIRROR_TILES];
+static volatile bool tileDirty[MIRROR_TILES];
+
+/**
+  * @brief Font of the last GLCD_SetFont, which sets the size of the characters drawn.
+  */
+static GLCD_FONT* activeFont = NULL;
+
+/**
+  * @brief Tile the next scan starts at, so tiles left over by the budget go first,
+  *        and the next tile resent unchanged.
+  */
+static uint32_t scanCursor = 0;
+static uint32_t refreshCursor = 0;
+
+/**
+  * @brief Buffer of the message being sent.
+  */
+static uint8_t message[MIRROR_MAX_MESSAGE];
+
+#ifdef GLCD_SOFT
+/**
+  * @brief File the host build writes the stream to.
+  */
+static FILE* output = NULL;
+#endif
+
+/**
+  * @brief Copies the pixels the display shows in a tile. With GLCD_LAYERS the background shows
+  *        through the keyed HUD pixels.
+  * @param tile Index of the tile.
+  * @param out MIRROR_TILE_PIXELS pixels to fill, row by row.
+  * @returns Void.
+  */
+static void readTile(uint32_t tile, uint16_t* out){
+	const uint16_t* frame = glcdFrameBuffer();
+	uint32_t offset = (tile / MIRROR_TILE_COLUMNS) * MIRROR_TILE_SIZE * GLCD_WIDTH
+			+ (tile % MIRROR_TILE_COLUMNS) * MIRROR_TILE_SIZE;
+	uint32_t row;
+#ifdef GLCD_LAYERS
+	const uint16_t* background = layerBackgroundBuffer();
+	uint32_t col;
+	for(row = 0; row < MIRROR_TILE_SIZE; row++, offset += GLCD_WIDTH){
+		for(col = 0; col < MIRROR_TILE_SIZE; col++){
+			*out++ = (frame[offset + col] == LAYER_KEY_COLOR) ? background[offset + col] : frame[offset + col];
+		}
+	}
+#else
+	for(row = 0; row < MIRROR_TILE_SIZE; row++, offset += GLCD_WIDTH, out += MIRROR_TILE_SIZE){
+		memcpy(out, frame + offset, MIRROR_TILE_SIZE * sizeof(uint16_t));
+	}
+#endif
+}
+
+/**
+  * @brief Hashes the pixels of a tile with FNV-1a.
+  * @param pixels The tile.
+  * @returns 32-bit hash.
+  */
+static uint32_t hashTile(const uint16_t* pixels){
+	uint32_t hash = 2166136261u;
+	uint32_t i;
+	for(i = 0; i < MIRROR_TILE_PIXELS; i++){
+		hash = (hash ^ pixels[i]) * 16777619u;
+	}
+	return hash;
+}
+
+/**
+  * @brief Writes bytes to the stream, waiting while the CDC send buffer is full.
+  * @param data,length The bytes.
+  * @returns Void.
+  */
+static void send(const uint8_t* data, uint32_t length){
+#ifdef GLCD_SOFT
+	if(output != NULL){
+		fwrite(data, 1, length, output);
+	}
+#else
+	int32_t written;
+	while(length > 0){
+		written = USBD_CDC_ACM_WriteData(0, data, (int32_t)length);
+		if(written < 0){
+			return;
+		}
+		if(written == 0){
+			osDelay(1);
+		}
+		data += written;
+		length -= (uint32_t)written;
+	}
+#endif
+}
+
+/**
+  * @brief Encodes and sends one tile, recording what was sent.
+  * @param tile Index of the tile.
+  * @param pixels Its pixels.
+  * @param hash Their hash.
+  * @returns Bytes sent.
+  */
+static uint32_t sendTile(uint32_t tile, const uint16_t* pixels, uint32_t hash){
+	uint32_t length = mirrorEncodeTile(pixels, message, (uint16_t)tile);
+	send(message, length);
+	tileHash[tile] = hash;
+	tileSent[tile] = true;
+	return length;
+}
+
+/**
+  * @brief Marks the tiles a rectangle of the screen touches as drawn on. The part off the screen is ignored.
+  * @param x,y Top left co-ordinates of the rectangle.
+  * @param width,height Size of the rectangle.
+  * @returns Void.
+  */
+void mirrorMarkDirty(uint32_t x, uint32_t y, uint32_t width, uint32_t height){
+	uint32_t firstColumn;
+	uint32_t lastColumn;
+	uint32_t row;
+	uint32_t lastRow;
+	uint32_t column;
+
+	if(x >= GLCD_WIDTH || y >= GLCD_HEIGHT || width == 0 || height == 0){
+		return;
+	}
+	firstColumn = x / MIRROR_TILE_SIZE;
+	lastColumn = ((x + width > GLCD_WIDTH) ? GLCD_WIDTH - 1 : x + width - 1) / MIRROR_TILE_SIZE;
+	lastRow = ((y + height > GLCD_HEIGHT) ? GLCD_HEIGHT - 1 : y + height - 1) / MIRROR_TILE_SIZE;
+	for(row = y / MIRROR_TILE_SIZE; row <= lastRow; row++){
+		for(column = firstColumn; column <= lastColumn; column++){
+			tileDirty[row * MIRROR_TILE_COLUMNS + column] = true;
+		}
+	}
+}
+
+/**
+  * @brief Returns the number of tiles drawn on and not yet read by mirrorFrame.
+  * @param None.
+  * @returns Tiles.
+  */
+uint32_t mirrorDirtyTiles(void){
+	uint32_t count = 0;
+	uint32_t tile;
+	for(tile = 0; tile < MIRROR_TILES; tile++){
+		count += tileDirty[tile];
+	}
+	return count;
+}
+
+/**
+  * @brief Sends the tiles changed since they were last sent, within the frame budget,
+  *        then a few unchanged tiles and the end of frame marker.
+  * @param None.
+  * @returns Bytes sent.
+  */
+uint32_t mirrorFrame(void){
+	uint16_t pixels[MIRROR_TILE_PIXELS];
+	uint32_t sent = 0;
+	uint32_t scanned;
+	uint32_t tile;
+	uint32_t hash;
+	uint32_t i;
+
+	for(scanned = 0; scanned < MIRROR_TILES; scanned++){
+		tile = (scanCursor + scanned) % MIRROR_TILES;
+		if(!tileDirty[tile]){
+			continue;
+		}
+		if(sent + MIRROR_MAX_MESSAGE > MIRROR_TILE_BUDGET){
+			break;
+		}
+		// Cleared before the read, so a draw during the read marks the tile again
+		tileDirty[tile] = false;
+		readTile(tile, pixels);
+		hash = hashTile(pixels);
+		if(tileSent[tile] && hash == tileHash[tile]){
+			continue;
+		}
+		sent += sendTile(tile, pixels, hash);
+	}
+	scanCursor = (scanCursor + scanned) % MIRROR_TILES;
+
+	for(i = 0; i < MIRROR_REFRESH_TILES && sent + MIRROR_MAX_MESSAGE <= MIRROR_TILE_BUDGET; i++){
+		tile = refreshCursor;
+		refreshCursor = (refreshCursor + 1) % MIRROR_TILES;
+		readTile(tile, pixels);
+		sent += sendTile(tile, pixels, hashTile(pixels));
+	}
+
+	writeHeader(message, MIRROR_END_OF_FRAME, MirrorRaw, 0);
+	send(message, MIRROR_HEADER_SIZE);
+	return sent + MIRROR_HEADER_SIZE;
+}
+
+/**
+  * @brief Marks every tile as changed, so the following frames send the whole screen.
+  * @param None.
+  * @returns Void.
+  */
+void mirrorInvalidate(void){
+	memset(tileSent, 0, sizeof(tileSent));
+	mirrorMarkDirty(0, 0, GLCD_WIDTH, GLCD_HEIGHT);
+}
+
+/**
+  * @brief Clears the screen and marks every tile.
+  */
+int32_t mirrorClearScreen(void){
+	mirrorMarkDirty(0, 0, GLCD_WIDTH, GLCD_HEIGHT);
+	return GLCD_ClearScreen();
+}
+
+/**
+  * @brief Sets the font and keeps it to size the characters drawn.
+  */
+int32_t mirrorSetFont(GLCD_FONT* font){
+	activeFont = font;
+	return GLCD_SetFont(font);
+}
+
+/**
+  * @brief Draws one pixel and marks its tile.
+  */
+int32_t mirrorDrawPixel(uint32_t x, uint32_t y){
+	mirrorMarkDirty(x, y, 1, 1);
+	return GLCD_DrawPixel(x, y);
+}
+
+/**
+  * @brief Draws a horizontal line and marks its tiles.
+  */
+int32_t mirrorDrawHLine(uint32_t x, uint32_t y, uint32_t length){
+	mirrorMarkDirty(x, y, length, 1);
+	return GLCD_DrawHLine(x, y, length);
+}
+
+/**
+  * @brief Draws a vertical line and marks its tiles.
+  */
+int32_t mirrorDrawVLine(uint32_t x, uint32_t y, uint32_t length){
+	mirrorMarkDirty(x, y, 1, length);
+	return GLCD_DrawVLine(x, y, length);
+}
+
+/**
+  * @brief Draws a rectangle outline and marks the tiles of its four sides.
+  */
+int32_t mirrorDrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height){
+	if(width > 0 && height > 0){
+		mirrorMarkDirty(x, y, width, 1);
+		mirrorMarkDirty(x, y + height - 1, width, 1);
+		mirrorMarkDirty(x, y, 1, height);
+		mirrorMarkDirty(x + width - 1, y, 1, height);
+	}
+	return GLCD_DrawRectangle(x, y, width, height);
+}
+
+/**
+  * @brief Draws a character and marks the tiles of its cell.
+  */
+int32_t mirrorDrawChar(uint32_t x, uint32_t y, int32_t ch){
+	if(activeFont != NULL){
+		mirrorMarkDirty(x, y, activeFont->width, activeFont->height);
+	}
+	return GLCD_DrawChar(x, y, ch);
+}
+
+/**
+  * @brief Draws a string and marks the tiles of its cells.
+  */
+int32_t mirrorDrawString(uint32_t x, uint32_t y, const char* str){
+	if(activeFont != NULL){
+		mirrorMarkDirty(x, y, strlen(str) * activeFont->width, activeFont->height);
+	}
+	return GLCD_DrawString(x, y, str);
+}
+
+/**
+  * @brief Draws a bargraph and marks its tiles.
+  */
+int32_t mirrorDrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val){
+	mirrorMarkDirty(x, y, width, height);
+	return GLCD_DrawBargraph(x, y, width, height, val);
+}
+
+/**
+  * @brief Draws a bitmap and marks its tiles.
+  */
+int32_t mirrorDrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap){
+	mirrorMarkDirty(x, y, width, height);
+	return GLCD_DrawBitmap(x, y, width, height, bitmap);
+}
+
+/**
+  * @brief Scrolls the screen and marks every tile.
+  */
+int32_t mirrorVScroll(uint32_t dy){
+	mirrorMarkDirty(0, 0, GLCD_WIDTH, GLCD_HEIGHT);
+	return GLCD_VScroll(dy);
+}
+
+#ifdef GLCD_SOFT
+
+/**
+  * @brief Sets the file the stream is written to.
+  * @param file An open file, NULL to drop the stream.
+  * @returns Void.
+  */
+void mirrorSetOutput(FILE* file){
+	output = file;
+}
+
+/**
+  * @brief Starts mirroring from the first frame.
+  * @param None.
+  * @returns Void.
+  */
+void mirrorInitialize(void){
+	mirrorInvalidate();
+}
+
+#else
+
+/**
+  * @brief A function that sends a frame every MIRROR_FRAME_MS while a viewer has the port open,
+  *        starting over with the whole screen each time the port is configured.
+  * @param argument Unused.
+  * @returns Void.
+  */
+static void mirrorTask(void const* argument){
+	bool configured = false;
+	stackWatchAddCurrent("mirror", STACK_WATCH_DEFAULT_SIZE);
+	for(;;){
+		if(USBD_Configured(0)){
+			if(!configured){
+				mirrorInvalidate();
+				configured = true;
+			}
+			mirrorFrame();
+		}else{
+			configured = false;
+		}
+		osDelay(MIRROR_FRAME_MS);
+	}
+}
+
+/**
+  * @brief Defines the mirror thread below the UI threads.
+  */
+osThreadDef(mirrorTask, osPriorityBelowNormal, 1, 0);
+
+/**
+  * @brief Starts the USB device and the mirror thread.
+  * @param None.
+  * @returns Void.
+  */
+void mirrorInitialize(void){
+	USBD_Initialize(0);
+	USBD_Connect(0);
+	mirrorInvalidate();
+	traceName(osThreadCreate(osThread(mirrorTask), NULL), "mirror");
+}
+
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/**
+  * @file mirror.h
+  * @brief Header file of the mirror.c source file.
+  *        The stream is a sequence of messages, all numbers little-endian:
+  *        0xA5, tile index (2 bytes), encoding (1 byte), payload length (2 bytes), payload.
+  *        Tiles are MIRROR_TILE_SIZE pixels square and numbered row by row. Encodings:
+  *        MirrorRaw sends every RGB565 pixel, MirrorSolid one colour for the whole tile,
+  *        MirrorRun pairs of (run length - 1, colour) in 3 bytes. Tile index MIRROR_END_OF_FRAME closes a frame.
+  *        Included from main.h; with MIRROR_ENABLED defined every GLCD drawing call in the project marks the
+  *        tiles it draws on, and code writing the frame buffer directly calls mirrorMarkDirty.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef MIRROR_H
+#define MIRROR_H
+
+#include <stdint.h>
+#ifdef GLCD_SOFT
+#include <stdio.h>
+#endif
+#include "GLCD_Config.h"
+#include "glcd_l8.h"
+
+/**
+  * @brief Stream the display over the USB CDC port.
+  *        Uncomment after adding the USB Device CDC component, and count its threads in RTX_Conf_CM.c.
+  */
+//#define MIRROR_ENABLED
+
+/**
+  * @brief Side of one tile in pixels, and the tile grid it makes.
+  */
+#define MIRROR_TILE_SIZE    16
+#define MIRROR_TILE_PIXELS  (MIRROR_TILE_SIZE * MIRROR_TILE_SIZE)
+#define MIRROR_TILE_COLUMNS ((GLCD_WIDTH + MIRROR_TILE_SIZE - 1) / MIRROR_TILE_SIZE)
+#define MIRROR_TILE_ROWS    ((GLCD_HEIGHT + MIRROR_TILE_SIZE - 1) / MIRROR_TILE_SIZE)
+#define MIRROR_TILES        (MIRROR_TILE_COLUMNS * MIRROR_TILE_ROWS)
+
+/**
+  * @brief Time between two mirrored frames, in milliseconds.
+  */
+#define MIRROR_FRAME_MS 100
+
+/**
+  * @brief Bytes the stream may use per second, well under what a full-speed CDC port carries.
+  *        Tiles that do not fit in a frame are sent in the next one.
+  */
+#define MIRROR_BYTES_PER_SECOND 400000
+
+/**
+  * @brief Unchanged tiles resent each frame, so a viewer that connects late still gets the whole screen.
+  */
+#define MIRROR_REFRESH_TILES 2
+
+/**
+  * @brief Framing of the stream.
+  */
+#define MIRROR_MAGIC        0xA5
+#define MIRROR_HEADER_SIZE  6
+#define MIRROR_END_OF_FRAME 0xFFFF
+
+/**
+  * @brief An enum containing the tile encodings.
+  */
+enum mirrorEncoding{
+	MirrorRaw,
+	MirrorSolid,
+	MirrorRun
+};
+
+/**
+  * @brief A struct containing the state of a stream decoder.
+  */
+typedef struct{
+	uint16_t* frame;
+	uint8_t header[MIRROR_HEADER_SIZE];
+	uint8_t payload[MIRROR_TILE_PIXELS * 2];
+	uint32_t received;
+	uint32_t payloadLength;
+	uint32_t errors;
+	}mirrorDecoder;
+
+#ifdef MIRROR_ENABLED
+
+#ifdef GLCD_L8
+#error "MIRROR_ENABLED needs the RGB565 frame buffer, undefine GLCD_L8"
+#endif
+
+void mirrorInitialize(void);
+uint32_t mirrorFrame(void);
+void mirrorInvalidate(void);
+void mirrorMarkDirty(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+uint32_t mirrorDirtyTiles(void);
+#ifdef GLCD_SOFT
+void mirrorSetOutput(FILE* output);
+#endif
+
+int32_t mirrorClearScreen(void);
+int32_t mirrorSetFont(GLCD_FONT* font);
+int32_t mirrorDrawPixel(uint32_t x, uint32_t y);
+int32_t mirrorDrawHLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t mirrorDrawVLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t mirrorDrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+int32_t mirrorDrawChar(uint32_t x, uint32_t y, int32_t ch);
+int32_t mirrorDrawString(uint32_t x, uint32_t y, const char* str);
+int32_t mirrorDrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val);
+int32_t mirrorDrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap);
+int32_t mirrorVScroll(uint32_t dy);
+
+#ifndef MIRROR_NO_REDIRECT
+#define GLCD_ClearScreen()                        mirrorClearScreen()
+#define GLCD_SetFont(font)                        mirrorSetFont(font)
+#define GLCD_DrawPixel(x, y)                      mirrorDrawPixel(x, y)
+#define GLCD_DrawHLine(x, y, length)              mirrorDrawHLine(x, y, length)
+#define GLCD_DrawVLine(x, y, length)              mirrorDrawVLine(x, y, length)
+#define GLCD_DrawRectangle(x, y, width, height)   mirrorDrawRectangle(x, y, width, height)
+#define GLCD_DrawChar(x, y, ch)                   mirrorDrawChar(x, y, ch)
+#define GLCD_DrawString(x, y, str)                mirrorDrawString(x, y, str)
+#define GLCD_DrawBargraph(x, y, width, height, val) mirrorDrawBargraph(x, y, width, height, val)
+#define GLCD_DrawBitmap(x, y, width, height, bitmap) mirrorDrawBitmap(x, y, width, height, bitmap)
+#define GLCD_VScroll(dy)                          mirrorVScroll(dy)
+#endif
+
+#else
+
+#define mirrorInitialize()
+#define mirrorMarkDirty(x, y, width, height) ((void)(x), (void)(y), (void)(width), (void)(height))
+
+#endif
+
+uint32_t mirrorEncodeTile(const uint16_t* pixels, uint8_t* out, uint16_t tile);
+void mirrorDecoderInitialize(mirrorDecoder* decoder, uint16_t* frame);
+uint32_t mirrorDecode(mirrorDecoder* decoder, const uint8_t* data, uint32_t length);
+
+#endif
@@ -0,0 +1,121 @@
+/**
+  * @file number_format.c
+  * @brief Define functions that turn integers into fixed-width, right-aligned text without the C library,
+  *        and find which characters of a shown number need redrawing.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <string.h>
+#include "number_format.h"
+
+/**
+  * @brief The two digits of every number from 0 to 99, so each division produces two characters.
+  */
+static const char digitPairs[200] =
+	"0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+	"5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+/**
+  * @brief Writes the decimal digits of a number backwards from the end of a buffer.
+  * @param end One past the last character to write.
+  * @param value The number.
+  * @returns Pointer to the first digit written.
+  */
+static char* writeDigits(char* end, uint32_t value){
+	uint32_t pair;
+	while(value >= 100){
+		pair = (value % 100) * 2;
+		value /= 100;
+		*--end = digitPairs[pair + 1];
+		*--end = digitPairs[pair];
+	}
+	if(value >= 10){
+		*--end = digitPairs[value * 2 + 1];
+		*--end = digitPairs[value * 2];
+	}else{
+		*--end = (char)('0' + value);
+	}
+	return end;
+}
+
+/**
+  * @brief Copies formatted text into a field, padding it on the left with spaces.
+  *        A field too narrow for the text is filled with '#'.
+  * @param out The field, width characters and a terminator.
+  * @param width Number of characters in the field.
+  * @param text,length The formatted text.
+  * @returns 0 on success, -1 if the text did not fit.
+  */
+static int fillField(char* out, unsigned int width, const char* text, unsigned int length){
+	if(length > width){
+		memset(out, '#', width);
+		out[width] = '\0';
+		return -1;
+	}
+	memset(out, ' ', width - length);
+	memcpy(out + width - length, text, length);
+	out[width] = '\0';
+	return 0;
+}
+
+/**
+  * @brief Formats an unsigned number right-aligned in a fixed-width field.
+  * @param out Buffer of at least width + 1 characters.
+  * @param width Number of characters to write, 1 to FORMAT_MAX_WIDTH.
+  * @param value The number.
+  * @returns 0 on success, -1 if the width is invalid or the number did not fit.
+  */
+int formatUnsigned(char* out, unsigned int width, uint32_t value){
+	char digits[FORMAT_UNSIGNED_WIDTH];
+	char* first;
+
+	if(width == 0 || width > FORMAT_MAX_WIDTH){
+		return -1;
+	}
+	first = writeDigits(digits + sizeof(digits), value);
+	return fillField(out, width, first, (unsigned int)(digits + sizeof(digits) - first));
+}
+
+/**
+  * @brief Formats a signed number right-aligned in a fixed-width field, with a minus sign when negative.
+  * @param out Buffer of at least width + 1 characters.
+  * @param width Number of characters to write, 1 to FORMAT_MAX_WIDTH.
+  * @param value The number.
+  * @returns 0 on success, -1 if the width is invalid or the number did not fit.
+  */
+int formatSigned(char* out, unsigned int width, int32_t value){
+	char digits[FORMAT_SIGNED_WIDTH];
+	char* first;
+	// Negating in unsigned arithmetic keeps INT32_MIN in range
+	uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+
+	if(width == 0 || width > FORMAT_MAX_WIDTH){
+		return -1;
+	}
+	first = writeDigits(digits + sizeof(digits), magnitude);
+	if(value < 0){
+		*--first = '-';
+	}
+	return fillField(out, width, first, (unsigned int)(digits + sizeof(digits) - first));
+}
+
+/**
+  * @brief Finds the characters that differ between the shown text and the next text, and updates the shown text.
+  * @param shown The text on screen, width characters; overwritten with next.
+  * @param next The text to show.
+  * @param width Number of characters to compare, at most FORMAT_MAX_WIDTH.
+  * @returns Bit i set when character i changed, counting from the left.
+  */
+uint32_t formatChanges(char* shown, const char* next, unsigned int width){
+	uint32_t changed = 0;
+	unsigned int i;
+	for(i = 0; i < width && i < FORMAT_MAX_WIDTH; i++){
+		if(shown[i] != next[i]){
+			changed |= 1u << i;
+			shown[i] = next[i];
+		}
+	}
+	return changed;
+}
@@ -0,0 +1,34 @@
+/**
+  * @file number_format.h
+  * @brief Header file of the number_format.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef NUMBER_FORMAT_H
+#define NUMBER_FORMAT_H
+
+#include <stdint.h>
+
+/**
+  * @brief Most digits of a 32-bit unsigned number.
+  */
+#define FORMAT_UNSIGNED_WIDTH 10
+
+/**
+  * @brief Most characters of a 32-bit signed number, including the minus sign.
+  */
+#define FORMAT_SIGNED_WIDTH 11
+
+/**
+  * @brief Widest field the functions accept, a buffer needs one more byte for the terminator.
+  *        The change mask has one bit per position, so it must stay below 32.
+  */
+#define FORMAT_MAX_WIDTH 16
+
+int formatUnsigned(char* out, unsigned int width, uint32_t value);
+int formatSigned(char* out, unsigned int width, int32_t value);
+uint32_t formatChanges(char* shown, const char* next, unsigned int width);
+
+#endif
@@ -0,0 +1,478 @@
+/**
+  * @file platform.c
+  * @brief Define functions that set up the Cortex-M7 core: the MPU map of the SDRAM, the
+  *        instruction and data caches with the cache maintenance the DMA2D transfers use,
+  *        and the clock profiles of clock_tree.c.
+  *        The default memory map makes the SDRAM device memory, which is never cached and faults on
+  *        unaligned accesses, so the MPU remaps it as normal memory before the caches are turned on.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "main.h"
+#include "platform.h"
+#ifdef PLATFORM_BENCHMARK
+#include "glyph_atlas.h"
+#include "score_font.h"
+#include "pool.h"
+#include <stdlib.h>
+#endif
+
+/**
+  * @brief Whether the SDRAM is mapped non-cacheable, as CACHE_SDRAM_NONCACHEABLE selects.
+  */
+#ifdef CACHE_SDRAM_NONCACHEABLE
+#define SDRAM_NONCACHEABLE true
+#else
+#define SDRAM_NONCACHEABLE false
+#endif
+
+/**
+  * @brief The profile the clocks run in.
+  */
+static enum clockProfile activeProfile = PLATFORM_DEFAULT_PROFILE;
+
+/**
+  * @brief Set once platformSetProfile has configured the clocks.
+  */
+static bool clocksConfigured = false;
+
+/**
+  * @brief Maps the SDRAM as normal memory, write-through or non-cacheable, and never executable.
+  * @param nonCacheable true for non-cacheable, false for write-through.
+  * @returns Void.
+  */
+static void configureSdramRegion(bool nonCacheable){
+	MPU_Region_InitTypeDef region;
+
+	HAL_MPU_Disable();
+	region.Enable = MPU_REGION_ENABLE;
+	region.Number = MPU_REGION_NUMBER0;
+	region.BaseAddress = SDRAM_BASE;
+	region.Size = MPU_REGION_SIZE_8MB;
+	region.SubRegionDisable = 0x00;
+	region.AccessPermission = MPU_REGION_FULL_ACCESS;
+	region.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+	region.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+	region.TypeExtField = nonCacheable ? MPU_TEX_LEVEL1 : MPU_TEX_LEVEL0;
+	region.IsCacheable = nonCacheable ? MPU_ACCESS_NOT_CACHEABLE : MPU_ACCESS_CACHEABLE;
+	region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+	HAL_MPU_ConfigRegion(&region);
+	HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
+/**
+  * @brief Maps the SDRAM and turns the caches on. Call first in main, before HAL_Init.
+  * @param None.
+  * @returns Void.
+  */
+void platformInitialize(void){
+	configureSdramRegion(SDRAM_NONCACHEABLE);
+#ifdef CACHE_ENABLED
+	SCB_EnableICache();
+	SCB_EnableDCache();
+#endif
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief Returns the HAL code of an AHB divider.
+  * @param divider 1 to 512.
+  * @returns RCC_SYSCLK_DIVn.
+  */
+static uint32_t ahbDividerCode(uint32_t divider){
+	switch(divider){
+		case 2: return RCC_SYSCLK_DIV2;
+		case 4: return RCC_SYSCLK_DIV4;
+		case 8: return RCC_SYSCLK_DIV8;
+		case 16: return RCC_SYSCLK_DIV16;
+		case 64: return RCC_SYSCLK_DIV64;
+		case 128: return RCC_SYSCLK_DIV128;
+		case 256: return RCC_SYSCLK_DIV256;
+		case 512: return RCC_SYSCLK_DIV512;
+		default: return RCC_SYSCLK_DIV1;
+	}
+}
+
+/**
+  * @brief Returns the HAL code of an APB divider.
+  * @param divider 1 to 16.
+  * @returns RCC_HCLK_DIVn.
+  */
+static uint32_t apbDividerCode(uint32_t divider){
+	switch(divider){
+		case 2: return RCC_HCLK_DIV2;
+		case 4: return RCC_HCLK_DIV4;
+		case 8: return RCC_HCLK_DIV8;
+		case 16: return RCC_HCLK_DIV16;
+		default: return RCC_HCLK_DIV1;
+	}
+}
+
+/**
+  * @brief Returns the HAL code of a regulator voltage scale.
+  * @param scale 1 to 3.
+  * @returns PWR_REGULATOR_VOLTAGE_SCALEn.
+  */
+static uint32_t voltageScaleCode(uint32_t scale){
+	switch(scale){
+		case 1: return PWR_REGULATOR_VOLTAGE_SCALE1;
+		case 2: return PWR_REGULATOR_VOLTAGE_SCALE2;
+		default: return PWR_REGULATOR_VOLTAGE_SCALE3;
+	}
+}
+
+/**
+  * @brief Sets the SDRAM refresh count, once the display driver has started the SDRAM controller.
+  * @param count Value of the COUNT field.
+  * @returns Void.
+  */
+static void setSdramRefresh(uint32_t count){
+	if((RCC->AHB3ENR & RCC_AHB3ENR_FMCEN) == 0 || (FMC_Bank5_6->SDRTR & FMC_SDRTR_COUNT) == 0){
+		return;
+	}
+	FMC_Bank5_6->SDRTR = (FMC_Bank5_6->SDRTR & ~FMC_SDRTR_COUNT) | (count << FMC_SDRTR_COUNT_Pos);
+}
+
+/**
+  * @brief Switches the clocks to a profile and updates everything that depends on them:
+  *        flash wait states, the kernel tick, the servo timer prescalers, the ADC clock divider and
+  *        the SDRAM refresh. osKernelSysTick still converts with the OS_CLOCK it was built with.
+  *        Called by SystemClock_Config at start-up, and safe to call again at run time.
+  * @param profile The profile to run in.
+  * @returns 0 on success, -1 if the profile is not valid or the clocks did not start.
+  */
+int platformSetProfile(enum clockProfile profile){
+	const clockTree* tree = clockProfileTree(profile);
+	RCC_OscInitTypeDef oscillators = {0};
+	RCC_ClkInitTypeDef clocks = {0};
+	uint32_t hclk;
+	uint32_t refresh;
+
+	if(tree == NULL || clockValidate(tree) != 0){
+		return -1;
+	}
+	hclk = clockHclk(tree);
+	refresh = clockSdramRefreshCount(hclk);
+	// Refresh often enough for both the old and the new clock while switching
+	if(clocksConfigured && refresh < clockSdramRefreshCount(SystemCoreClock)){
+		setSdramRefresh(refresh);
+	}
+
+	// The PLL and the voltage scale can only change while the core runs from the HSE
+	oscillators.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+	oscillators.HSEState = RCC_HSE_ON;
+	oscillators.PLL.PLLState = RCC_PLL_NONE;
+	if(HAL_RCC_OscConfig(&oscillators) != HAL_OK){
+		return -1;
+	}
+	clocks.ClockType = RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+	clocks.SYSCLKSource = RCC_SYSCLKSOURCE_HSE;
+	clocks.AHBCLKDivider = RCC_SYSCLK_DIV1;
+	clocks.APB1CLKDivider = RCC_HCLK_DIV1;
+	clocks.APB2CLKDivider = RCC_HCLK_DIV1;
+	HAL_RCC_ClockConfig(&clocks, __HAL_FLASH_GET_LATENCY());
+	HAL_PWREx_DisableOverDrive();
+	__HAL_RCC_PLL_DISABLE();
+	while(__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY)){
+	}
+	__HAL_PWR_VOLTAGESCALING_CONFIG(voltageScaleCode(tree->voltageScale));
+
+	oscillators.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+	oscillators.PLL.PLLState = RCC_PLL_ON;
+	oscillators.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+	oscillators.PLL.PLLM = tree->pllm;
+	oscillators.PLL.PLLN = tree->plln;
+	oscillators.PLL.PLLP = tree->pllp;
+	oscillators.PLL.PLLQ = tree->pllq;
+	if(HAL_RCC_OscConfig(&oscillators) != HAL_OK){
+		return -1;
+	}
+	if(tree->overDrive && HAL_PWREx_EnableOverDrive() != HAL_OK){
+		return -1;
+	}
+	clocks.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+	clocks.AHBCLKDivider = ahbDividerCode(tree->ahbDivider);
+	clocks.APB1CLKDivider = apbDividerCode(tree->apb1Divider);
+	clocks.APB2CLKDivider = apbDividerCode(tree->apb2Divider);
+	if(HAL_RCC_ClockConfig(&clocks, clockFlashLatency(hclk)) != HAL_OK){
+		return -1;
+	}
+	activeProfile = profile;
+	clocksConfigured = true;
+
+	platformRetuneTick();
+	// Loaded at the next update event, so the running servo pulse is not cut short
+	TIM3->PSC = platformServoPrescaler();
+	TIM12->PSC = platformServoPrescaler();
+	ADC123_COMMON->CCR = (ADC123_COMMON->CCR & ~ADC_CCR_ADCPRE) | platformAdcPrescaler();
+	setSdramRefresh(refresh);
+	return 0;
+}
+
+/**
+  * @brief Sets the SysTick reload for SystemCoreClock without losing the tick in progress.
+  *        A new reload only applies from the next tick and the count cannot be rescaled, so the count
+  *        is restarted, and if more than half of the tick had passed the tick is taken now.
+  *        Every tick stays within half a tick of where it should be. Called by HAL_InitTick whenever
+  *        HAL_RCC_ClockConfig changes the core clock.
+  * @param None.
+  * @returns Void.
+  */
+void platformRetuneTick(void){
+	uint32_t reload = clockSysTickReload(SystemCoreClock, CLOCK_TICK_HZ);
+	uint32_t oldReload = SysTick->LOAD;
+	uint32_t elapsed;
+
+	if(reload == oldReload){
+		return;
+	}
+	elapsed = oldReload - SysTick->VAL;
+	SysTick->LOAD = reload;
+	SysTick->VAL = 0;
+	if((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) != 0 && elapsed > oldReload / 2){
+		SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+	}
+}
+
+/**
+  * @brief Returns the profile the clocks run in.
+  * @param None.
+  * @returns The profile.
+  */
+enum clockProfile platformProfile(void){
+	return activeProfile;
+}
+
+/**
+  * @brief Returns the servo timer prescaler that gives CLOCK_SERVO_TICK_HZ in the current profile.
+  * @param None.
+  * @returns Prescaler register value.
+  */
+uint32_t platformServoPrescaler(void){
+	return clockTimerPrescaler(clockApb1TimerClock(clockProfileTree(activeProfile)), CLOCK_SERVO_TICK_HZ);
+}
+
+/**
+  * @brief Returns the ADC clock prescaler that keeps the ADC within CLOCK_ADC_MAX_HZ in the current profile.
+  * @param None.
+  * @returns ADC_CLOCKPRESCALER_PCLK_DIVn.
+  */
+uint32_t platformAdcPrescaler(void){
+	switch(clockAdcDivider(clockPclk2(clockProfileTree(activeProfile)))){
+		case 2: return ADC_CLOCKPRESCALER_PCLK_DIV2;
+		case 4: return ADC_CLOCKPRESCALER_PCLK_DIV4;
+		case 6: return ADC_CLOCKPRESCALER_PCLK_DIV6;
+		default: return ADC_CLOCKPRESCALER_PCLK_DIV8;
+	}
+}
+
+#ifdef CACHE_ENABLED
+
+/**
+  * @brief Widens a region to whole cache lines.
+  * @param address Start of the region, moved down to a line boundary.
+  * @param size Bytes in the region, grown to cover the last line.
+  * @returns Void.
+  */
+static void alignToLines(uint32_t* address, int32_t* size){
+	*size += (int32_t)(*address & (CACHE_LINE_SIZE - 1));
+	*address &= ~(uint32_t)(CACHE_LINE_SIZE - 1);
+}
+
+/**
+  * @brief Writes the cached changes of a region to memory, before a DMA transfer reads it.
+  * @param address Start of the region.
+  * @param size Bytes in the region.
+  * @returns Void.
+  */
+void cacheClean(const void* address, uint32_t size){
+	uint32_t start = (uint32_t)address;
+	int32_t length = (int32_t)size;
+	alignToLines(&start, &length);
+	SCB_CleanDCache_by_Addr((uint32_t*)start, length);
+}
+
+/**
+  * @brief Drops the cached copy of a region, after a DMA transfer wrote it.
+  *        Whole lines are dropped, so the region should not share a line with data the CPU has changed.
+  * @param address Start of the region.
+  * @param size Bytes in the region.
+  * @returns Void.
+  */
+void cacheInvalidate(void* address, uint32_t size){
+	uint32_t start = (uint32_t)address;
+	int32_t length = (int32_t)size;
+	alignToLines(&start, &length);
+	SCB_InvalidateDCache_by_Addr((uint32_t*)start, length);
+}
+
+/**
+  * @brief Writes the cached changes of a region to memory and drops the cached copy,
+  *        before a DMA transfer writes it.
+  * @param address Start of the region.
+  * @param size Bytes in the region.
+  * @returns Void.
+  */
+void cacheCleanInvalidate(void* address, uint32_t size){
+	uint32_t start = (uint32_t)address;
+	int32_t length = (int32_t)size;
+	alignToLines(&start, &length);
+	SCB_CleanInvalidateDCache_by_Addr((uint32_t*)start, length);
+}
+
+#endif
+
+#ifdef PLATFORM_BENCHMARK
+
+/**
+  * @brief Number of ADC reads in the averaging loop, the analog thread reads 100000 per sensor.
+  */
+#define BENCHMARK_ADC_READS 10000
+
+/**
+  * @brief End of the 16 KB ITCM, code below it runs from the ITCM.
+  */
+#define BENCHMARK_ITCM_END 0x00004000
+
+/**
+  * @brief Stores the ADC averaging result, so the loop is not optimised out.
+  */
+static volatile uint32_t benchmarkSink;
+
+/**
+  * @brief Averages ADC reads with the sensor filter of analogTask, which runs from the ITCM.
+  * @param None.
+  * @returns Void.
+  */
+static void benchmarkAdc(void){
+	int average = 0;
+	sensorAverage(ADC_CHANNEL_0, BENCHMARK_ADC_READS, &average);
+	benchmarkSink = (uint32_t)average;
+}
+
+/**
+  * @brief Draws ten digits from the glyph atlas.
+  * @param None.
+  * @returns Void.
+  */
+static void benchmarkGlyphs(void){
+	atlasDrawString(0, 0, "0123456789");
+}
+
+/**
+  * @brief Draws ten digits in the score font.
+  * @param None.
+  * @returns Void.
+  */
+static void benchmarkScore(void){
+	scoreFontDrawString(0, 0, "0123456789", GLCD_COLOR_YELLOW, GLCD_COLOR_BLACK);
+}
+
+/**
+  * @brief Clears the whole frame buffer.
+  * @param None.
+  * @returns Void.
+  */
+static void benchmarkClear(void){
+	GLCD_ClearScreen();
+}
+
+/**
+  * @brief Allocation and free pairs in the allocator loops, each of the size of the home screen buffer.
+  */
+#define BENCHMARK_ALLOCATIONS 100
+
+/**
+  * @brief Allocates and frees a block from the pools over and over.
+  * @param None.
+  * @returns Void.
+  */
+static void benchmarkPool(void){
+	int i;
+	void* block;
+	for(i = 0; i < BENCHMARK_ALLOCATIONS; i++){
+		block = poolAlloc(13, POOL_TAG('B', 'N', 'C', 'H'));
+		poolFree(block);
+	}
+}
+
+/**
+  * @brief Allocates and frees a block from the heap over and over.
+  * @param None.
+  * @returns Void.
+  */
+static void benchmarkMalloc(void){
+	int i;
+	void* block;
+	for(i = 0; i < BENCHMARK_ALLOCATIONS; i++){
+		block = malloc(13);
+		benchmarkSink = (uint32_t)block;
+		free(block);
+	}
+}
+
+/**
+  * @brief Returns the cycles one run of a loop takes.
+  * @param loop The loop.
+  * @returns Cycles.
+  */
+static uint32_t measure(void (*loop)(void)){
+	uint32_t start;
+	// The first run fills the caches and decodes the score glyphs
+	loop();
+	start = DWT->CYCCNT;
+	loop();
+	return DWT->CYCCNT - start;
+}
+
+/**
+  * @brief Measures representative loops with the caches off, then on with the SDRAM mapped write-through
+  *        and non-cacheable, and writes the cycles as CSV. The first line names the memory the sensor filter
+  *        runs from: build once with and once without TCM_ENABLED to compare the functions moved to the ITCM.
+  *        Needs the ADC running, the display initialised and the glyph atlas built. Leaves the caches and the
+  *        SDRAM mapping as CACHE_ENABLED and CACHE_SDRAM_NONCACHEABLE set them, and the screen drawn over.
+  * @param out The stream to write to.
+  * @returns Void.
+  */
+void platformBenchmark(FILE* out){
+	static const char* const names[] = {"adc_average", "glyph_draw", "score_draw", "clear_screen", "pool_alloc_free", "malloc_free"};
+	static void (*const loops[])(void) = {benchmarkAdc, benchmarkGlyphs, benchmarkScore, benchmarkClear, benchmarkPool, benchmarkMalloc};
+	uint32_t uncached[sizeof(loops) / sizeof(loops[0])];
+	uint32_t writeThrough[sizeof(loops) / sizeof(loops[0])];
+	uint32_t nonCacheable;
+	uint32_t filter = (uint32_t)sensorAverage;
+	unsigned int i;
+
+	SCB_DisableDCache();
+	SCB_DisableICache();
+	for(i = 0; i < sizeof(loops) / sizeof(loops[0]); i++){
+		uncached[i] = measure(loops[i]);
+	}
+	configureSdramRegion(false);
+	SCB_EnableICache();
+	SCB_EnableDCache();
+	for(i = 0; i < sizeof(loops) / sizeof(loops[0]); i++){
+		writeThrough[i] = measure(loops[i]);
+	}
+	// Lines cached under the write-through mapping must not outlive it
+	SCB_CleanInvalidateDCache();
+	configureSdramRegion(true);
+	fprintf(out, "# sensorAverage at 0x%08x, in %s\n", (unsigned int)filter, (filter < BENCHMARK_ITCM_END) ? "ITCM" : "flash");
+	fprintf(out, "loop,cycles_uncached,cycles_write_through,cycles_noncacheable\n");
+	for(i = 0; i < sizeof(loops) / sizeof(loops[0]); i++){
+		nonCacheable = measure(loops[i]);
+		fprintf(out, "%s,%u,%u,%u\n", names[i], (unsigned int)uncached[i], (unsigned int)writeThrough[i],
+				(unsigned int)nonCacheable);
+	}
+	SCB_CleanInvalidateDCache();
+	configureSdramRegion(SDRAM_NONCACHEABLE);
+#ifndef CACHE_ENABLED
+	SCB_DisableDCache();
+	SCB_DisableICache();
+#endif
+}
+
+#endif
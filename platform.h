@@ -0,0 +1,92 @@
+/**
+  * @file platform.h
+  * @brief Header file of the platform.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "clock_tree.h"
+
+/**
+  * @brief Run with the Cortex-M7 instruction and data caches on.
+  *        Off by default, as the board has always run, until platformBenchmark has been run on it with
+  *        PLATFORM_BENCHMARK and shows the gain. The cache maintenance of the DMA2D transfers is then compiled out.
+  */
+//#define CACHE_ENABLED
+
+/**
+  * @brief Map the SDRAM as non-cacheable instead of write-through.
+  *        Write-through is the default because it keeps the frame buffers coherent with the LTDC and DMA2D
+  *        for free and still caches the reads of blending and mirroring. That is reasoning, not a measurement:
+  *        platformBenchmark prints the cycles of both mappings to settle it on the board.
+  */
+//#define CACHE_SDRAM_NONCACHEABLE
+
+/**
+  * @brief Measure the loops of platformBenchmark at start-up: uncached, then cached with each SDRAM mapping.
+  */
+//#define PLATFORM_BENCHMARK
+
+/**
+  * @brief Run the functions marked ITCM_CODE from the ITCM and keep the variables marked DTCM_DATA in the DTCM.
+  *        Off by default, leaving them in flash and SRAM1 as before, until platformBenchmark has compared the
+  *        two on the board. Needs the link to use Coursework 2.sct, which lays out the regions, in place of
+  *        --ro-base/--rw-base.
+  */
+//#define TCM_ENABLED
+
+#if defined(TCM_ENABLED) && !defined(GLCD_SOFT)
+#define ITCM_CODE __attribute__((section("itcm_code")))
+#define DTCM_DATA __attribute__((section("dtcm_zi"), zero_init))
+#else
+#define ITCM_CODE
+#define DTCM_DATA
+#endif
+
+/**
+  * @brief Profile SystemClock_Config starts in. OS_CLOCK in RTX_Conf_CM.c must be its core clock.
+  */
+#define PLATFORM_DEFAULT_PROFILE ClockMaxPerformance
+
+/**
+  * @brief Size of a data cache line in bytes, maintenance works on whole lines.
+  */
+#define CACHE_LINE_SIZE 32
+
+/**
+  * @brief The external SDRAM holding the frame buffers.
+  */
+#define SDRAM_BASE 0xC0000000
+#define SDRAM_SIZE 0x00800000
+
+#if defined(CACHE_ENABLED) && !defined(GLCD_SOFT)
+
+void cacheClean(const void* address, uint32_t size);
+void cacheInvalidate(void* address, uint32_t size);
+void cacheCleanInvalidate(void* address, uint32_t size);
+
+#else
+
+#define cacheClean(address, size)
+#define cacheInvalidate(address, size)
+#define cacheCleanInvalidate(address, size)
+
+#endif
+
+void platformInitialize(void);
+int platformSetProfile(enum clockProfile profile);
+void platformRetuneTick(void);
+enum clockProfile platformProfile(void);
+uint32_t platformServoPrescaler(void);
+uint32_t platformAdcPrescaler(void);
+#ifdef PLATFORM_BENCHMARK
+void platformBenchmark(FILE* out);
+#endif
+
+#endif
@@ -0,0 +1,274 @@
+/**
+  * @file pool.c
+  * @brief Define fixed-block memory pools that replace the heap.
+  *        Each pool is a static array of equal blocks. The free blocks form a list through their first word,
+  *        so allocating and freeing take constant time and the pools never fragment. A request is served
+  *        from the smallest pool whose blocks fit it, or from a larger one when that pool is empty.
+  *        The pools may be used from threads and interrupts. Define GLCD_SOFT to build for the host.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdbool.h>
+#include "pool.h"
+#ifndef GLCD_SOFT
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief Storage of the pools, as 64-bit words so every block is 8-byte aligned.
+  */
+static uint64_t smallStorage[POOL_SMALL_BLOCKS * POOL_SMALL_SIZE / 8];
+static uint64_t mediumStorage[POOL_MEDIUM_BLOCKS * POOL_MEDIUM_SIZE / 8];
+static uint64_t largeStorage[POOL_LARGE_BLOCKS * POOL_LARGE_SIZE / 8];
+
+#ifdef POOL_TAGS
+/**
+  * @brief Owner of every block, POOL_TAG_FREE while it is free.
+  */
+static uint32_t smallTags[POOL_SMALL_BLOCKS];
+static uint32_t mediumTags[POOL_MEDIUM_BLOCKS];
+static uint32_t largeTags[POOL_LARGE_BLOCKS];
+#endif
+
+/**
+  * @brief A struct containing a pool: its storage, free list and usage.
+  */
+typedef struct{
+	uint8_t* storage;
+	uint32_t blockSize;
+	uint32_t blocks;
+	uint32_t* tags;
+	void* freeList;
+	uint32_t used;
+	uint32_t highWater;
+	uint32_t failures;
+	}pool;
+
+/**
+  * @brief The pools, indexed by enum poolId.
+  */
+static pool pools[PoolCount] = {
+#ifdef POOL_TAGS
+	{(uint8_t*)smallStorage, POOL_SMALL_SIZE, POOL_SMALL_BLOCKS, smallTags},
+	{(uint8_t*)mediumStorage, POOL_MEDIUM_SIZE, POOL_MEDIUM_BLOCKS, mediumTags},
+	{(uint8_t*)largeStorage, POOL_LARGE_SIZE, POOL_LARGE_BLOCKS, largeTags}
+#else
+	{(uint8_t*)smallStorage, POOL_SMALL_SIZE, POOL_SMALL_BLOCKS, NULL},
+	{(uint8_t*)mediumStorage, POOL_MEDIUM_SIZE, POOL_MEDIUM_BLOCKS, NULL},
+	{(uint8_t*)largeStorage, POOL_LARGE_SIZE, POOL_LARGE_BLOCKS, NULL}
+#endif
+};
+
+/**
+  * @brief Set once poolsInitialize has built the free lists.
+  */
+static bool initialized = false;
+
+/**
+  * @brief Masks interrupts around a change to a free list.
+  * @param None.
+  * @returns The interrupt mask to restore.
+  */
+static uint32_t poolLock(void){
+#ifdef GLCD_SOFT
+	return 0;
+#else
+	uint32_t mask = __get_PRIMASK();
+	__disable_irq();
+	return mask;
+#endif
+}
+
+/**
+  * @brief Restores the interrupt mask poolLock returned.
+  * @param mask The mask.
+  * @returns Void.
+  */
+static void poolUnlock(uint32_t mask){
+#ifndef GLCD_SOFT
+	__set_PRIMASK(mask);
+#else
+	(void)mask;
+#endif
+}
+
+/**
+  * @brief Returns the index of a block in a pool.
+  * @param p The pool.
+  * @param block Address of the block.
+  * @returns The index, -1 if the address is not the start of a block of the pool.
+  */
+static int32_t blockIndex(const pool* p, const void* block){
+	const uint8_t* address = (const uint8_t*)block;
+	uint32_t offset;
+
+	if(address < p->storage || address >= p->storage + p->blockSize * p->blocks){
+		return -1;
+	}
+	offset = (uint32_t)(address - p->storage);
+	if(offset % p->blockSize != 0){
+		return -1;
+	}
+	return (int32_t)(offset / p->blockSize);
+}
+
+/**
+  * @brief Frees every block and clears the usage. Blocks handed out before are lost.
+  * @param None.
+  * @returns Void.
+  */
+void poolsInitialize(void){
+	uint32_t mask = poolLock();
+	unsigned int i;
+	uint32_t block;
+
+	for(i = 0; i < PoolCount; i++){
+		pool* p = &pools[i];
+		p->freeList = NULL;
+		// Linked from the last block down, so blocks are handed out in address order
+		for(block = p->blocks; block > 0; block--){
+			void** entry = (void**)(p->storage + (block - 1) * p->blockSize);
+			*entry = p->freeList;
+			p->freeList = entry;
+#ifdef POOL_TAGS
+			p->tags[block - 1] = POOL_TAG_FREE;
+#endif
+		}
+		p->used = 0;
+		p->highWater = 0;
+		p->failures = 0;
+	}
+	initialized = true;
+	poolUnlock(mask);
+}
+
+/**
+  * @brief Allocates a block.
+  * @param size Bytes needed.
+  * @param tag Owner recorded with the block, any value but POOL_TAG_FREE. Ignored without POOL_TAGS.
+  * @returns The block, NULL if no pool with large enough blocks has one free.
+  */
+void* poolAlloc(size_t size, uint32_t tag){
+	uint32_t mask;
+	unsigned int i;
+	void** block;
+
+	if(!initialized){
+		poolsInitialize();
+	}
+	mask = poolLock();
+	for(i = 0; i < PoolCount; i++){
+		pool* p = &pools[i];
+		if(p->blockSize < size){
+			continue;
+		}
+		if(p->freeList == NULL){
+			p->failures++;
+			continue;
+		}
+		block = (void**)p->freeList;
+		p->freeList = *block;
+		p->used++;
+		if(p->used > p->highWater){
+			p->highWater = p->used;
+		}
+#ifdef POOL_TAGS
+		p->tags[blockIndex(p, block)] = (tag != POOL_TAG_FREE) ? tag : POOL_TAG('?', '?', '?', '?');
+#else
+		(void)tag;
+#endif
+		poolUnlock(mask);
+		return block;
+	}
+	if(size > POOL_LARGE_SIZE){
+		pools[PoolLarge].failures++;
+	}
+	poolUnlock(mask);
+	return NULL;
+}
+
+/**
+  * @brief Returns a block to its pool. NULL is ignored.
+  * @param block A block from poolAlloc.
+  * @returns 0 on success, -1 if it is not a block of a pool or, with POOL_TAGS, it is already free.
+  */
+int poolFree(void* block){
+	uint32_t mask;
+	unsigned int i;
+	int32_t index;
+
+	if(block == NULL){
+		return 0;
+	}
+	mask = poolLock();
+	for(i = 0; i < PoolCount; i++){
+		pool* p = &pools[i];
+		index = blockIndex(p, block);
+		if(index < 0){
+			continue;
+		}
+#ifdef POOL_TAGS
+		if(p->tags[index] == POOL_TAG_FREE){
+			poolUnlock(mask);
+			return -1;
+		}
+		p->tags[index] = POOL_TAG_FREE;
+#endif
+		*(void**)block = p->freeList;
+		p->freeList = block;
+		p->used--;
+		poolUnlock(mask);
+		return 0;
+	}
+	poolUnlock(mask);
+	return -1;
+}
+
+/**
+  * @brief Returns the owner of a block.
+  * @param block A block from poolAlloc.
+  * @returns The tag it was allocated with, POOL_TAG_FREE if it is free, not a block, or POOL_TAGS is off.
+  */
+uint32_t poolOwner(const void* block){
+#ifdef POOL_TAGS
+	unsigned int i;
+	int32_t index;
+
+	for(i = 0; i < PoolCount; i++){
+		index = blockIndex(&pools[i], block);
+		if(index >= 0){
+			return pools[i].tags[index];
+		}
+	}
+#else
+	(void)block;
+#endif
+	return POOL_TAG_FREE;
+}
+
+/**
+  * @brief Copies the usage of a pool.
+  * @param id The pool.
+  * @param stats Filled in, all zero for an unknown pool.
+  * @returns Void.
+  */
+void poolGetStats(enum poolId id, poolStats* stats){
+	const pool* p;
+
+	if((unsigned int)id >= PoolCount){
+		stats->blockSize = 0;
+		stats->blocks = 0;
+		stats->used = 0;
+		stats->highWater = 0;
+		stats->failures = 0;
+		return;
+	}
+	p = &pools[id];
+	stats->blockSize = p->blockSize;
+	stats->blocks = p->blocks;
+	stats->used = p->used;
+	stats->highWater = p->highWater;
+	stats->failures = p->failures;
+}
@@ -0,0 +1,68 @@
+/**
+  * @file pool.h
+  * @brief Header file of the pool.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+  * @brief Record the owner of every allocated block and catch blocks freed twice.
+  *        Comment out to save a word per block.
+  */
+#define POOL_TAGS
+
+/**
+  * @brief Block size in bytes and number of blocks of each pool. Sizes are multiples of 8 and ascending.
+  */
+#define POOL_SMALL_SIZE 16
+#define POOL_SMALL_BLOCKS 16
+#define POOL_MEDIUM_SIZE 64
+#define POOL_MEDIUM_BLOCKS 8
+#define POOL_LARGE_SIZE 256
+#define POOL_LARGE_BLOCKS 4
+
+/**
+  * @brief Packs four characters into an ownership tag, for example POOL_TAG('H', 'O', 'M', 'E').
+  */
+#define POOL_TAG(a, b, c, d) (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | (uint32_t)(d))
+
+/**
+  * @brief Tag of a free block. Owners use any other value.
+  */
+#define POOL_TAG_FREE 0
+
+/**
+  * @brief An enum containing the pools, smallest blocks first.
+  */
+enum poolId{
+	PoolSmall,
+	PoolMedium,
+	PoolLarge,
+	PoolCount
+};
+
+/**
+  * @brief A struct containing the usage of a pool since poolsInitialize.
+  */
+typedef struct{
+	uint32_t blockSize;
+	uint32_t blocks;
+	uint32_t used;
+	uint32_t highWater;
+	uint32_t failures;
+	}poolStats;
+
+void poolsInitialize(void);
+void* poolAlloc(size_t size, uint32_t tag);
+int poolFree(void* block);
+uint32_t poolOwner(const void* block);
+void poolGetStats(enum poolId id, poolStats* stats);
+
+#endif
@@ -0,0 +1,139 @@
+/**
+  * @file prng.c
+  * @brief Define seedable pseudo-random number generators, one stream per subsystem.
+  *        Numbers are reduced to a range with a multiply and shift instead of a division.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "prng.h"
+
+/**
+  * @brief Generator of each subsystem, indexed by enum prngStream.
+  */
+static prngState streams[PrngStreamCount];
+
+/**
+  * @brief Rotates a 32-bit number left.
+  * @param x The number.
+  * @param k Bits to rotate by, 1 to 31.
+  * @returns The rotated number.
+  */
+static uint32_t rotateLeft(uint32_t x, unsigned int k){
+	return (x << k) | (x >> (32 - k));
+}
+
+/**
+  * @brief Returns the next number of a splitmix32 sequence, used to spread a seed over the state.
+  * @param x The sequence position, advanced by the call.
+  * @returns A well mixed 32-bit number.
+  */
+static uint32_t splitMix(uint32_t* x){
+	uint32_t z = (*x += 0x9E3779B9u);
+	z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+	z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+	return z ^ (z >> 16);
+}
+
+/**
+  * @brief Seeds a generator. The same seed always gives the same sequence.
+  * @param state The generator.
+  * @param seed Any 32-bit number.
+  * @returns Void.
+  */
+void prngSeed(prngState* state, uint32_t seed){
+	unsigned int i;
+	for(i = 0; i < 4; i++){
+		state->s[i] = splitMix(&seed);
+	}
+	// An all-zero state would only ever return zero
+	if((state->s[0] | state->s[1] | state->s[2] | state->s[3]) == 0){
+		state->s[0] = 1;
+	}
+}
+
+/**
+  * @brief Seeds every subsystem stream from one seed, each stream getting a different sequence.
+  * @param seed Any 32-bit number.
+  * @returns Void.
+  */
+void prngSeedAll(uint32_t seed){
+	unsigned int i;
+	for(i = 0; i < PrngStreamCount; i++){
+		prngSeed(&streams[i], seed ^ (i * 0x9E3779B9u));
+	}
+}
+
+/**
+  * @brief Returns the generator of a subsystem.
+  * @param stream The subsystem.
+  * @returns The generator.
+  */
+prngState* prngStream(enum prngStream stream){
+	return &streams[stream];
+}
+
+/**
+  * @brief Returns the next number of a generator.
+  * @param state The generator.
+  * @returns A pseudo-random 32-bit number.
+  */
+uint32_t prngNext(prngState* state){
+	uint32_t* s = state->s;
+	uint32_t result = rotateLeft(s[1] * 5, 7) * 9;
+	uint32_t t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotateLeft(s[3], 11);
+	return result;
+}
+
+/**
+  * @brief Returns a number below a bound, taking the high word of a 64-bit product instead of a remainder.
+  * @param state The generator.
+  * @param range The bound.
+  * @returns A number from 0 to range - 1, 0 if range is 0.
+  */
+uint32_t prngBelow(prngState* state, uint32_t range){
+	return (uint32_t)(((uint64_t)prngNext(state) * range) >> 32);
+}
+
+/**
+  * @brief Fills an array with numbers from low to low + range - 1.
+  *        The state stays in registers for the whole batch and is stored once at the end.
+  * @param state The generator.
+  * @param out The array to fill.
+  * @param count Number of values to write.
+  * @param low Smallest value.
+  * @param range Number of different values, low + range - 1 must fit in 16 bits.
+  * @returns Void.
+  */
+void prngFill(prngState* state, uint16_t* out, uint32_t count, uint16_t low, uint32_t range){
+	uint32_t s0 = state->s[0];
+	uint32_t s1 = state->s[1];
+	uint32_t s2 = state->s[2];
+	uint32_t s3 = state->s[3];
+	uint32_t result;
+	uint32_t t;
+
+	for(; count > 0; count--){
+		result = rotateLeft(s1 * 5, 7) * 9;
+		t = s1 << 9;
+		s2 ^= s0;
+		s3 ^= s1;
+		s1 ^= s2;
+		s0 ^= s3;
+		s2 ^= t;
+		s3 = rotateLeft(s3, 11);
+		*out++ = (uint16_t)(low + (((uint64_t)result * range) >> 32));
+	}
+	state->s[0] = s0;
+	state->s[1] = s1;
+	state->s[2] = s2;
+	state->s[3] = s3;
+}
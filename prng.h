@@ -0,0 +1,44 @@
+/**
+  * @file prng.h
+  * @brief Header file of the prng.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef PRNG_H
+#define PRNG_H
+
+#include <stdint.h>
+
+/**
+  * @brief Seed used for every stream at start-up, so each boot draws the same screens.
+  */
+#define PRNG_DEFAULT_SEED 0x5EED2026u
+
+/**
+  * @brief State of one xoshiro128** generator.
+  */
+typedef struct{
+	uint32_t s[4];
+	}prngState;
+
+/**
+  * @brief An enum containing the subsystems with their own random stream,
+  *        so reseeding or drawing from one does not change the others.
+  */
+enum prngStream{
+	PrngBackground,
+	PrngStarfield,
+	PrngTrace,
+	PrngStreamCount
+};
+
+void prngSeed(prngState* state, uint32_t seed);
+void prngSeedAll(uint32_t seed);
+prngState* prngStream(enum prngStream stream);
+uint32_t prngNext(prngState* state);
+uint32_t prngBelow(prngState* state, uint32_t range);
+void prngFill(prngState* state, uint16_t* out, uint32_t count, uint16_t low, uint32_t range);
+
+#endif
@@ -0,0 +1,415 @@
+/**
+  * @file profiler.c
+  * @brief Define functions that measure frame times and drawing costs with the DWT cycle counter.
+  *        Define GLCD_SOFT to build for the host, where a microsecond clock stands in for the cycle counter.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#define PROFILER_NO_REDIRECT
+#include <stdbool.h>
+#include <string.h>
+#include "main.h"
+#ifdef GLCD_SOFT
+#include <time.h>
+#endif
+
+/**
+  * @brief A variable of type GLCD_FONT denoting the font size of 6x8.
+  */
+extern GLCD_FONT 		GLCD_Font_6x8;
+
+/**
+  * @brief Largest cycle gap between two idle loop passes that is still counted as idle time.
+  *        Larger gaps mean a thread or interrupt ran in between.
+  */
+#define PROFILER_IDLE_GAP 64
+
+/**
+  * @brief Cycles spent in the idle demon since start-up.
+  */
+static volatile uint32_t idleCycles = 0;
+
+/**
+  * @brief Cycle counter value of the previous idle loop pass.
+  */
+static uint32_t lastIdle = 0;
+
+/**
+  * @brief Reads the clock all measurements are taken with.
+  * @param None.
+  * @returns The DWT cycle counter, or the monotonic clock in microseconds on the host.
+  */
+static uint32_t profilerClock(void){
+#ifdef GLCD_SOFT
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint32_t)((uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000);
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+/**
+  * @brief Returns how fast profilerClock counts.
+  * @param None.
+  * @returns Clock ticks per microsecond, the core clock in MHz on the target and 1 on the host.
+  */
+static uint32_t profilerTicksPerMicro(void){
+#ifdef GLCD_SOFT
+	return 1;
+#else
+	return SystemCoreClock / 1000000;
+#endif
+}
+
+#ifdef PROFILER_ENABLED
+
+/**
+  * @brief Ring buffer of the most recent frames.
+  */
+static profFrame frames[PROFILER_FRAMES];
+
+/**
+  * @brief Total number of frames recorded, the newest is at (frameCount - 1) % PROFILER_FRAMES.
+  */
+static uint32_t frameCount = 0;
+
+/**
+  * @brief Frame being measured.
+  */
+static profFrame current;
+
+/**
+  * @brief Cycle counter value at the start of the current frame.
+  */
+static uint32_t frameStart;
+
+/**
+  * @brief Longest frame recorded, in cycles.
+  */
+static uint32_t worstCycles = 0;
+
+/**
+  * @brief CPU load in percent over the last measurement window.
+  */
+static uint32_t cpuLoad = 0;
+
+/**
+  * @brief Cycle counter and idle cycles at the start of the CPU load window.
+  */
+static uint32_t loadWindowStart;
+static uint32_t loadWindowIdle;
+
+/**
+  * @brief Font, foreground and background colour last set through the profiler.
+  */
+static GLCD_FONT* activeFont = NULL;
+static uint32_t activeForeground = GLCD_COLOR_WHITE;
+static uint32_t activeBackground = GLCD_COLOR_BLACK;
+
+/**
+  * @brief Converts cycles to microseconds at the current core clock.
+  * @param cycles Number of core clock cycles.
+  * @returns Time in microseconds.
+  */
+static uint32_t cyclesToMicros(uint32_t cycles){
+	return cycles / profilerTicksPerMicro();
+}
+
+/**
+  * @brief Enables the DWT cycle counter used for all measurements.
+  * @param None.
+  * @returns Void.
+  */
+void profilerInitialize(void){
+#ifndef GLCD_SOFT
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+	loadWindowStart = profilerClock();
+	loadWindowIdle = idleCycles;
+}
+
+/**
+  * @brief Starts measuring a frame.
+  * @param None.
+  * @returns Void.
+  */
+void profFrameBegin(void){
+	memset(&current, 0, sizeof(current));
+	frameStart = profilerClock();
+}
+
+/**
+  * @brief Draws the frame time and CPU load into the bottom border strip.
+  * @param None.
+  * @returns Void.
+  */
+static void drawOverlay(void){
+#ifdef PROFILER_OVERLAY
+	char text[48];
+	sprintf(text, "frame %5uus worst %5uus cpu %3u%%", (unsigned int)profLastFrameMicros(),
+			(unsigned int)profWorstFrameMicros(), (unsigned int)cpuLoad);
+	GLCD_SetFont(&GLCD_Font_6x8);
+	GLCD_SetForegroundColor(GLCD_COLOR_WHITE);
+	GLCD_SetBackgroundColor(GLCD_COLOR_DARK_GREY);
+	GLCD_DrawString(20, GLCD_HEIGHT - 11, text);
+	// Put the drawing state back the way the screen code left it
+	if(activeFont != NULL){
+		GLCD_SetFont(activeFont);
+	}
+	GLCD_SetForegroundColor(activeForeground);
+	GLCD_SetBackgroundColor(activeBackground);
+#endif
+}
+
+/**
+  * @brief Finishes the current frame and stores it in the ring buffer if anything was drawn.
+  * @param None.
+  * @returns Void.
+  */
+void profFrameEnd(void){
+	uint32_t now = profilerClock();
+	uint32_t idle = idleCycles;
+	uint32_t window = now - loadWindowStart;
+	unsigned int i;
+	bool drawn = false;
+
+	// Refresh the CPU load roughly ten times a second
+	if(window > profilerTicksPerMicro() * 100000){
+		cpuLoad = 100 - (uint32_t)(((uint64_t)(idle - loadWindowIdle) * 100) / window);
+		loadWindowStart = now;
+		loadWindowIdle = idle;
+	}
+
+	for(i = 0; i < ProfPrimitiveCount; i++){
+		if(current.counts[i] != 0){
+			drawn = true;
+		}
+	}
+	if(!drawn){
+		return;
+	}
+	current.cycles = now - frameStart;
+	if(current.cycles > worstCycles){
+		worstCycles = current.cycles;
+	}
+	frames[frameCount % PROFILER_FRAMES] = current;
+	frameCount++;
+	drawOverlay();
+}
+
+/**
+  * @brief Starts measuring a drawing call.
+  * @param None.
+  * @returns The cycle counter value to pass to profEnd.
+  */
+uint32_t profBegin(void){
+	return profilerClock();
+}
+
+/**
+  * @brief Finishes measuring a drawing call and adds it to the current frame.
+  * @param primitive The kind of drawing call.
+  * @param start The value returned by profBegin.
+  * @param pixels Number of pixels the call wrote itself, 0 for calls made of other profiled calls.
+  * @returns Void.
+  */
+void profEnd(enum profPrimitive primitive, uint32_t start, uint32_t pixels){
+	current.primitiveCycles[primitive] += profilerClock() - start;
+	current.counts[primitive]++;
+	current.pixels += pixels;
+}
+
+/**
+  * @brief Returns the time of the most recent frame.
+  * @param None.
+  * @returns Frame time in microseconds.
+  */
+uint32_t profLastFrameMicros(void){
+	if(frameCount == 0){
+		return 0;
+	}
+	return cyclesToMicros(frames[(frameCount - 1) % PROFILER_FRAMES].cycles);
+}
+
+/**
+  * @brief Returns the longest frame time since start-up.
+  * @param None.
+  * @returns Frame time in microseconds.
+  */
+uint32_t profWorstFrameMicros(void){
+	return cyclesToMicros(worstCycles);
+}
+
+/**
+  * @brief Returns the share of time not spent in the idle demon.
+  * @param None.
+  * @returns CPU load in percent.
+  */
+uint32_t profCpuLoad(void){
+	return cpuLoad;
+}
+
+/**
+  * @brief Writes the frames in the ring buffer as CSV, oldest first.
+  * @param out The stream to write to.
+  * @returns Void.
+  */
+void profilerWriteCSV(FILE* out){
+	static const char* const names[ProfPrimitiveCount] = {
+		"clear", "pixel", "line", "rectangle", "char", "string", "bargraph", "bitmap", "background"
+	};
+	uint32_t first = (frameCount > PROFILER_FRAMES) ? frameCount - PROFILER_FRAMES : 0;
+	uint32_t n;
+	unsigned int i;
+	const profFrame* frame;
+
+	fprintf(out, "frame,cycles,us,pixels");
+	for(i = 0; i < ProfPrimitiveCount; i++){
+		fprintf(out, ",%s_count,%s_cycles", names[i], names[i]);
+	}
+	fprintf(out, "\n");
+	for(n = first; n < frameCount; n++){
+		frame = &frames[n % PROFILER_FRAMES];
+		fprintf(out, "%u,%u,%u,%u", (unsigned int)n, (unsigned int)frame->cycles,
+				(unsigned int)cyclesToMicros(frame->cycles), (unsigned int)frame->pixels);
+		for(i = 0; i < ProfPrimitiveCount; i++){
+			fprintf(out, ",%u,%u", (unsigned int)frame->counts[i], (unsigned int)frame->primitiveCycles[i]);
+		}
+		fprintf(out, "\n");
+	}
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_SetFont, remembers the font for pixel counts.
+  */
+int32_t profSetFont(GLCD_FONT* font){
+	activeFont = font;
+	return GLCD_SetFont(font);
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_SetForegroundColor.
+  */
+int32_t profSetForegroundColor(uint32_t color){
+	activeForeground = color;
+	return GLCD_SetForegroundColor(color);
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_SetBackgroundColor.
+  */
+int32_t profSetBackgroundColor(uint32_t color){
+	activeBackground = color;
+	return GLCD_SetBackgroundColor(color);
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_ClearScreen.
+  */
+int32_t profClearScreen(void){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_ClearScreen();
+	profEnd(ProfClear, start, GLCD_WIDTH * GLCD_HEIGHT);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawPixel.
+  */
+int32_t profDrawPixel(uint32_t x, uint32_t y){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawPixel(x, y);
+	profEnd(ProfPixel, start, 1);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawHLine.
+  */
+int32_t profDrawHLine(uint32_t x, uint32_t y, uint32_t length){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawHLine(x, y, length);
+	profEnd(ProfLine, start, length);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawVLine.
+  */
+int32_t profDrawVLine(uint32_t x, uint32_t y, uint32_t length){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawVLine(x, y, length);
+	profEnd(ProfLine, start, length);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawRectangle.
+  */
+int32_t profDrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawRectangle(x, y, width, height);
+	profEnd(ProfRectangle, start, 2 * (width + height));
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawChar.
+  */
+int32_t profDrawChar(uint32_t x, uint32_t y, int32_t ch){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawChar(x, y, ch);
+	profEnd(ProfChar, start, (activeFont != NULL) ? activeFont->width * activeFont->height : 0);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawString.
+  */
+int32_t profDrawString(uint32_t x, uint32_t y, const char* str){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawString(x, y, str);
+	profEnd(ProfString, start, (activeFont != NULL) ? strlen(str) * activeFont->width * activeFont->height : 0);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawBargraph.
+  */
+int32_t profDrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawBargraph(x, y, width, height, val);
+	profEnd(ProfBargraph, start, (width * val / 100) * height);
+	return result;
+}
+
+/**
+  * @brief Profiled wrapper of GLCD_DrawBitmap.
+  */
+int32_t profDrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap){
+	uint32_t start = profBegin();
+	int32_t result = GLCD_DrawBitmap(x, y, width, height, bitmap);
+	profEnd(ProfBitmap, start, width * height);
+	return result;
+}
+
+#endif
+
+/**
+  * @brief Called in a loop by the RTX idle demon, accumulates the cycles spent idle.
+  * @param None.
+  * @returns Void.
+  */
+void profilerIdle(void){
+	uint32_t now = profilerClock();
+	if(now - lastIdle < PROFILER_IDLE_GAP){
+		idleCycles += now - lastIdle;
+	}
+	lastIdle = now;
+}
@@ -0,0 +1,124 @@
+/**
+  * @file profiler.h
+  * @brief Header file of the profiler.c source file.
+  *        Included from main.h, so every GLCD drawing call in the project goes through the profiler.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "Board_GLCD.h"
+
+/**
+  * @brief Record frame times and drawing statistics.
+  *        Comment out to compile the drawing calls without instrumentation.
+  */
+#define PROFILER_ENABLED
+
+/**
+  * @brief Draw the current and worst frame time and CPU load in the bottom border strip.
+  */
+//#define PROFILER_OVERLAY
+
+/**
+  * @brief Number of frames kept in the ring buffer.
+  */
+#define PROFILER_FRAMES 32
+
+/**
+  * @brief An enum containing the kinds of drawing calls that are counted.
+  */
+enum profPrimitive{
+	ProfClear,
+	ProfPixel,
+	ProfLine,
+	ProfRectangle,
+	ProfChar,
+	ProfString,
+	ProfBargraph,
+	ProfBitmap,
+	ProfBackground,
+	ProfPrimitiveCount
+};
+
+/**
+  * @brief A struct containing the cost of one frame.
+  */
+typedef struct{
+	uint32_t cycles;
+	uint32_t pixels;
+	uint16_t counts[ProfPrimitiveCount];
+	uint32_t primitiveCycles[ProfPrimitiveCount];
+	}profFrame;
+
+void profilerIdle(void);
+
+#ifdef PROFILER_ENABLED
+
+void profilerInitialize(void);
+void profFrameBegin(void);
+void profFrameEnd(void);
+uint32_t profBegin(void);
+void profEnd(enum profPrimitive primitive, uint32_t start, uint32_t pixels);
+uint32_t profLastFrameMicros(void);
+uint32_t profWorstFrameMicros(void);
+uint32_t profCpuLoad(void);
+void profilerWriteCSV(FILE* out);
+
+int32_t profSetFont(GLCD_FONT* font);
+int32_t profSetForegroundColor(uint32_t color);
+int32_t profSetBackgroundColor(uint32_t color);
+int32_t profClearScreen(void);
+int32_t profDrawPixel(uint32_t x, uint32_t y);
+int32_t profDrawHLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t profDrawVLine(uint32_t x, uint32_t y, uint32_t length);
+int32_t profDrawRectangle(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+int32_t profDrawChar(uint32_t x, uint32_t y, int32_t ch);
+int32_t profDrawString(uint32_t x, uint32_t y, const char* str);
+int32_t profDrawBargraph(uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t val);
+int32_t profDrawBitmap(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* bitmap);
+
+#ifndef PROFILER_NO_REDIRECT
+// Drop any earlier redirect (glcd_l8.h), the wrappers call it themselves
+#undef GLCD_SetFont
+#define GLCD_SetFont(font)                        profSetFont(font)
+#undef GLCD_SetForegroundColor
+#define GLCD_SetForegroundColor(color)            profSetForegroundColor(color)
+#undef GLCD_SetBackgroundColor
+#define GLCD_SetBackgroundColor(color)            profSetBackgroundColor(color)
+#undef GLCD_ClearScreen
+#define GLCD_ClearScreen()                        profClearScreen()
+#undef GLCD_DrawPixel
+#define GLCD_DrawPixel(x, y)                      profDrawPixel(x, y)
+#undef GLCD_DrawHLine
+#define GLCD_DrawHLine(x, y, length)              profDrawHLine(x, y, length)
+#undef GLCD_DrawVLine
+#define GLCD_DrawVLine(x, y, length)              profDrawVLine(x, y, length)
+#undef GLCD_DrawRectangle
+#define GLCD_DrawRectangle(x, y, width, height)   profDrawRectangle(x, y, width, height)
+#undef GLCD_DrawChar
+#define GLCD_DrawChar(x, y, ch)                   profDrawChar(x, y, ch)
+#undef GLCD_DrawString
+#define GLCD_DrawString(x, y, str)                profDrawString(x, y, str)
+#undef GLCD_DrawBargraph
+#define GLCD_DrawBargraph(x, y, width, height, val) profDrawBargraph(x, y, width, height, val)
+#undef GLCD_DrawBitmap
+#define GLCD_DrawBitmap(x, y, width, height, bitmap) profDrawBitmap(x, y, width, height, bitmap)
+#endif
+
+#else
+
+#define profilerInitialize()
+#define profFrameBegin()
+#define profFrameEnd()
+#define profBegin() 0
+#define profEnd(primitive, start, pixels)
+
+#endif
+
+#endif
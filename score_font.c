@@ -0,0 +1,198 @@
+/**
+  * @file score_font.c
+  * @brief Define functions that draw the scores in a large anti-aliased font.
+  *        The glyphs are kept run-length coded in flash and each one is decoded into SDRAM the first time
+  *        it is drawn. A character is drawn by filling its cell with the background and blending the
+  *        glyph coverage over it with dma2dBlendA4. In GLCD_L8 mode there is nothing to blend between,
+  *        so pixels at least half covered are set instead.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+#include "mirror.h"
+#include "layers.h"
+#include "dma2d.h"
+#include "score_font.h"
+#ifdef GLCD_SOFT
+#include <time.h>
+#else
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief Decoded glyphs, placed in SDRAM after the transition snapshot of transitions.c.
+  */
+#ifdef GLCD_SOFT
+static uint8_t glyphCache[SCORE_FONT_GLYPHS][SCORE_FONT_GLYPH_BYTES];
+#else
+static uint8_t glyphCache[SCORE_FONT_GLYPHS][SCORE_FONT_GLYPH_BYTES] __attribute__((section(".ARM.__at_0xC00E0000")));
+#endif
+
+/**
+  * @brief Set once the glyph has been decoded into glyphCache.
+  */
+static bool decoded[SCORE_FONT_GLYPHS];
+
+/**
+  * @brief Time the last scoreFontDrawString took, in microseconds.
+  */
+static uint32_t lastMicros = 0;
+
+/**
+  * @brief Returns a timestamp to measure drawing time with.
+  * @param None.
+  * @returns Microseconds on the host, cycles on the target.
+  */
+static uint32_t scoreFontClock(void){
+#ifdef GLCD_SOFT
+	return (uint32_t)((uint64_t)clock() * 1000000 / CLOCKS_PER_SEC);
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+/**
+  * @brief Expands the run-length coded glyph into two pixels per byte.
+  * @param glyph Index of the glyph.
+  * @returns Void.
+  */
+static void decodeGlyph(unsigned int glyph){
+	const uint8_t* run = &scoreFontData[scoreFontOffsets[glyph]];
+	const uint8_t* end = &scoreFontData[scoreFontOffsets[glyph + 1]];
+	uint8_t* out = glyphCache[glyph];
+	uint32_t pixel = 0;
+	uint32_t length;
+	uint8_t coverage;
+
+	for(; run < end && pixel < SCORE_FONT_WIDTH * SCORE_FONT_HEIGHT; run++){
+		coverage = *run >> 4;
+		length = (*run & 0x0F) + 1;
+		for(; length > 0 && pixel < SCORE_FONT_WIDTH * SCORE_FONT_HEIGHT; length--, pixel++){
+			if(pixel & 1){
+				out[pixel >> 1] |= (uint8_t)(coverage << 4);
+			}else{
+				out[pixel >> 1] = coverage;
+			}
+		}
+	}
+	decoded[glyph] = true;
+}
+
+/**
+  * @brief Returns the decoded coverage of a digit, decoding it on first use.
+  * @param ch The character.
+  * @returns SCORE_FONT_GLYPH_BYTES bytes of coverage, NULL if the character is not a digit.
+  */
+const uint8_t* scoreFontGlyph(int ch){
+	unsigned int glyph;
+	if(ch < '0' || ch > '9'){
+		return NULL;
+	}
+	glyph = (unsigned int)(ch - '0');
+	if(!decoded[glyph]){
+		decodeGlyph(glyph);
+	}
+	return glyphCache[glyph];
+}
+
+#ifdef GLCD_L8
+/**
+  * @brief Sets the pixels of a character cell that are at least half covered.
+  * @param cell First pixel of the cell in the frame buffer.
+  * @param coverage Coverage of the glyph.
+  * @param foreground Palette index of the set pixels.
+  * @returns Void.
+  */
+static void drawThreshold(uint8_t* cell, const uint8_t* coverage, uint8_t foreground){
+	unsigned int row;
+	unsigned int column;
+	for(row = 0; row < SCORE_FONT_HEIGHT; row++, cell += GLCD_WIDTH){
+		for(column = 0; column < SCORE_FONT_WIDTH; column += 2, coverage++){
+			if((*coverage & 0x0F) >= 8){
+				cell[column] = foreground;
+			}
+			if((*coverage >> 4) >= 8){
+				cell[column + 1] = foreground;
+			}
+		}
+	}
+}
+#endif
+
+/**
+  * @brief Draws a string in the score font. Digits are drawn anti-aliased over the background
+  *        colour, every other character is drawn as an empty cell.
+  *        With GLCD_LAYERS the cell is filled from the background layer instead, so the digits blend with it.
+  * @param x,y Top left co-ordinates of the string.
+  * @param str Null-terminated string to draw.
+  * @param foreground Colour of the digits.
+  * @param background Colour of the cells.
+  * @returns 0 on success, -1 if the string runs off the screen.
+  */
+int scoreFontDrawString(unsigned int x, unsigned int y, const char* str, uint16_t foreground, uint16_t background){
+	uint32_t start = scoreFontClock();
+	const uint8_t* coverage;
+	unsigned int left = x;
+	int result = 0;
+#ifdef GLCD_L8
+	uint8_t* cell;
+	uint8_t foregroundIndex = glcdL8ColorIndex(foreground);
+	uint8_t backgroundIndex = glcdL8ColorIndex(background);
+#else
+	uint16_t* cell;
+#endif
+
+	if(y + SCORE_FONT_HEIGHT > GLCD_HEIGHT){
+		return -1;
+	}
+	for(; *str != '\0'; str++, x += SCORE_FONT_WIDTH){
+		if(x + SCORE_FONT_WIDTH > GLCD_WIDTH){
+			result = -1;
+			break;
+		}
+		// Decode before the fill is started, the two do not overlap
+		coverage = scoreFontGlyph((unsigned char)*str);
+#ifdef GLCD_L8
+		cell = (uint8_t*)glcdFrameBuffer() + y * GLCD_WIDTH + x;
+		dma2dFill(cell, GLCD_WIDTH, SCORE_FONT_WIDTH, SCORE_FONT_HEIGHT, backgroundIndex, 1);
+		if(coverage != NULL){
+			drawThreshold(cell, coverage, foregroundIndex);
+		}
+#else
+		cell = (uint16_t*)glcdFrameBuffer() + y * GLCD_WIDTH + x;
+#ifdef GLCD_LAYERS
+		(void)background;
+		dma2dCopy(cell, GLCD_WIDTH, layerBackgroundBuffer() + y * GLCD_WIDTH + x, GLCD_WIDTH,
+				SCORE_FONT_WIDTH, SCORE_FONT_HEIGHT, 2);
+#else
+		dma2dFill(cell, GLCD_WIDTH, SCORE_FONT_WIDTH, SCORE_FONT_HEIGHT, background, 2);
+#endif
+		if(coverage != NULL){
+			dma2dBlendA4(cell, GLCD_WIDTH, coverage, SCORE_FONT_WIDTH, SCORE_FONT_HEIGHT, foreground);
+		}
+#endif
+	}
+	dma2dWait();
+	mirrorMarkDirty(left, y, x - left, SCORE_FONT_HEIGHT);
+#ifdef GLCD_SOFT
+	lastMicros = scoreFontClock() - start;
+#else
+	lastMicros = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+#endif
+	return result;
+}
+
+/**
+  * @brief Returns how long the last scoreFontDrawString took, including decoding glyphs drawn for the first time.
+  * @param None.
+  * @returns Microseconds.
+  */
+uint32_t scoreFontLastMicros(void){
+	return lastMicros;
+}
@@ -0,0 +1,37 @@
+/**
+  * @file score_font.h
+  * @brief Header file of the score_font.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef SCORE_FONT_H
+#define SCORE_FONT_H
+
+#include <stdint.h>
+
+/**
+  * @brief Size of one score font character in pixels. The width is even, so a glyph row is whole bytes.
+  */
+#define SCORE_FONT_WIDTH  48
+#define SCORE_FONT_HEIGHT 64
+
+/**
+  * @brief Number of glyphs, the digits 0 to 9.
+  */
+#define SCORE_FONT_GLYPHS 10
+
+/**
+  * @brief Bytes of one decoded glyph: 4-bit coverage, two pixels per byte, left pixel in the low nibble.
+  */
+#define SCORE_FONT_GLYPH_BYTES (SCORE_FONT_WIDTH * SCORE_FONT_HEIGHT / 2)
+
+extern const uint16_t scoreFontOffsets[SCORE_FONT_GLYPHS + 1];
+extern const uint8_t scoreFontData[];
+
+int scoreFontDrawString(unsigned int x, unsigned int y, const char* str, uint16_t foreground, uint16_t background);
+const uint8_t* scoreFontGlyph(int ch);
+uint32_t scoreFontLastMicros(void);
+
+#endif
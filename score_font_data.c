@@ -0,0 +1,300 @@
+/**
+  * @file score_font_data.c
+  * @brief Glyphs of the large score font: the digits 0 to 9, SCORE_FONT_WIDTH by SCORE_FONT_HEIGHT pixels,
+  *        rendered from rounded strokes at 4x4 samples per pixel into 4-bit coverage.
+  *        Each glyph is run-length coded row by row: one byte per run, coverage in the high nibble
+  *        and run length - 1 in the low nibble. Runs continue across rows.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "score_font.h"
+
+/**
+  * @brief Start of each glyph in scoreFontData, and the end of the last one.
+  */
+const uint16_t scoreFontOffsets[SCORE_FONT_GLYPHS + 1] = {
+	0, 483, 868, 1306, 1774, 2201, 2629, 3080, 3452, 3942, 4393
+};
+
+/**
+  * @brief Run-length coded coverage of every glyph, one glyph after another.
+  */
+const uint8_t scoreFontData[] = {
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x20, 0x50, 0x83, 0x50, 0x20,
+	0x0F, 0x0F, 0x05, 0x60, 0xA0, 0xF7, 0xA0, 0x60, 0x0F, 0x0F, 0x01, 0x40, 0xC0, 0xFB, 0xC0, 0x40,
+	0x0F, 0x0E, 0x80, 0xFF, 0x80, 0x0F, 0x0B, 0x10, 0xA0, 0xFF, 0xF1, 0xA0, 0x10, 0x0F, 0x09, 0xB0,
+	0xFF, 0xF3, 0xB0, 0x0F, 0x08, 0x90, 0xFF, 0xF5, 0x90, 0x0F, 0x06, 0x70, 0xFF, 0xF7, 0x70, 0x0F,
+	0x04, 0x20, 0xE0, 0xFF, 0xF7, 0xE0, 0x20, 0x0F, 0x03, 0xB0, 0xFA, 0xE0, 0xB1, 0xE0, 0xFA, 0xB0,
+	0x0F, 0x02, 0x40, 0xFA, 0x80, 0x03, 0x80, 0xFA, 0x40, 0x0F, 0x01, 0xB0, 0xF9, 0x60, 0x05, 0x60,
+	0xF9, 0xB0, 0x0F, 0x00, 0x40, 0xF9, 0x60, 0x07, 0x60, 0xF9, 0x40, 0x0F, 0xA0, 0xF8, 0xA0, 0x09,
+	0xA0, 0xF8, 0xA0, 0x0E, 0x20, 0xF8, 0xE0, 0x10, 0x09, 0x10, 0xE0, 0xF8, 0x20, 0x0D, 0x70, 0xF8,
+	0x80, 0x0B, 0x80, 0xF8, 0x70, 0x0D, 0xB0, 0xF7, 0xE0, 0x10, 0x0B, 0x10, 0xE0, 0xF7, 0xB0, 0x0C,
+	0x10, 0xF8, 0x90, 0x0D, 0x90, 0xF8, 0x10, 0x0B, 0x60, 0xF8, 0x30, 0x0D, 0x30, 0xF8, 0x60, 0x0B,
+	0x80, 0xF7, 0xE0, 0x0F, 0xE0, 0xF7, 0x80, 0x0B, 0xB0, 0xF7, 0x90, 0x0F, 0x90, 0xF7, 0xB0, 0x0B,
+	0xF8, 0x70, 0x0F, 0x70, 0xF8, 0x0A, 0x20, 0xF8, 0x40, 0x0F, 0x40, 0xF8, 0x20, 0x09, 0x40, 0xF8,
+	0x0F, 0x01, 0xF8, 0x40, 0x09, 0x50, 0xF7, 0xE0, 0x0F, 0x01, 0xE0, 0xF7, 0x50, 0x09, 0x80, 0xF7,
+	0xB0, 0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xB0, 0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09,
+	0x80, 0xF7, 0xB0, 0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0x90, 0x0F, 0x01, 0x90, 0xF7,
+	0x80, 0x09, 0x80, 0xF7, 0x90, 0x0F, 0x01, 0x90, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xB0, 0x0F, 0x01,
+	0xB0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xB0, 0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xB0,
+	0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x50, 0xF7, 0xE0, 0x0F, 0x01, 0xE0, 0xF7, 0x50, 0x09, 0x40,
+	0xF8, 0x0F, 0x01, 0xF8, 0x40, 0x09, 0x20, 0xF8, 0x40, 0x0F, 0x40, 0xF8, 0x20, 0x0A, 0xF8, 0x70,
+	0x0F, 0x70, 0xF8, 0x0B, 0xB0, 0xF7, 0x90, 0x0F, 0x90, 0xF7, 0xB0, 0x0B, 0x80, 0xF7, 0xE0, 0x0F,
+	0xE0, 0xF7, 0x80, 0x0B, 0x60, 0xF8, 0x30, 0x0D, 0x30, 0xF8, 0x60, 0x0B, 0x10, 0xF8, 0x90, 0x0D,
+	0x90, 0xF8, 0x10, 0x0C, 0xB0, 0xF7, 0xE0, 0x10, 0x0B, 0x10, 0xE0, 0xF7, 0xB0, 0x0D, 0x70, 0xF8,
+	0x80, 0x0B, 0x80, 0xF8, 0x70, 0x0D, 0x20, 0xF8, 0xE0, 0x10, 0x09, 0x10, 0xE0, 0xF8, 0x20, 0x0E,
+	0xA0, 0xF8, 0xA0, 0x09, 0xA0, 0xF8, 0xA0, 0x0F, 0x40, 0xF9, 0x60, 0x07, 0x60, 0xF9, 0x40, 0x0F,
+	0x00, 0xB0, 0xF9, 0x60, 0x05, 0x60, 0xF9, 0xB0, 0x0F, 0x01, 0x40, 0xFA, 0x80, 0x03, 0x80, 0xFA,
+	0x40, 0x0F, 0x02, 0xB0, 0xFA, 0xE0, 0xB1, 0xE0, 0xFA, 0xB0, 0x0F, 0x03, 0x20, 0xE0, 0xFF, 0xF7,
+	0xE0, 0x20, 0x0F, 0x04, 0x70, 0xFF, 0xF7, 0x70, 0x0F, 0x06, 0x90, 0xFF, 0xF5, 0x90, 0x0F, 0x08,
+	0xB0, 0xFF, 0xF3, 0xB0, 0x0F, 0x09, 0x10, 0xA0, 0xFF, 0xF1, 0xA0, 0x10, 0x0F, 0x0B, 0x80, 0xFF,
+	0x80, 0x0F, 0x0E, 0x40, 0xC0, 0xFB, 0xC0, 0x40, 0x0F, 0x0F, 0x01, 0x60, 0xA0, 0xF7, 0xA0, 0x60,
+	0x0F, 0x0F, 0x05, 0x20, 0x50, 0x83, 0x50, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x05, 0x60, 0x81,
+	0x60, 0x0F, 0x0F, 0x09, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x0F, 0x0F, 0x06, 0x30, 0xE0, 0xF5, 0xC0,
+	0x0F, 0x0F, 0x05, 0x50, 0xE0, 0xF7, 0x60, 0x0F, 0x0F, 0x03, 0x60, 0xF9, 0x80, 0x0F, 0x0F, 0x02,
+	0x80, 0xFA, 0x80, 0x0F, 0x0F, 0x01, 0x90, 0xFB, 0x80, 0x0F, 0x0F, 0x10, 0xA0, 0xFC, 0x80, 0x0F,
+	0x0E, 0x10, 0xC0, 0xFD, 0x80, 0x0F, 0x0D, 0x30, 0xC0, 0xFE, 0x80, 0x0F, 0x0D, 0xC0, 0xFF, 0x80,
+	0x0F, 0x0C, 0x60, 0xFF, 0xF0, 0x80, 0x0F, 0x0C, 0x80, 0xFF, 0xF0, 0x80, 0x0F, 0x0C, 0x80, 0xFF,
+	0xF0, 0x80, 0x0F, 0x0C, 0x60, 0xFF, 0xF0, 0x80, 0x0F, 0x0D, 0xC0, 0xF5, 0xE0, 0xA0, 0xF7, 0x80,
+	0x0F, 0x0D, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x60, 0x81, 0x60, 0x01,
+	0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7,
+	0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05,
+	0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7,
+	0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05,
+	0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7,
+	0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05,
+	0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7,
+	0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0E, 0x60, 0x85, 0xB0, 0xF7, 0xB0, 0x85, 0x60,
+	0x0F, 0x05, 0x30, 0xC0, 0xFF, 0xF7, 0xC0, 0x30, 0x0F, 0x03, 0xC0, 0xFF, 0xF9, 0xC0, 0x0F, 0x02,
+	0x60, 0xFF, 0xFB, 0x60, 0x0F, 0x01, 0x80, 0xFF, 0xFB, 0x80, 0x0F, 0x01, 0x80, 0xFF, 0xFB, 0x80,
+	0x0F, 0x01, 0x60, 0xFF, 0xFB, 0x60, 0x0F, 0x02, 0xC0, 0xFF, 0xF9, 0xC0, 0x0F, 0x03, 0x30, 0xC0,
+	0xFF, 0xF7, 0xC0, 0x30, 0x0F, 0x05, 0x60, 0x8F, 0x85, 0x60, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0B, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x10,
+	0x40, 0x70, 0x83, 0x70, 0x40, 0x10, 0x0F, 0x0F, 0x02, 0x10, 0x70, 0xC0, 0xF9, 0xC0, 0x60, 0x10,
+	0x0F, 0x0D, 0x10, 0x80, 0xE0, 0xFD, 0xE0, 0x80, 0x10, 0x0F, 0x0A, 0x50, 0xE0, 0xFF, 0xF1, 0xE0,
+	0x50, 0x0F, 0x08, 0x80, 0xFF, 0xF5, 0x80, 0x0F, 0x06, 0x90, 0xFF, 0xF7, 0x90, 0x0F, 0x04, 0x90,
+	0xFF, 0xF9, 0x90, 0x0F, 0x02, 0x70, 0xFF, 0xFB, 0x70, 0x0F, 0x00, 0x20, 0xE0, 0xFF, 0xFB, 0xE0,
+	0x20, 0x0F, 0xB0, 0xFB, 0xE0, 0xB0, 0x90, 0x80, 0xB0, 0xE0, 0xFB, 0xB0, 0x0E, 0x30, 0xFA, 0xB0,
+	0x50, 0x05, 0x50, 0xB0, 0xFA, 0x30, 0x0D, 0x90, 0xF9, 0x70, 0x09, 0x70, 0xF9, 0x90, 0x0D, 0xE0,
+	0xF8, 0x60, 0x0B, 0x60, 0xF8, 0xE0, 0x0C, 0x30, 0xF8, 0x90, 0x0D, 0x90, 0xF8, 0x30, 0x0B, 0x70,
+	0xF8, 0x20, 0x0D, 0x20, 0xF8, 0x70, 0x0B, 0x80, 0xF7, 0xC0, 0x0F, 0xC0, 0xF7, 0x80, 0x0B, 0x80,
+	0xF7, 0x90, 0x0F, 0x90, 0xF7, 0x80, 0x0B, 0x80, 0xF7, 0x80, 0x0F, 0x90, 0xF7, 0x80, 0x0B, 0x60,
+	0xF7, 0x60, 0x0F, 0xC0, 0xF7, 0x80, 0x0C, 0xC0, 0xF5, 0xC0, 0x0F, 0x20, 0xF8, 0x60, 0x0C, 0x30,
+	0xC0, 0xF3, 0xC0, 0x30, 0x0E, 0x10, 0xC0, 0xF8, 0x30, 0x0E, 0x60, 0x81, 0x60, 0x0F, 0x00, 0x90,
+	0xF8, 0xE0, 0x0F, 0x0F, 0x03, 0x70, 0xF9, 0x90, 0x0F, 0x0F, 0x02, 0x40, 0xFA, 0x30, 0x0F, 0x0F,
+	0x01, 0x20, 0xE0, 0xF9, 0xA0, 0x0F, 0x0F, 0x01, 0x10, 0xC0, 0xF9, 0xD0, 0x10, 0x0F, 0x0F, 0x01,
+	0x90, 0xF9, 0xE0, 0x30, 0x0F, 0x0F, 0x01, 0x70, 0xFA, 0x60, 0x0F, 0x0F, 0x01, 0x40, 0xFA, 0x80,
+	0x0F, 0x0F, 0x01, 0x20, 0xE0, 0xF9, 0xA0, 0x0F, 0x0F, 0x01, 0x10, 0xC0, 0xF9, 0xC0, 0x10, 0x0F,
+	0x0F, 0x01, 0x90, 0xF9, 0xE0, 0x30, 0x0F, 0x0F, 0x01, 0x70, 0xFA, 0x50, 0x0F, 0x0F, 0x01, 0x40,
+	0xFA, 0x80, 0x0F, 0x0F, 0x01, 0x20, 0xE0, 0xF9, 0xA0, 0x0F, 0x0F, 0x01, 0x10, 0xC0, 0xF9, 0xC0,
+	0x10, 0x0F, 0x0F, 0x01, 0x90, 0xF9, 0xE0, 0x30, 0x0F, 0x0F, 0x01, 0x70, 0xFA, 0x50, 0x0F, 0x0F,
+	0x01, 0x50, 0xFA, 0x80, 0x0F, 0x0F, 0x01, 0x30, 0xE0, 0xF9, 0xA0, 0x0F, 0x0F, 0x01, 0x10, 0xC0,
+	0xF9, 0xC0, 0x10, 0x0F, 0x0F, 0x01, 0xA0, 0xF9, 0xE0, 0x30, 0x0F, 0x0F, 0x01, 0x80, 0xFA, 0x50,
+	0x0F, 0x0F, 0x01, 0x50, 0xFA, 0x80, 0x0F, 0x0F, 0x01, 0x30, 0xE0, 0xF9, 0xA0, 0x0F, 0x0F, 0x01,
+	0x10, 0xC0, 0xF9, 0xC0, 0x10, 0x0F, 0x0F, 0x01, 0xA0, 0xF9, 0xE0, 0x30, 0x0F, 0x0F, 0x01, 0x80,
+	0xFA, 0x50, 0x0F, 0x0F, 0x01, 0x50, 0xFA, 0xC0, 0x8F, 0x80, 0x60, 0x0F, 0x30, 0xE0, 0xFF, 0xFD,
+	0xC0, 0x30, 0x0D, 0xC0, 0xFF, 0xFF, 0xC0, 0x0C, 0x60, 0xFF, 0xFF, 0xF1, 0x60, 0x0B, 0x80, 0xFF,
+	0xFF, 0xF1, 0x80, 0x0B, 0x80, 0xFF, 0xFF, 0xF1, 0x80, 0x0B, 0x60, 0xFF, 0xFF, 0xF1, 0x60, 0x0C,
+	0xC0, 0xFF, 0xFF, 0xC0, 0x0D, 0x30, 0xC0, 0xFF, 0xFD, 0xC0, 0x30, 0x0F, 0x60, 0x8F, 0x8B, 0x60,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x40, 0x70, 0x83, 0x70, 0x40, 0x0F, 0x0F, 0x04, 0x40, 0x90, 0xE0,
+	0xF7, 0xE0, 0x90, 0x40, 0x0F, 0x0F, 0x40, 0xB0, 0xFD, 0xB0, 0x40, 0x0F, 0x0B, 0x10, 0x80, 0xFF,
+	0xF1, 0x80, 0x10, 0x0F, 0x08, 0x10, 0xC0, 0xFF, 0xF3, 0xC0, 0x10, 0x0F, 0x06, 0x10, 0xC0, 0xFF,
+	0xF5, 0xC0, 0x10, 0x0F, 0x04, 0x10, 0xC0, 0xFF, 0xF7, 0xC0, 0x10, 0x0F, 0x03, 0x80, 0xFF, 0xF9,
+	0x80, 0x0F, 0x02, 0x40, 0xFF, 0xFB, 0x40, 0x0F, 0x01, 0xB0, 0xFB, 0xB0, 0x91, 0xB0, 0xFB, 0xB0,
+	0x0F, 0x00, 0x40, 0xF9, 0xE0, 0x80, 0x10, 0x03, 0x10, 0x80, 0xE0, 0xF9, 0x40, 0x0F, 0x90, 0xF8,
+	0xE0, 0x30, 0x07, 0x30, 0xE0, 0xF8, 0x90, 0x0F, 0xC0, 0xF7, 0xE0, 0x30, 0x09, 0x30, 0xE0, 0xF7,
+	0xE0, 0x0F, 0xB0, 0xF7, 0x80, 0x0B, 0x80, 0xF8, 0x40, 0x0E, 0x90, 0xF7, 0x10, 0x0B, 0x10, 0xF8,
+	0x70, 0x0E, 0x20, 0xE0, 0xF5, 0x80, 0x0D, 0xB0, 0xF7, 0x80, 0x0F, 0x30, 0xD0, 0xF3, 0x80, 0x0E,
+	0x90, 0xF7, 0x80, 0x0F, 0x01, 0x50, 0x80, 0x70, 0x20, 0x0F, 0x90, 0xF7, 0x80, 0x0F, 0x0F, 0x05,
+	0xB0, 0xF7, 0x80, 0x0F, 0x0F, 0x04, 0x10, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0x80, 0xF8, 0x40, 0x0F,
+	0x0F, 0x03, 0x30, 0xE0, 0xF7, 0xE0, 0x0F, 0x0F, 0x03, 0x30, 0xE0, 0xF8, 0x90, 0x0F, 0x0F, 0x01,
+	0x10, 0x80, 0xE0, 0xF9, 0x40, 0x0F, 0x0D, 0x60, 0x80, 0x90, 0xB0, 0xFB, 0xB0, 0x0F, 0x0C, 0x30,
+	0xC0, 0xFF, 0x40, 0x0F, 0x0C, 0xC0, 0xFF, 0x80, 0x0F, 0x0C, 0x60, 0xFF, 0xC0, 0x10, 0x0F, 0x0C,
+	0x80, 0xFF, 0x60, 0x0F, 0x0D, 0x80, 0xFF, 0xF0, 0x60, 0x0F, 0x0C, 0x60, 0xFF, 0xF1, 0x60, 0x0F,
+	0x0C, 0xC0, 0xFF, 0xF1, 0x40, 0x0F, 0x0B, 0x30, 0xC0, 0xFF, 0xF0, 0xE0, 0x10, 0x0F, 0x0C, 0x60,
+	0x80, 0x90, 0xB0, 0xD0, 0xFC, 0x90, 0x0F, 0x0F, 0x01, 0x20, 0x80, 0xE0, 0xFA, 0x20, 0x0F, 0x0F,
+	0x02, 0x10, 0xA0, 0xF9, 0x80, 0x0F, 0x0F, 0x04, 0x90, 0xF8, 0xD0, 0x0F, 0x0F, 0x05, 0xB0, 0xF8,
+	0x30, 0x0F, 0x0F, 0x04, 0x20, 0xF8, 0x60, 0x0F, 0x0F, 0x05, 0xC0, 0xF7, 0x80, 0x0D, 0x50, 0x81,
+	0x30, 0x0F, 0x03, 0xA0, 0xF7, 0x80, 0x0B, 0x30, 0xC0, 0xF3, 0x90, 0x0F, 0x02, 0x90, 0xF7, 0x80,
+	0x0A, 0x10, 0xD0, 0xF5, 0x80, 0x0F, 0x01, 0xC0, 0xF7, 0x80, 0x0A, 0x70, 0xF7, 0x20, 0x0F, 0x20,
+	0xF8, 0x60, 0x0A, 0xB0, 0xF7, 0xB0, 0x0F, 0xB0, 0xF8, 0x30, 0x0A, 0xB0, 0xF8, 0x90, 0x0D, 0x90,
+	0xF8, 0xD0, 0x0B, 0x80, 0xF9, 0xA0, 0x10, 0x09, 0x10, 0xA0, 0xF9, 0x80, 0x0B, 0x20, 0xFA, 0xE0,
+	0x80, 0x20, 0x05, 0x20, 0x80, 0xE0, 0xFA, 0x20, 0x0C, 0x80, 0xFC, 0xD0, 0xB0, 0x90, 0x80, 0xB0,
+	0xD0, 0xFC, 0x80, 0x0D, 0x10, 0xE0, 0xFF, 0xFD, 0xE0, 0x10, 0x0E, 0x40, 0xFF, 0xFD, 0x40, 0x0F,
+	0x00, 0x60, 0xFF, 0xFB, 0x60, 0x0F, 0x02, 0x60, 0xFF, 0xF9, 0x60, 0x0F, 0x04, 0x50, 0xE0, 0xFF,
+	0xF5, 0xE0, 0x50, 0x0F, 0x06, 0x20, 0xA0, 0xFF, 0xF3, 0xA0, 0x20, 0x0F, 0x09, 0x40, 0xB0, 0xFF,
+	0xB0, 0x40, 0x0F, 0x0D, 0x30, 0x80, 0xD0, 0xF9, 0xD0, 0x80, 0x30, 0x0F, 0x0F, 0x02, 0x20, 0x40,
+	0x85, 0x40, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C, 0x60, 0x81, 0x60, 0x0F, 0x0F, 0x09, 0x30,
+	0xC0, 0xF3, 0xC0, 0x30, 0x0F, 0x0F, 0x07, 0xC0, 0xF5, 0xC0, 0x0F, 0x0F, 0x06, 0x80, 0xF7, 0x60,
+	0x0F, 0x0F, 0x04, 0x20, 0xE0, 0xF7, 0x80, 0x0F, 0x0F, 0x04, 0xB0, 0xF8, 0x80, 0x0F, 0x0F, 0x03,
+	0x50, 0xF9, 0x60, 0x0F, 0x0F, 0x02, 0x10, 0xD0, 0xF8, 0xD0, 0x0F, 0x0F, 0x03, 0x80, 0xF9, 0x40,
+	0x0F, 0x0F, 0x02, 0x30, 0xF9, 0x90, 0x0F, 0x0F, 0x03, 0xC0, 0xF8, 0xE0, 0x10, 0x0F, 0x0F, 0x02,
+	0x70, 0xF9, 0x60, 0x0F, 0x0F, 0x02, 0x10, 0xE0, 0xF8, 0xB0, 0x0F, 0x0F, 0x03, 0xA0, 0xF9, 0x30,
+	0x0F, 0x0F, 0x02, 0x40, 0xF9, 0xC0, 0x80, 0x60, 0x0F, 0x0F, 0x01, 0xD0, 0xFC, 0xC0, 0x30, 0x0F,
+	0x0E, 0x80, 0xFE, 0xC0, 0x0F, 0x0D, 0x20, 0xFF, 0xF0, 0x60, 0x0F, 0x0C, 0xB0, 0xFF, 0xF0, 0x80,
+	0x0F, 0x0B, 0x60, 0xFF, 0xF1, 0x80, 0x0F, 0x0A, 0x10, 0xE0, 0xFF, 0xF1, 0x80, 0x0F, 0x0A, 0x80,
+	0xF9, 0xB0, 0xF7, 0x80, 0x0F, 0x09, 0x40, 0xF9, 0x81, 0xF7, 0x80, 0x0F, 0x09, 0xC0, 0xF8, 0xE0,
+	0x10, 0x80, 0xF7, 0x80, 0x0F, 0x08, 0x70, 0xF9, 0x60, 0x00, 0x80, 0xF7, 0x80, 0x0F, 0x07, 0x20,
+	0xE0, 0xF8, 0xB0, 0x01, 0x80, 0xF7, 0x80, 0x0F, 0x07, 0xA0, 0xF9, 0x20, 0x01, 0x80, 0xF7, 0x80,
+	0x0F, 0x06, 0x50, 0xF9, 0x80, 0x02, 0x80, 0xF7, 0x80, 0x0F, 0x05, 0x10, 0xD0, 0xF8, 0xD0, 0x03,
+	0x80, 0xF7, 0x80, 0x0F, 0x05, 0x80, 0xF9, 0x40, 0x03, 0x80, 0xF7, 0x80, 0x0F, 0x04, 0x30, 0xF9,
+	0xA0, 0x04, 0x80, 0xF7, 0x80, 0x0F, 0x04, 0xB0, 0xF8, 0xE0, 0x10, 0x04, 0x80, 0xF7, 0x80, 0x0F,
+	0x03, 0x60, 0xF9, 0x70, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x02, 0x10, 0xE0, 0xF8, 0xC0, 0x06, 0x80,
+	0xF7, 0x80, 0x0F, 0x02, 0x90, 0xF9, 0xA0, 0x86, 0xB0, 0xF7, 0xB0, 0x83, 0x60, 0x0C, 0x40, 0xFF,
+	0xFF, 0xF1, 0xC0, 0x30, 0x0A, 0xD0, 0xFF, 0xFF, 0xF2, 0xC0, 0x09, 0x60, 0xFF, 0xFF, 0xF4, 0x60,
+	0x08, 0x80, 0xFF, 0xFF, 0xF4, 0x80, 0x08, 0x80, 0xFF, 0xFF, 0xF4, 0x80, 0x08, 0x60, 0xFF, 0xFF,
+	0xF4, 0x60, 0x09, 0xC0, 0xFF, 0xFF, 0xF2, 0xC0, 0x0A, 0x30, 0xC0, 0xFF, 0xFF, 0xF0, 0xC0, 0x30,
+	0x0C, 0x60, 0x8F, 0x80, 0xB0, 0xF7, 0xB0, 0x83, 0x60, 0x0F, 0x0F, 0x00, 0x80, 0xF7, 0x80, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7,
+	0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05,
+	0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0x60, 0xF7, 0x60, 0x0F, 0x0F, 0x06, 0xC0, 0xF5,
+	0xC0, 0x0F, 0x0F, 0x07, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x0F, 0x0F, 0x09, 0x60, 0x81, 0x60, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0B, 0x60, 0x8F, 0x87, 0x60, 0x0F, 0x03, 0x30, 0xC0, 0xFF, 0xF9, 0xC0, 0x30, 0x0F,
+	0x01, 0xC0, 0xFF, 0xFB, 0xC0, 0x0F, 0x00, 0x60, 0xFF, 0xFD, 0x60, 0x0F, 0x80, 0xFF, 0xFD, 0x80,
+	0x0F, 0xB0, 0xFF, 0xFD, 0x80, 0x0F, 0xB0, 0xFF, 0xFD, 0x60, 0x0F, 0xB0, 0xFF, 0xFC, 0xC0, 0x0F,
+	0x00, 0xFF, 0xFC, 0xC0, 0x30, 0x0F, 0x00, 0xF8, 0x90, 0x8F, 0x81, 0x60, 0x0F, 0x02, 0xF8, 0x40,
+	0x0F, 0x0F, 0x04, 0x40, 0xF8, 0x0F, 0x0F, 0x05, 0x40, 0xF8, 0x0F, 0x0F, 0x05, 0x40, 0xF8, 0x0F,
+	0x0F, 0x05, 0x80, 0xF7, 0xB0, 0x0F, 0x0F, 0x05, 0x80, 0xF7, 0xB0, 0x0F, 0x0F, 0x05, 0x80, 0xF7,
+	0xB0, 0x0F, 0x0F, 0x05, 0xB0, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0xB0, 0xF7, 0x80, 0x01, 0x40, 0x70,
+	0x83, 0x70, 0x40, 0x0F, 0x0B, 0xB0, 0xF7, 0xB0, 0xA0, 0xF9, 0xA0, 0x60, 0x0F, 0x08, 0xFF, 0xF6,
+	0xD0, 0x60, 0x0F, 0x06, 0xFF, 0xF8, 0xC0, 0x30, 0x0F, 0x04, 0xFF, 0xFA, 0x60, 0x0F, 0x02, 0x40,
+	0xFF, 0xFB, 0x60, 0x0F, 0x01, 0x40, 0xFF, 0xFC, 0x60, 0x0F, 0x00, 0x40, 0xFF, 0xFD, 0x50, 0x0F,
+	0x80, 0xFF, 0xFD, 0xE0, 0x20, 0x0E, 0x80, 0xFD, 0xB0, 0xA0, 0x90, 0xB0, 0xFC, 0xA0, 0x0E, 0x80,
+	0xFA, 0xD0, 0x60, 0x05, 0x60, 0xD0, 0xFA, 0x40, 0x0D, 0x90, 0xF9, 0x90, 0x10, 0x07, 0x10, 0x90,
+	0xF9, 0xB0, 0x0D, 0xB0, 0xF8, 0x90, 0x0B, 0x90, 0xF9, 0x20, 0x0C, 0x90, 0xF7, 0xA0, 0x0D, 0xA0,
+	0xF8, 0x80, 0x0C, 0x40, 0xF6, 0xE0, 0x10, 0x0D, 0x10, 0xE0, 0xF7, 0xC0, 0x0D, 0x90, 0xF5, 0x60,
+	0x0F, 0x80, 0xF8, 0x20, 0x0D, 0x70, 0xD0, 0xF1, 0xC0, 0x40, 0x0F, 0x00, 0x20, 0xF8, 0x40, 0x0F,
+	0x0F, 0x05, 0xD0, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0xB0, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0xA0, 0xF7,
+	0x80, 0x0F, 0x0F, 0x05, 0xA0, 0xF7, 0x80, 0x0F, 0x0F, 0x05, 0xB0, 0xF7, 0x80, 0x0F, 0x0F, 0x05,
+	0xD0, 0xF7, 0x80, 0x0D, 0x70, 0xD0, 0xF1, 0xC0, 0x40, 0x0F, 0x00, 0x20, 0xF8, 0x40, 0x0C, 0x90,
+	0xF5, 0x60, 0x0F, 0x80, 0xF8, 0x20, 0x0B, 0x40, 0xF6, 0xE0, 0x10, 0x0D, 0x10, 0xE0, 0xF7, 0xC0,
+	0x0C, 0x90, 0xF7, 0xA0, 0x0D, 0xA0, 0xF8, 0x80, 0x0C, 0xB0, 0xF8, 0x90, 0x0B, 0x90, 0xF9, 0x20,
+	0x0C, 0x90, 0xF9, 0x90, 0x10, 0x07, 0x10, 0x90, 0xF9, 0xB0, 0x0D, 0x40, 0xFA, 0xD0, 0x60, 0x05,
+	0x60, 0xD0, 0xFA, 0x40, 0x0E, 0xA0, 0xFC, 0xB0, 0xA0, 0x90, 0xB0, 0xFC, 0xA0, 0x0F, 0x20, 0xE0,
+	0xFF, 0xFB, 0xE0, 0x20, 0x0F, 0x00, 0x50, 0xFF, 0xFB, 0x50, 0x0F, 0x02, 0x60, 0xFF, 0xF9, 0x60,
+	0x0F, 0x04, 0x80, 0xFF, 0xF7, 0x60, 0x0F, 0x06, 0x60, 0xFF, 0xF5, 0x60, 0x0F, 0x08, 0x30, 0xC0,
+	0xFF, 0xF1, 0xC0, 0x30, 0x0F, 0x0B, 0x60, 0xD0, 0xFD, 0xD0, 0x60, 0x0F, 0x0F, 0x60, 0xA0, 0xF9,
+	0xA0, 0x60, 0x0F, 0x0F, 0x04, 0x40, 0x70, 0x83, 0x70, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E,
+	0x60, 0x81, 0x60, 0x0F, 0x0F, 0x08, 0x10, 0x80, 0xD0, 0xF3, 0xC0, 0x30, 0x0F, 0x0F, 0x04, 0x10,
+	0x80, 0xE0, 0xF6, 0xC0, 0x0F, 0x0F, 0x03, 0x60, 0xD0, 0xF9, 0x60, 0x0F, 0x0F, 0x00, 0x30, 0xB0,
+	0xFB, 0x80, 0x0F, 0x0F, 0x80, 0xFD, 0x80, 0x0F, 0x0D, 0x20, 0xC0, 0xFE, 0x60, 0x0F, 0x0C, 0x40,
+	0xE0, 0xFE, 0xC0, 0x0F, 0x0C, 0x60, 0xFF, 0xC0, 0x30, 0x0F, 0x0B, 0x80, 0xFE, 0xD0, 0x60, 0x0F,
+	0x0C, 0x90, 0xFD, 0xD0, 0x50, 0x0F, 0x0D, 0x80, 0xFC, 0xE0, 0x60, 0x0F, 0x0E, 0x60, 0xFC, 0x80,
+	0x10, 0x0F, 0x0E, 0x40, 0xFB, 0xD0, 0x40, 0x0F, 0x0F, 0x20, 0xE0, 0xFA, 0xA0, 0x10, 0x0F, 0x0F,
+	0x00, 0xB0, 0xFA, 0x90, 0x0F, 0x0F, 0x01, 0x70, 0xFA, 0x60, 0x0F, 0x0F, 0x01, 0x20, 0xE0, 0xF9,
+	0x60, 0x0F, 0x0F, 0x02, 0x90, 0xF9, 0x90, 0x0F, 0x0F, 0x02, 0x30, 0xF9, 0xA0, 0x0F, 0x0F, 0x03,
+	0x90, 0xF8, 0xE0, 0x50, 0x70, 0x83, 0x70, 0x40, 0x0F, 0x0B, 0x20, 0xFF, 0xF3, 0xA0, 0x60, 0x10,
+	0x0F, 0x07, 0x80, 0xFF, 0xF5, 0xE0, 0x80, 0x10, 0x0F, 0x05, 0xE0, 0xFF, 0xF7, 0xE0, 0x50, 0x0F,
+	0x03, 0x50, 0xFF, 0xFA, 0x90, 0x0F, 0x02, 0x90, 0xFF, 0xFB, 0xB0, 0x10, 0x0F, 0x00, 0xE0, 0xFF,
+	0xFC, 0xB0, 0x0F, 0x30, 0xFF, 0xFE, 0x90, 0x0E, 0x80, 0xFF, 0xFF, 0x50, 0x0D, 0xA0, 0xFD, 0xE0,
+	0xB0, 0xA1, 0xB0, 0xE0, 0xFB, 0xE0, 0x10, 0x0C, 0xD0, 0xFB, 0xB0, 0x50, 0x05, 0x50, 0xB0, 0xFA,
+	0x80, 0x0C, 0xFB, 0x70, 0x09, 0x70, 0xF9, 0xE0, 0x10, 0x0A, 0x40, 0xFA, 0x50, 0x0B, 0x50, 0xF9,
+	0x60, 0x0A, 0x40, 0xF9, 0x70, 0x0D, 0x70, 0xF8, 0xA0, 0x0A, 0x70, 0xF8, 0xB0, 0x0F, 0xB0, 0xF8,
+	0x0A, 0x80, 0xF8, 0x50, 0x0F, 0x50, 0xF8, 0x40, 0x09, 0x80, 0xF7, 0xE0, 0x0F, 0x01, 0xE0, 0xF7,
+	0x70, 0x09, 0x80, 0xF7, 0xB0, 0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xA0, 0x0F, 0x01,
+	0xA0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xA0, 0x0F, 0x01, 0xA0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xB0,
+	0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x70, 0xF7, 0xE0, 0x0F, 0x01, 0xE0, 0xF7, 0x70, 0x09, 0x40,
+	0xF8, 0x50, 0x0F, 0x50, 0xF8, 0x40, 0x0A, 0xF8, 0xB0, 0x0F, 0xB0, 0xF8, 0x0B, 0xA0, 0xF8, 0x70,
+	0x0D, 0x70, 0xF8, 0xA0, 0x0B, 0x60, 0xF9, 0x50, 0x0B, 0x50, 0xF9, 0x60, 0x0B, 0x10, 0xE0, 0xF9,
+	0x70, 0x09, 0x70, 0xF9, 0xE0, 0x10, 0x0C, 0x80, 0xFA, 0xB0, 0x50, 0x05, 0x50, 0xB0, 0xFA, 0x80,
+	0x0D, 0x10, 0xE0, 0xFB, 0xE0, 0xB0, 0xA1, 0xB0, 0xE0, 0xFB, 0xE0, 0x10, 0x0E, 0x50, 0xFF, 0xFD,
+	0x50, 0x0F, 0x00, 0x90, 0xFF, 0xFB, 0x90, 0x0F, 0x02, 0xB0, 0xFF, 0xF9, 0xB0, 0x0F, 0x03, 0x10,
+	0xB0, 0xFF, 0xF7, 0xB0, 0x10, 0x0F, 0x05, 0x90, 0xFF, 0xF5, 0x90, 0x0F, 0x08, 0x50, 0xE0, 0xFF,
+	0xF1, 0xE0, 0x50, 0x0F, 0x0A, 0x10, 0x80, 0xE0, 0xFD, 0xE0, 0x80, 0x10, 0x0F, 0x0D, 0x10, 0x60,
+	0xA0, 0xF9, 0xA0, 0x60, 0x10, 0x0F, 0x0F, 0x03, 0x40, 0x70, 0x83, 0x70, 0x40, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x07, 0x60, 0x8F, 0x8D, 0x60, 0x0D, 0x30, 0xC0, 0xFF, 0xFF, 0xC0, 0x30, 0x0B, 0xC0, 0xFF,
+	0xFF, 0xF1, 0xC0, 0x0A, 0x60, 0xFF, 0xFF, 0xF3, 0x60, 0x09, 0x80, 0xFF, 0xFF, 0xF3, 0x80, 0x09,
+	0x80, 0xFF, 0xFF, 0xF3, 0x80, 0x09, 0x60, 0xFF, 0xFF, 0xF3, 0x60, 0x0A, 0xC0, 0xFF, 0xFF, 0xF1,
+	0xE0, 0x0B, 0x30, 0xC0, 0xFF, 0xFF, 0xF0, 0x90, 0x0D, 0x60, 0x8F, 0x85, 0xD0, 0xF8, 0x30, 0x0F,
+	0x0F, 0x04, 0xE0, 0xF7, 0xD0, 0x0F, 0x0F, 0x04, 0x60, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0xA0, 0xF8,
+	0x20, 0x0F, 0x0F, 0x03, 0x20, 0xF8, 0xA0, 0x0F, 0x0F, 0x04, 0x70, 0xF8, 0x60, 0x0F, 0x0F, 0x04,
+	0xD0, 0xF7, 0xE0, 0x0F, 0x0F, 0x04, 0x30, 0xF8, 0x90, 0x0F, 0x0F, 0x04, 0x90, 0xF8, 0x30, 0x0F,
+	0x0F, 0x04, 0xE0, 0xF7, 0xD0, 0x0F, 0x0F, 0x04, 0x60, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0xA0, 0xF8,
+	0x20, 0x0F, 0x0F, 0x03, 0x20, 0xF8, 0xA0, 0x0F, 0x0F, 0x04, 0x70, 0xF8, 0x60, 0x0F, 0x0F, 0x04,
+	0xD0, 0xF7, 0xE0, 0x0F, 0x0F, 0x04, 0x30, 0xF8, 0x90, 0x0F, 0x0F, 0x04, 0x90, 0xF8, 0x30, 0x0F,
+	0x0F, 0x04, 0xE0, 0xF7, 0xD0, 0x0F, 0x0F, 0x04, 0x60, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0xA0, 0xF8,
+	0x20, 0x0F, 0x0F, 0x03, 0x20, 0xF8, 0xA0, 0x0F, 0x0F, 0x04, 0x70, 0xF8, 0x60, 0x0F, 0x0F, 0x04,
+	0xD0, 0xF7, 0xE0, 0x0F, 0x0F, 0x04, 0x30, 0xF8, 0x90, 0x0F, 0x0F, 0x04, 0x90, 0xF8, 0x30, 0x0F,
+	0x0F, 0x04, 0xE0, 0xF7, 0xD0, 0x0F, 0x0F, 0x04, 0x60, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0xA0, 0xF8,
+	0x20, 0x0F, 0x0F, 0x03, 0x20, 0xF8, 0xA0, 0x0F, 0x0F, 0x04, 0x70, 0xF8, 0x60, 0x0F, 0x0F, 0x04,
+	0xD0, 0xF7, 0xE0, 0x0F, 0x0F, 0x04, 0x30, 0xF8, 0x90, 0x0F, 0x0F, 0x04, 0x90, 0xF8, 0x30, 0x0F,
+	0x0F, 0x04, 0xE0, 0xF7, 0xD0, 0x0F, 0x0F, 0x04, 0x60, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0xA0, 0xF8,
+	0x20, 0x0F, 0x0F, 0x03, 0x20, 0xF8, 0xA0, 0x0F, 0x0F, 0x04, 0x70, 0xF8, 0x60, 0x0F, 0x0F, 0x04,
+	0xD0, 0xF7, 0xE0, 0x0F, 0x0F, 0x04, 0x30, 0xF8, 0x90, 0x0F, 0x0F, 0x04, 0x90, 0xF8, 0x30, 0x0F,
+	0x0F, 0x04, 0xE0, 0xF7, 0xD0, 0x0F, 0x0F, 0x04, 0x60, 0xF8, 0x70, 0x0F, 0x0F, 0x04, 0x80, 0xF8,
+	0x20, 0x0F, 0x0F, 0x04, 0x80, 0xF7, 0xA0, 0x0F, 0x0F, 0x05, 0x60, 0xF7, 0x60, 0x0F, 0x0F, 0x06,
+	0xC0, 0xF5, 0xC0, 0x0F, 0x0F, 0x07, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x0F, 0x0F, 0x09, 0x60, 0x81,
+	0x60, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x40, 0x70, 0x83, 0x70, 0x40, 0x0F, 0x0F, 0x04, 0x60,
+	0xA0, 0xF9, 0xA0, 0x60, 0x0F, 0x0F, 0x60, 0xD0, 0xFD, 0xD0, 0x60, 0x0F, 0x0B, 0x20, 0xB0, 0xFF,
+	0xF1, 0xB0, 0x20, 0x0F, 0x08, 0x40, 0xE0, 0xFF, 0xF3, 0xE0, 0x40, 0x0F, 0x06, 0x40, 0xFF, 0xF7,
+	0x40, 0x0F, 0x04, 0x30, 0xE0, 0xFF, 0xF7, 0xE0, 0x30, 0x0F, 0x02, 0x10, 0xC0, 0xFF, 0xF9, 0xC0,
+	0x10, 0x0F, 0x01, 0x80, 0xFF, 0xFB, 0x80, 0x0F, 0x00, 0x20, 0xFC, 0xB0, 0xA1, 0xB0, 0xFC, 0x20,
+	0x0F, 0x80, 0xF9, 0xD0, 0x60, 0x05, 0x60, 0xD0, 0xF9, 0x80, 0x0F, 0xD0, 0xF8, 0xC0, 0x10, 0x07,
+	0x10, 0xC0, 0xF8, 0xD0, 0x0E, 0x30, 0xF8, 0xC0, 0x10, 0x09, 0x10, 0xC0, 0xF8, 0x30, 0x0D, 0x60,
+	0xF8, 0x40, 0x0B, 0x40, 0xF8, 0x60, 0x0D, 0x80, 0xF7, 0xC0, 0x0D, 0xC0, 0xF7, 0x80, 0x0D, 0x80,
+	0xF7, 0xA0, 0x0D, 0xA0, 0xF7, 0x80, 0x0D, 0x80, 0xF7, 0xA0, 0x0D, 0xA0, 0xF7, 0x80, 0x0D, 0x80,
+	0xF7, 0xC0, 0x0D, 0xC0, 0xF7, 0x80, 0x0D, 0x60, 0xF8, 0x40, 0x0B, 0x40, 0xF8, 0x60, 0x0D, 0x30,
+	0xF8, 0xC0, 0x10, 0x09, 0x10, 0xC0, 0xF8, 0x30, 0x0E, 0xD0, 0xF8, 0xC0, 0x10, 0x07, 0x10, 0xC0,
+	0xF8, 0xD0, 0x0F, 0x80, 0xF9, 0xD0, 0x60, 0x05, 0x60, 0xD0, 0xF9, 0x80, 0x0F, 0x20, 0xFC, 0xB0,
+	0xA1, 0xB0, 0xFC, 0x20, 0x0F, 0x00, 0x80, 0xFF, 0xFB, 0x80, 0x0F, 0x01, 0x10, 0xC0, 0xFF, 0xF9,
+	0xC0, 0x10, 0x0F, 0x02, 0x30, 0xE0, 0xFF, 0xF7, 0xE0, 0x30, 0x0F, 0x04, 0x40, 0xFF, 0xF7, 0x40,
+	0x0F, 0x06, 0x60, 0xFF, 0xF5, 0x60, 0x0F, 0x06, 0x50, 0xE0, 0xFF, 0xF5, 0xE0, 0x50, 0x0F, 0x04,
+	0x60, 0xFF, 0xF9, 0x60, 0x0F, 0x02, 0x60, 0xFF, 0xFB, 0x60, 0x0F, 0x00, 0x40, 0xFF, 0xFD, 0x40,
+	0x0E, 0x10, 0xE0, 0xFF, 0xFD, 0xE0, 0x10, 0x0D, 0x80, 0xFC, 0xD0, 0xB0, 0xA1, 0xB0, 0xD0, 0xFC,
+	0x80, 0x0C, 0x20, 0xFA, 0xE0, 0x80, 0x30, 0x05, 0x30, 0x80, 0xE0, 0xFA, 0x20, 0x0B, 0x80, 0xF9,
+	0xA0, 0x10, 0x09, 0x10, 0xA0, 0xF9, 0x80, 0x0B, 0xD0, 0xF8, 0x90, 0x0D, 0x90, 0xF8, 0xD0, 0x0A,
+	0x20, 0xF8, 0xB0, 0x0F, 0xB0, 0xF8, 0x20, 0x09, 0x60, 0xF8, 0x40, 0x0F, 0x40, 0xF8, 0x60, 0x09,
+	0x80, 0xF7, 0xC0, 0x0F, 0x01, 0xC0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xA0, 0x0F, 0x01, 0xA0, 0xF7,
+	0x80, 0x09, 0x80, 0xF7, 0xA0, 0x0F, 0x01, 0xA0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xC0, 0x0F, 0x01,
+	0xC0, 0xF7, 0x80, 0x09, 0x60, 0xF8, 0x40, 0x0F, 0x40, 0xF8, 0x60, 0x09, 0x20, 0xF8, 0xB0, 0x0F,
+	0xB0, 0xF8, 0x20, 0x0A, 0xD0, 0xF8, 0x90, 0x0D, 0x90, 0xF8, 0xD0, 0x0B, 0x80, 0xF9, 0xA0, 0x10,
+	0x09, 0x10, 0xA0, 0xF9, 0x80, 0x0B, 0x20, 0xFA, 0xE0, 0x80, 0x30, 0x05, 0x30, 0x80, 0xE0, 0xFA,
+	0x20, 0x0C, 0x80, 0xFC, 0xD0, 0xB0, 0xA1, 0xB0, 0xD0, 0xFC, 0x80, 0x0D, 0x10, 0xE0, 0xFF, 0xFD,
+	0xE0, 0x10, 0x0E, 0x40, 0xFF, 0xFD, 0x40, 0x0F, 0x00, 0x60, 0xFF, 0xFB, 0x60, 0x0F, 0x02, 0x60,
+	0xFF, 0xF9, 0x60, 0x0F, 0x04, 0x50, 0xE0, 0xFF, 0xF5, 0xE0, 0x50, 0x0F, 0x06, 0x20, 0xA0, 0xFF,
+	0xF3, 0xA0, 0x20, 0x0F, 0x09, 0x40, 0xB0, 0xFF, 0xB0, 0x40, 0x0F, 0x0D, 0x20, 0x80, 0xC0, 0xF9,
+	0xC0, 0x80, 0x20, 0x0F, 0x0F, 0x02, 0x20, 0x40, 0x85, 0x40, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x03, 0x40, 0x70, 0x83, 0x70, 0x40, 0x0F, 0x0F, 0x03, 0x10, 0x60, 0xA0, 0xF9, 0xA0, 0x60, 0x10,
+	0x0F, 0x0D, 0x10, 0x80, 0xE0, 0xFD, 0xE0, 0x80, 0x10, 0x0F, 0x0A, 0x50, 0xE0, 0xFF, 0xF1, 0xE0,
+	0x50, 0x0F, 0x08, 0x90, 0xFF, 0xF5, 0x90, 0x0F, 0x05, 0x10, 0xB0, 0xFF, 0xF7, 0xB0, 0x10, 0x0F,
+	0x03, 0xB0, 0xFF, 0xF9, 0xB0, 0x0F, 0x02, 0x90, 0xFF, 0xFB, 0x90, 0x0F, 0x00, 0x50, 0xFF, 0xFD,
+	0x50, 0x0E, 0x10, 0xE0, 0xFB, 0xE0, 0xB0, 0xA1, 0xB0, 0xE0, 0xFB, 0xE0, 0x10, 0x0D, 0x80, 0xFA,
+	0xB0, 0x50, 0x05, 0x50, 0xB0, 0xFA, 0x80, 0x0C, 0x10, 0xE0, 0xF9, 0x70, 0x09, 0x70, 0xF9, 0xE0,
+	0x10, 0x0B, 0x60, 0xF9, 0x50, 0x0B, 0x50, 0xF9, 0x60, 0x0B, 0xA0, 0xF8, 0x70, 0x0D, 0x70, 0xF8,
+	0xA0, 0x0B, 0xF8, 0xB0, 0x0F, 0xB0, 0xF8, 0x0A, 0x40, 0xF8, 0x50, 0x0F, 0x50, 0xF8, 0x40, 0x09,
+	0x70, 0xF7, 0xE0, 0x0F, 0x01, 0xE0, 0xF7, 0x70, 0x09, 0x80, 0xF7, 0xB0, 0x0F, 0x01, 0xB0, 0xF7,
+	0x80, 0x09, 0x80, 0xF7, 0xA0, 0x0F, 0x01, 0xA0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xA0, 0x0F, 0x01,
+	0xA0, 0xF7, 0x80, 0x09, 0x80, 0xF7, 0xB0, 0x0F, 0x01, 0xB0, 0xF7, 0x80, 0x09, 0x70, 0xF7, 0xE0,
+	0x0F, 0x01, 0xE0, 0xF7, 0x80, 0x09, 0x40, 0xF8, 0x50, 0x0F, 0x50, 0xF8, 0x80, 0x0A, 0xF8, 0xB0,
+	0x0F, 0xB0, 0xF8, 0x70, 0x0A, 0xA0, 0xF8, 0x70, 0x0D, 0x70, 0xF9, 0x40, 0x0A, 0x60, 0xF9, 0x50,
+	0x0B, 0x50, 0xFA, 0x40, 0x0A, 0x10, 0xE0, 0xF9, 0x70, 0x09, 0x70, 0xFB, 0x0C, 0x80, 0xFA, 0xB0,
+	0x50, 0x05, 0x50, 0xB0, 0xFB, 0xD0, 0x0C, 0x10, 0xE0, 0xFB, 0xE0, 0xB0, 0xA1, 0xB0, 0xE0, 0xFD,
+	0xA0, 0x0D, 0x50, 0xFF, 0xFF, 0x80, 0x0E, 0x90, 0xFF, 0xFE, 0x30, 0x0F, 0xB0, 0xFF, 0xFC, 0xE0,
+	0x0F, 0x00, 0x10, 0xB0, 0xFF, 0xFB, 0x90, 0x0F, 0x02, 0x90, 0xFF, 0xFA, 0x50, 0x0F, 0x03, 0x50,
+	0xE0, 0xFF, 0xF7, 0xE0, 0x0F, 0x05, 0x10, 0x80, 0xE0, 0xFF, 0xF5, 0x80, 0x0F, 0x07, 0x10, 0x60,
+	0xA0, 0xFF, 0xF3, 0x20, 0x0F, 0x0B, 0x40, 0x70, 0x83, 0x70, 0x50, 0xE0, 0xF8, 0x90, 0x0F, 0x0F,
+	0x03, 0xA0, 0xF9, 0x30, 0x0F, 0x0F, 0x02, 0x90, 0xF9, 0x90, 0x0F, 0x0F, 0x02, 0x60, 0xF9, 0xE0,
+	0x20, 0x0F, 0x0F, 0x01, 0x60, 0xFA, 0x70, 0x0F, 0x0F, 0x01, 0x90, 0xFA, 0xB0, 0x0F, 0x0F, 0x00,
+	0x10, 0xA0, 0xFA, 0xE0, 0x20, 0x0F, 0x0F, 0x40, 0xD0, 0xFB, 0x40, 0x0F, 0x0E, 0x10, 0x80, 0xFC,
+	0x60, 0x0F, 0x0E, 0x60, 0xE0, 0xFC, 0x80, 0x0F, 0x0D, 0x50, 0xD0, 0xFD, 0x90, 0x0F, 0x0C, 0x60,
+	0xD0, 0xFE, 0x80, 0x0F, 0x0B, 0x30, 0xC0, 0xFF, 0x60, 0x0F, 0x0C, 0xC0, 0xFE, 0xE0, 0x40, 0x0F,
+	0x0C, 0x60, 0xFE, 0xC0, 0x20, 0x0F, 0x0D, 0x80, 0xFD, 0x80, 0x0F, 0x0F, 0x80, 0xFB, 0xB0, 0x30,
+	0x0F, 0x0F, 0x00, 0x60, 0xF9, 0xD0, 0x60, 0x0F, 0x0F, 0x03, 0xC0, 0xF6, 0xE0, 0x80, 0x10, 0x0F,
+	0x0F, 0x04, 0x30, 0xC0, 0xF3, 0xD0, 0x80, 0x10, 0x0F, 0x0F, 0x08, 0x60, 0x81, 0x60, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E
+};
@@ -4,12 +4,20 @@
   * @author Niklas Henderson
   * @author Nicholas Chan
   * @date 10/5/2010.
-  */   
-  
+  */
+
 #include "main.h"
 #include "setup.h"
 #include "screens.h"
 #include "draw_functions.h"
+#include "glyph_atlas.h"
+#include "layers.h"
+#include "starfield.h"
+#include "transitions.h"
+#include "frame_pacer.h"
+#include "governor.h"
+#include "bus.h"
+#include "widgets.h"
 
 /**
   * @brief A variable of type GLCD_FONT denoting the font size of 6x8.
@@ -21,214 +29,358 @@ extern GLCD_FONT 		GLCD_Font_6x8;
   */
 extern GLCD_FONT 		GLCD_Font_16x24;
 
-// For debugging purposes
-//extern char buffer[5];
-//extern char buffer2[5];
-//extern char buffer3[5];
-
 /**
   * @brief A variable indicating the current score of player 1.
   */
-extern int player1Score;
+static int player1Score = 0;
 
 /**
   * @brief A variable indicating the current score of player 2.
   */
-extern int player2Score;
+static int player2Score = 0;
 
 /**
-  * @brief A variable used to check IR sensor value for player 1.
+  * @brief Subscriber numbers of the UI on the score and lid topics.
   */
-int lastPlayer1 = 500;
+static int scoreSubscriber = -1;
+static int lidSubscriber = -1;
 
 /**
-  * @brief A variable used to check IR sensor value for player 2.
+  * @brief Number of characters a score is drawn with, right-aligned.
   */
-int lastPlayer2 = 500;
+#define SCORE_WIDTH 3
 
 /**
-  * @brief A variable inidicating current IR sensor value for player 1,
-  *        used to compare with lastPlayer1 to determine if player 2 has scored.
+  * @brief Widget ids of the "home" and "game" screens.
   */
-int currentPlayer1;
+static int startButton;
+static int backButton;
+static int player1Field;
+static int player2Field;
 
 /**
-  * @brief A variable inidicating current IR sensor value for player 2,
-  *        used to compare with lastPlayer2 to determine if player 1 has scored.
+  * @brief The screen currently shown on the GLCD.
   */
-int currentPlayer2;
+static enum screen currentScreen = Home;
 
 /**
-  * @brief A variable used store player1Score, to be used for displaying on GLCD screen.
+  * @brief Connection status and settings passed to screenRun.
   */
-char player1Buffer[2];
+static settings* screenSettings;
 
 /**
-  * @brief A variable used store player2Score, to be used for displaying on GLCD screen.
+  * @brief Latest lid state reported by the light sensor, true when open.
   */
-char player2Buffer[2];
+static bool lidOpen = false;
+
+/**
+  * @brief A variable indicating if the game can be started from the "home" screen.
+  */
+static bool ready;
 
 /**
   * @brief A function used to display the "error" screen on the GLCD.
-  * @param currentScreen variable to determine which screen the GLCD should display.
-  * @param tsc_state a variable to check if a "button" is pressed on the GLCD screen.
+  * @param None.
   * @returns Void.
   */
-void error(enum screen* currentScreen, TOUCH_STATE* tsc_state){
-	int counter;
-	int lightValue = 0;
-	int averageLight = 0;
+static void errorEnter(void){
 	player2Score = 0;
 	player1Score = 0;
 	drawBackground();
-	GLCD_SetFont(&GLCD_Font_16x24);
-	GLCD_SetForegroundColor (GLCD_COLOR_YELLOW);
-	GLCD_DrawString (170, 50, "Error. Lid open");
+	layerCommitBackground();
+	widgetsClear();
+	widgetAddLabel(170, 50, "Error. Lid open", &GLCD_Font_16x24, GLCD_COLOR_YELLOW, LAYER_HUD_BACKGROUND);
+	widgetsDraw();
     // When lid is opened, enable the amber LED and disable the green LED
 	enablePin(5);
 	resetPin(7);
-	 
-	for(;;){
-        // For checking if lid is close by utilising the light sensor value
-		// GLCD_DrawString (330, 250, buffer3);
-		averageLight = 0;
-		for(counter=0; counter<20; counter++){
-				sscanf(buffer3, "%d", &lightValue);
-				averageLight += lightValue;
-		}
-		averageLight = averageLight/20;
-		
-		if(averageLight > 4050){
-			*currentScreen = Game;
-			break;
-		}
+}
+
+/**
+  * @brief Handles an event on the "error" screen, returns to the game once the lid is closed.
+  * @param e The event to handle.
+  * @returns The screen to show next.
+  */
+static enum screen errorUpdate(const event* e){
+	if(e->type == EventLid && e->value == 0){
+		return Game;
 	}
-	
+	return Error;
+}
+
+/**
+  * @brief Leaves the "error" screen.
+  * @param None.
+  * @returns Void.
+  */
+static void errorExit(void){
 }
 
 /**
   * @brief A function used to display the "home" screen on the GLCD.
-  * @param currentScreen Variable to determine which screen the GLCD should display.
-  * @param tsc_state A variable to check if a "button" is pressed on the GLCD screen.
-  * @param curSettings For checking if both player are connected
+  * @param None.
   * @returns Void.
   */
-void home(enum screen* currentScreen, TOUCH_STATE* tsc_state, settings* curSettings) {
-	char* devicesString = (char*)malloc(13 * sizeof(char));
-	bool ready = true;
+static void homeEnter(void) {
+	ready = true;
 	player2Score = 0;
 	player1Score = 0;
-	drawBackground();
+	drawBorders();
 
 	GLCD_SetFont(&GLCD_Font_16x24);
 	GLCD_SetForegroundColor (GLCD_COLOR_YELLOW);
 	GLCD_DrawString (200, 50, "Home");
-	
-	GLCD_SetFont(&GLCD_Font_6x8);
-	
-	GLCD_SetForegroundColor (GLCD_COLOR_LIGHT_GREY);
-	GLCD_DrawBargraph(170, 150, 130, 50, 100);
-	GLCD_SetForegroundColor (GLCD_COLOR_YELLOW);
-	GLCD_SetBackgroundColor (GLCD_COLOR_LIGHT_GREY);
-	
-	if(curSettings->connectedCount == 2 & curSettings->connection == true){
+	layerCommitBackground();
+
+	if(screenSettings->connectedCount == 2 && screenSettings->connection == true){
 		ready = true;
-		GLCD_DrawString (195, 170, "START GAME");
-	}else{
-		GLCD_DrawString (190, 170, "START GAME");
 	}
+	widgetsClear();
+	startButton = widgetAddButton(170, 150, 130, 50, "START GAME", &GLCD_Font_6x8,
+			GLCD_COLOR_YELLOW, GLCD_COLOR_LIGHT_GREY);
+	widgetsDraw();
+
+	// The home screen is the attract screen, its stars scroll until the game starts
+	starfieldReset();
+	starfieldExclude(200, 50, 64, 24);
+	starfieldExclude(170, 150, 130, 50);
+}
 
-	while(1){
-		Touch_GetState(tsc_state); 
-		if(tsc_state->pressed){
-			if(tsc_state->x > 170 & tsc_state->x <300
-						& tsc_state->y > 150 & tsc_state->y < 200
-						& ready == true){
-						*currentScreen = Game;
-						return;
-			}}
+/**
+  * @brief Handles an event on the "home" screen: animates the stars every frame
+  *        and starts the game when the button is touched.
+  * @param e The event to handle.
+  * @returns The screen to show next.
+  */
+static enum screen homeUpdate(const event* e){
+	if(e->type == EventFrame){
+		starfieldStep();
+		return Home;
 	}
-	return;
+	if(e->type == EventTouch && e->touch.type != TouchUp){
+		if(widgetHit(e->touch.x, e->touch.y) == startButton && ready == true){
+			return Game;
+		}
+	}
+	return Home;
+}
+
+/**
+  * @brief Leaves the "home" screen.
+  * @param None.
+  * @returns Void.
+  */
+static void homeExit(void){
 }
 
 /**
   * @brief A function used to display the "game" screen on the GLCD.
-  * @param currentScreen Variable to determine which screen the GLCD should display.
-  * @param tsc_state A variable to check if a "button" is pressed on the GLCD screen.
-  * @param curSettings For checking if both player are connected
+  * @param None.
   * @returns Void.
   */
-void game(enum screen* currentScreen, TOUCH_STATE* tsc_state, settings* curSettings){
-	int lightValue = 0;
-	int averageLight = 0;
-	int counter;
+static void gameEnter(void){
 	drawBackground();
 	GLCD_SetFont(&GLCD_Font_16x24);
 	GLCD_SetForegroundColor (GLCD_COLOR_YELLOW);
 	GLCD_DrawString (70, 50, "Player 1");
 	GLCD_DrawString (270, 50, "Player 2");
-	
-	GLCD_DrawVLine(240, 25, 222);	
-	
-	GLCD_SetFont(&GLCD_Font_6x8);
-	GLCD_SetForegroundColor (GLCD_COLOR_LIGHT_GREY);
-	GLCD_DrawBargraph(20, 20, 50, 30, 100);
-	GLCD_SetForegroundColor (GLCD_COLOR_YELLOW);
-	GLCD_SetBackgroundColor (GLCD_COLOR_LIGHT_GREY);
-	GLCD_DrawString (30, 30, "back");
 
-	GLCD_SetBackgroundColor (GLCD_COLOR_BLACK);
-	GLCD_SetFont(&GLCD_Font_16x24);
+	GLCD_DrawVLine(240, 25, 222);
+	layerCommitBackground();
+
+	widgetsClear();
+	backButton = widgetAddButton(20, 20, 50, 30, "back", &GLCD_Font_6x8, GLCD_COLOR_YELLOW, GLCD_COLOR_LIGHT_GREY);
+	player1Field = widgetAddScore(62, 110, SCORE_WIDTH, GLCD_COLOR_YELLOW, LAYER_HUD_BACKGROUND, player1Score);
+	player2Field = widgetAddScore(262, 110, SCORE_WIDTH, GLCD_COLOR_YELLOW, LAYER_HUD_BACKGROUND, player2Score);
+	widgetsDraw();
 
 	enablePin(7);
 	resetPin(5);
-	
-	while(1){
-		Touch_GetState(tsc_state); 
-		if(tsc_state->pressed){
-			if(tsc_state->x > 20 & tsc_state->x <70
-					& tsc_state->y > 20 & tsc_state->y < 50){
-					*currentScreen = Home;
-					return;
+
+	// The lid may have been opened before the game started
+	if(lidOpen){
+		postEvent(EventLid, 1);
+	}
+}
+
+/**
+  * @brief Handles an event on the "game" screen: back button, scoring and lid opening.
+  * @param e The event to handle.
+  * @returns The screen to show next.
+  */
+static enum screen gameUpdate(const event* e){
+	switch(e->type){
+		case EventTouch:
+			if(e->touch.type != TouchUp && widgetHit(e->touch.x, e->touch.y) == backButton){
+				return Home;
 			}
+			break;
+		case EventScore:
+			if(e->value == 1){
+				player1Score++;
+			}else{
+				player2Score++;
+			}
+			// Drawn with the next frame
+			widgetSetValue(player1Field, player1Score);
+			widgetSetValue(player2Field, player2Score);
+			break;
+		case EventLid:
+			if(e->value == 1){
+				return Error;
+			}
+			break;
+		default:
+			break;
+	}
+	return Game;
+}
+
+/**
+  * @brief Leaves the "game" screen.
+  * @param None.
+  * @returns Void.
+  */
+static void gameExit(void){
+}
+
+/**
+  * @brief Hooks of every screen, indexed by enum screen.
+  */
+static const screenHooks screenTable[] = {
+	{homeEnter, homeUpdate, homeExit},
+	{gameEnter, gameUpdate, gameExit},
+	{errorEnter, errorUpdate, errorExit}
+};
+
+/**
+  * @brief Transition used between each pair of screens, indexed by the screen left and the screen entered.
+  */
+static const enum transitionType transitionTable[3][3] = {
+	/* from Home */  {TransitionCut, TransitionSlide, TransitionWipe},
+	/* from Game */  {TransitionSlide, TransitionCut, TransitionWipe},
+	/* from Error */ {TransitionFade, TransitionFade, TransitionCut}
+};
+
+/**
+  * @brief Posts an EventBus for a topic the UI subscribes to, from the publishing thread.
+  * @param topic The topic with new messages.
+  * @returns False if the event queue is full, the bus then notifies again with the next message.
+  */
+static bool notifyUi(enum busTopic topic){
+	return postEvent(EventBus, topic);
+}
+
+/**
+  * @brief Subscribes the UI to the score and lid topics. Call before the analog thread starts,
+  *        so the first lid state is not missed.
+  * @param None.
+  * @returns Void.
+  */
+void screensInitialize(void){
+	scoreSubscriber = busSubscribe(TopicScore, notifyUi);
+	lidSubscriber = busSubscribe(TopicLid, notifyUi);
+}
+
+/**
+  * @brief Passes one event to the current screen, switching screens when its update hook asks to.
+  *        Every dispatched event is one frame for the profiler.
+  * @param e The event.
+  * @returns Void.
+  */
+static void dispatch(const event* e){
+	enum screen next;
+
+	profFrameBegin();
+	if(e->type == EventLid){
+		lidOpen = (e->value == 1);
+	}
+	next = screenTable[currentScreen].update(e);
+	if(next != currentScreen){
+		// Clocks go up before the new screen is drawn and down only once the transition is over
+		governorBeforeScreen(next);
+		// The old screen stays on the display while the new one is drawn off-screen
+		transitionBegin();
+		screenTable[currentScreen].exit();
+		screenTable[next].enter();
+		transitionRun(transitionTable[currentScreen][next]);
+		currentScreen = next;
+		governorAfterScreen(currentScreen);
+	}else if(e->type == EventFrame){
+		widgetsDraw();
+	}
+	if(e->type == EventFrame){
+		framePacerEnd();
+	}
+	profFrameEnd();
+}
+
+/**
+  * @brief Reads every waiting message of a topic and dispatches it as the matching event.
+  * @param topic The topic named by an EventBus.
+  * @returns Void.
+  */
+static void dispatchTopic(enum busTopic topic){
+	event e = {EventScore};
+	const busScore* score;
+	const busLid* lid;
+
+	if(topic == TopicScore){
+		while((score = (const busScore*)busPeek(TopicScore, scoreSubscriber)) != NULL){
+			e.type = EventScore;
+			e.value = score->player;
+			busRelease(TopicScore, scoreSubscriber);
+			dispatch(&e);
 		}
-		sprintf(player1Buffer, "%d", player1Score);
-		sprintf(player2Buffer, "%d", player2Score);
-		
-		GLCD_DrawString (110, 120, player1Buffer);
-	    GLCD_DrawString (330, 120, player2Buffer);
-
-		//sscanf(buffer, "%d", &currentPlayer1);
-		//sscanf(buffer2, "%d", &currentPlayer2);
-		
-		if (lastPlayer1 - currentPlayer1 > 50){
-			player1Score++;
-		}
-		lastPlayer1 = currentPlayer1;
-		
-		if(currentPlayer2 < 125){
-			player2Score++;
-		}else if (lastPlayer2 - currentPlayer2  > 40){
-			player2Score++;
+	}else if(topic == TopicLid){
+		while((lid = (const busLid*)busPeek(TopicLid, lidSubscriber)) != NULL){
+			e.type = EventLid;
+			e.value = lid->open ? 1 : 0;
+			busRelease(TopicLid, lidSubscriber);
+			dispatch(&e);
 		}
-		lastPlayer2 = currentPlayer2;
-		
-		averageLight = 0;
-		for(counter=0; counter<5; counter++){
-			sscanf(buffer3, "%d", &lightValue);
-			averageLight += lightValue;
+	}
+}
+
+/**
+  * @brief Returns the screen shown.
+  * @param None.
+  * @returns The screen, Home before screenRun.
+  */
+enum screen screenCurrent(void){
+	return currentScreen;
+}
+
+/**
+  * @brief Runs the screen state machine. Sleeps on the event queue and passes every
+  *        event to the current screen, switching screens when its update hook asks to.
+  *        Scores and lid changes arrive on the bus and are passed on as EventScore and EventLid.
+  *        Widgets changed by the events are drawn once per EventFrame, after the frame's own update.
+  * @param first The screen to show first.
+  * @param curSettings For checking if both player are connected.
+  * @returns Never.
+  */
+void screenRun(enum screen first, settings* curSettings){
+	event e;
+
+	screenSettings = curSettings;
+	currentScreen = first;
+	governorBeforeScreen(currentScreen);
+	profFrameBegin();
+	screenTable[currentScreen].enter();
+	profFrameEnd();
+	governorAfterScreen(currentScreen);
+
+	for(;;){
+		waitEvent(&e, osWaitForever);
+		// A frame event with no new tick was merged into the one before
+		if(e.type == EventFrame && framePacerBegin() == 0){
+			continue;
 		}
-		averageLight = averageLight/5;
-		
-		if(averageLight < 3700){
-			*currentScreen = Error;
-			break;
+		if(e.type == EventBus){
+			dispatchTopic((enum busTopic)e.value);
+		}else{
+			dispatch(&e);
 		}
-		
-		osDelay(10);
 	}
-	
-	return;
 }
-	
-	
@@ -6,8 +6,11 @@
   * @date 10/5/2010.
   */ 
 
-#include "Board_Touch.h"
+#ifndef SCREENS_H
+#define SCREENS_H
+
 #include <stdbool.h>
+#include "events.h"
 
 /**
   * @brief An enum containing different type of GUI screens
@@ -27,6 +30,19 @@ typedef struct{
 	char* ip;
 	}settings;
 
-void home(enum screen* currentScreen, TOUCH_STATE* tsc_state, settings* curSettings);
-void game(enum screen* currentScreen, TOUCH_STATE* tsc_state, settings* curSettings);
-void error(enum screen* currentScreen, TOUCH_STATE* tsc_state);
+/**
+  * @brief A struct containing the hooks of a screen.
+  *        enter draws the screen, update handles one event and returns the screen to show next,
+  *        exit releases anything enter acquired.
+  */
+typedef struct{
+	void (*enter)(void);
+	enum screen (*update)(const event* e);
+	void (*exit)(void);
+	}screenHooks;
+
+void screensInitialize(void);
+void screenRun(enum screen first, settings* curSettings);
+enum screen screenCurrent(void);
+
+#endif
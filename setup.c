@@ -11,6 +11,7 @@
 #include "Board_LED.h"
 #include "cmsis_os.h"
 #include "setup.h"
+#include "platform.h"
 
 /**
   * @brief A variable containing GPIO pin numbers according to the discovery board pin number.
@@ -29,40 +30,35 @@ extern uint32_t os_time;
 uint32_t HAL_GetTick(void) {
 	return os_time;
 } 
+
+/**
+  * @brief Called by the HAL whenever the core clock changes. Starts the SysTick the first time like the HAL does,
+  *        afterwards the kernel owns it and only the reload is changed, keeping the tick in progress.
+  * @param TickPriority Interrupt priority of the SysTick.
+  * @returns HAL_OK.
+  */
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority) {
+	if((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) == 0){
+		SysTick_Config(SystemCoreClock / CLOCK_TICK_HZ);
+		HAL_NVIC_SetPriority(SysTick_IRQn, TickPriority, 0);
+	}else{
+		platformRetuneTick();
+	}
+	return HAL_OK;
+}
 #endif
 
 /**
-  * @brief GPIO clocks and timers configuration.
+  * @brief GPIO clocks and timers configuration. The core clocks start in PLATFORM_DEFAULT_PROFILE.
   * @param None.
   * @returns Void.
   */
 void SystemClock_Config(void) {
-	RCC_OscInitTypeDef RCC_OscInitStruct;
-	RCC_ClkInitTypeDef RCC_ClkInitStruct;
 	/* Enable Power Control clock */
 	__HAL_RCC_PWR_CLK_ENABLE();
 	__HAL_RCC_TIM3_CLK_ENABLE();
 	__HAL_RCC_TIM12_CLK_ENABLE();
-	__HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE3);
-	RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSE;
-	RCC_OscInitStruct.HSEState = RCC_HSE_ON;
-	RCC_OscInitStruct.PLL.PLLState = RCC_PLL_ON;
-	RCC_OscInitStruct.PLL.PLLSource = RCC_PLLSOURCE_HSE;
-	RCC_OscInitStruct.PLL.PLLM = 25;
-	RCC_OscInitStruct.PLL.PLLN = 336;
-	RCC_OscInitStruct.PLL.PLLP = RCC_PLLP_DIV2;
-	RCC_OscInitStruct.PLL.PLLQ = 7;
-	HAL_RCC_OscConfig(&RCC_OscInitStruct);
-
-	RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_SYSCLK |
-	RCC_CLOCKTYPE_PCLK1 |
-	RCC_CLOCKTYPE_PCLK2;
-	RCC_ClkInitStruct.SYSCLKSource =
-	RCC_SYSCLKSOURCE_PLLCLK;
-	RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-	RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV4;
-	RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV2;
-	HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_5);
+	platformSetProfile(PLATFORM_DEFAULT_PROFILE);
 }
 
 /**
@@ -0,0 +1,208 @@
+/**
+  * @file stack_watch.c
+  * @brief Define functions that measure the peak stack usage of each thread.
+  *        A watched stack is filled with STACK_WATCH_PATTERN when it is created and holds STACK_WATCH_CANARY in
+  *        its lowest word. The peak is found by counting the pattern words left above the canary, and a
+  *        changed canary means the stack overflowed. On the target RTX fills the stacks itself with OS_STKINIT,
+  *        and each thread adds its own with stackWatchAddCurrent as it starts. Stacks the program allocates,
+  *        like those of a host build, are filled with stackWatchPaint and added with stackWatchAdd; on the host
+  *        stackWatchAddCurrent finds the stack cmsis_os_soft.c painted for the calling thread.
+  *        The report lists a suggested size for each thread; to use them, set them as the stacksz of the
+  *        osThreadDef and raise OS_PRIVCNT and OS_PRIVSTKSIZE in RTX_Conf_CM.c to match.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stddef.h>
+#include "stack_watch.h"
+#ifdef GLCD_SOFT
+#include "cmsis_os_soft.h"
+#else
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief Start of the internal RAM, the DTCM. The search for a thread's canary stops there.
+  */
+#define STACK_WATCH_RAM_BASE 0x20000000
+
+/**
+  * @brief A struct containing a watched stack.
+  */
+typedef struct{
+	const char* name;
+	uint32_t* base;
+	uint32_t size;
+	}watchedStack;
+
+/**
+  * @brief The watched stacks, in the order they were added.
+  */
+static watchedStack stacks[STACK_WATCH_STACKS];
+
+/**
+  * @brief Number of watched stacks.
+  */
+static volatile int stackCount = 0;
+
+/**
+  * @brief Fills a stack with the pattern and puts the canary in its lowest word.
+  *        Only for stacks not in use, the host build fills the stacks of its threads with it.
+  * @param base Lowest address of the stack, word aligned.
+  * @param size Bytes in the stack.
+  * @returns Void.
+  */
+void stackWatchPaint(void* base, uint32_t size){
+	uint32_t* word = (uint32_t*)base;
+	uint32_t i;
+
+	word[0] = STACK_WATCH_CANARY;
+	for(i = 1; i < size / 4; i++){
+		word[i] = STACK_WATCH_PATTERN;
+	}
+}
+
+/**
+  * @brief Adds a stack to watch.
+  * @param name Name in the report, kept by reference.
+  * @param base Lowest address of the stack, where the canary is.
+  * @param size Bytes in the stack.
+  * @returns Index of the stack, -1 if STACK_WATCH_STACKS are already watched.
+  */
+int stackWatchAdd(const char* name, void* base, uint32_t size){
+	int index;
+#ifndef GLCD_SOFT
+	uint32_t mask = __get_PRIMASK();
+	__disable_irq();
+#endif
+	index = stackCount;
+	if(index < STACK_WATCH_STACKS){
+		stacks[index].name = name;
+		stacks[index].base = (uint32_t*)base;
+		stacks[index].size = size;
+		stackCount = index + 1;
+	}else{
+		index = -1;
+	}
+#ifndef GLCD_SOFT
+	__set_PRIMASK(mask);
+#endif
+	return index;
+}
+
+#ifndef GLCD_SOFT
+
+/**
+  * @brief Adds the stack of the calling thread. Call first thing in the thread function, while the stack
+  *        below the thread is still as RTX created it. The canary is searched for from the stack pointer down.
+  * @param name Name in the report, kept by reference.
+  * @param size Bytes in the stack: the stacksz of its osThreadDef, STACK_WATCH_DEFAULT_SIZE for 0, or
+  *        STACK_WATCH_MAIN_SIZE for the main thread.
+  * @returns Index of the stack, -1 if the canary was not found or STACK_WATCH_STACKS are already watched.
+  */
+int stackWatchAddCurrent(const char* name, uint32_t size){
+	uint32_t* word = (uint32_t*)(__get_PSP() & ~3u);
+	uint32_t* lowest = (uint32_t*)((uint32_t)word - size);
+
+	if((uint32_t)word - STACK_WATCH_RAM_BASE < size){
+		lowest = (uint32_t*)STACK_WATCH_RAM_BASE;
+	}
+	for(; word >= lowest; word--){
+		if(*word == STACK_WATCH_CANARY){
+			return stackWatchAdd(name, word, size);
+		}
+	}
+	return -1;
+}
+
+#else
+
+/**
+  * @brief Adds the stack of the calling thread, one cmsis_os_soft.c created and painted.
+  *        Host stacks are larger than the target's, so their own size is watched.
+  * @param name Name in the report, kept by reference.
+  * @param size Bytes the thread has on the target, unused.
+  * @returns Index of the stack, -1 for the main thread, whose stack is not painted, or if STACK_WATCH_STACKS are
+  *          already watched.
+  */
+int stackWatchAddCurrent(const char* name, uint32_t size){
+	void* base;
+	uint32_t bytes;
+
+	(void)size;
+	if(osSoftThreadStack(&base, &bytes) != 0 || *(uint32_t*)base != STACK_WATCH_CANARY){
+		return -1;
+	}
+	return stackWatchAdd(name, base, bytes);
+}
+
+#endif
+
+/**
+  * @brief Returns the number of watched stacks.
+  * @param None.
+  * @returns The number.
+  */
+int stackWatchCount(void){
+	return stackCount;
+}
+
+/**
+  * @brief Returns a stack size with STACK_WATCH_MARGIN_PERCENT on top of a peak, in whole 8-byte units
+  *        as the stack alignment needs.
+  * @param peak Peak usage in bytes.
+  * @returns Suggested size in bytes.
+  */
+uint32_t stackWatchSuggest(uint32_t peak){
+	uint32_t size = peak + (peak * STACK_WATCH_MARGIN_PERCENT + 99) / 100;
+	return (size + 7) & ~7u;
+}
+
+/**
+  * @brief Measures a watched stack.
+  * @param index Index from stackWatchAdd.
+  * @param usage Filled in.
+  * @returns 0 on success, -1 if there is no such stack.
+  */
+int stackWatchUsage(int index, stackUsage* usage){
+	const watchedStack* s;
+	uint32_t words;
+	uint32_t unused = 0;
+
+	if(index < 0 || index >= stackCount){
+		return -1;
+	}
+	s = &stacks[index];
+	words = s->size / 4;
+	usage->name = s->name;
+	usage->size = s->size;
+	usage->overflowed = (s->base[0] != STACK_WATCH_CANARY);
+	if(!usage->overflowed){
+		// The stack grows down, so the untouched words are the ones right above the canary
+		while(unused + 1 < words && s->base[unused + 1] == STACK_WATCH_PATTERN){
+			unused++;
+		}
+	}
+	usage->peak = s->size - unused * 4;
+	usage->suggested = stackWatchSuggest(usage->peak);
+	return 0;
+}
+
+/**
+  * @brief Writes the usage of every watched stack as CSV, in bytes.
+  * @param out The stream to write to.
+  * @returns Void.
+  */
+void stackWatchWriteCSV(FILE* out){
+	stackUsage usage;
+	int i;
+
+	fprintf(out, "thread,stack_bytes,peak_bytes,suggested_bytes,overflowed\n");
+	for(i = 0; i < stackCount; i++){
+		if(stackWatchUsage(i, &usage) == 0){
+			fprintf(out, "%s,%u,%u,%u,%d\n", usage.name, (unsigned int)usage.size, (unsigned int)usage.peak,
+					(unsigned int)usage.suggested, usage.overflowed ? 1 : 0);
+		}
+	}
+}
@@ -0,0 +1,62 @@
+/**
+  * @file stack_watch.h
+  * @brief Header file of the stack_watch.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef STACK_WATCH_H
+#define STACK_WATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+  * @brief Word every unused stack word holds, the pattern RTX fills new stacks with when OS_STKINIT is 1.
+  */
+#define STACK_WATCH_PATTERN 0xCCCCCCCC
+
+/**
+  * @brief Word at the bottom of every stack, the one RTX checks for overflow at each thread switch.
+  */
+#define STACK_WATCH_CANARY 0xE25A2EA5
+
+/**
+  * @brief Stack size in bytes of threads defined with a stacksz of 0, OS_STKSIZE of RTX_Conf_CM.c, and of the main thread,
+  *        OS_MAINSTKSIZE.
+  */
+#define STACK_WATCH_DEFAULT_SIZE (1000 * 4)
+#define STACK_WATCH_MAIN_SIZE (1000 * 4)
+
+/**
+  * @brief Stacks that can be watched.
+  */
+#define STACK_WATCH_STACKS 8
+
+/**
+  * @brief Margin added to the peak for the suggested stack size, in percent.
+  */
+#define STACK_WATCH_MARGIN_PERCENT 25
+
+/**
+  * @brief A struct containing the usage of one stack.
+  */
+typedef struct{
+	const char* name;
+	uint32_t size;
+	uint32_t peak;
+	uint32_t suggested;
+	bool overflowed;
+	}stackUsage;
+
+void stackWatchPaint(void* base, uint32_t size);
+int stackWatchAdd(const char* name, void* base, uint32_t size);
+int stackWatchAddCurrent(const char* name, uint32_t size);
+int stackWatchCount(void);
+int stackWatchUsage(int index, stackUsage* usage);
+uint32_t stackWatchSuggest(uint32_t peak);
+void stackWatchWriteCSV(FILE* out);
+
+#endif
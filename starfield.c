@@ -0,0 +1,295 @@
+/**
+  * @file starfield.c
+  * @brief Define functions that animate a scrolling starfield on the "home" screen.
+  *        Each frame only the pixels of stars that moved are erased and drawn again, and the number
+  *        of stars moved per frame follows the measured frame cost. Define GLCD_SOFT when linking
+  *        with glcd_soft.c instead; the frame cost is then counted in modelled cycles per pixel,
+  *        so runs with the same PrngStarfield seed draw the same frames.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <stdbool.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+#include "mirror.h"
+#include "layers.h"
+#include "starfield.h"
+#include "prng.h"
+#ifndef GLCD_SOFT
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief Marks a star that is not on the screen.
+  */
+#define STAR_HIDDEN 0xFFFF
+
+/**
+  * @brief Star positions are kept in quarter pixels, so slow stars move less than a pixel per frame.
+  */
+#define STAR_SUBPIXEL_SHIFT 2
+
+/**
+  * @brief Fastest star speed in quarter pixels per frame.
+  */
+#define STAR_MAX_SPEED 8
+
+/**
+  * @brief Fewest stars moved in one frame, however far over budget the frames run.
+  */
+#define STARFIELD_MIN_QUOTA (STARFIELD_STARS / 8)
+
+/**
+  * @brief A rectangle stars are not drawn in.
+  */
+typedef struct{
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+	}starfieldRect;
+
+/**
+  * @brief Star state as separate arrays, so each pass only touches the fields it needs.
+  *        starX is in quarter pixels, drawnX and drawnY hold the pixel currently on the screen.
+  */
+static uint16_t starX[STARFIELD_STARS];
+static uint16_t starY[STARFIELD_STARS];
+static uint8_t starSpeed[STARFIELD_STARS];
+static uint16_t drawnX[STARFIELD_STARS];
+static uint16_t drawnY[STARFIELD_STARS];
+
+/**
+  * @brief Colour of each star brightness.
+  */
+static const uint32_t starColors[3] = {GLCD_COLOR_DARK_GREY, GLCD_COLOR_LIGHT_GREY, GLCD_COLOR_WHITE};
+
+/**
+  * @brief Rectangles kept free of stars, such as buttons and labels.
+  */
+static starfieldRect excludes[STARFIELD_MAX_EXCLUDES];
+static unsigned int excludeCount = 0;
+
+/**
+  * @brief Number of stars moved per frame and the star the next frame starts at.
+  */
+static uint32_t quota = STARFIELD_STARS;
+static uint32_t cursor = 0;
+
+/**
+  * @brief Cycles used by the last frame.
+  */
+static uint32_t lastCost = 0;
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Modelled cycle counter of the host build and the cycles each pixel adds to it.
+  */
+static uint32_t hostCycles = 0;
+static uint32_t hostPixelCycles = STARFIELD_HOST_PIXEL_CYCLES;
+#endif
+
+/**
+  * @brief Returns the cycle counter the frame cost is measured with.
+  * @param None.
+  * @returns Cycles.
+  */
+static uint32_t starfieldClock(void){
+#ifdef GLCD_SOFT
+	return hostCycles;
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+/**
+  * @brief Draws one pixel in the current foreground colour and counts it for the host clock.
+  * @param x,y Co-ordinates of the pixel.
+  * @returns Void.
+  */
+static void starPixel(unsigned int x, unsigned int y){
+	GLCD_DrawPixel(x, y);
+#ifdef GLCD_SOFT
+	hostCycles += hostPixelCycles;
+#endif
+}
+
+/**
+  * @brief Checks whether a pixel is inside one of the excluded rectangles.
+  * @param x,y Co-ordinates of the pixel.
+  * @returns true if no star may be drawn there.
+  */
+static bool excluded(unsigned int x, unsigned int y){
+	unsigned int i;
+	for(i = 0; i < excludeCount; i++){
+		if(x >= excludes[i].x && x < excludes[i].x + excludes[i].width
+				&& y >= excludes[i].y && y < excludes[i].y + excludes[i].height){
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+  * @brief Gives a star a new row and speed.
+  * @param i The star.
+  * @param x Column to start at, in pixels.
+  * @returns Void.
+  */
+static void spawnStar(uint32_t i, uint32_t x){
+	starX[i] = (uint16_t)(x << STAR_SUBPIXEL_SHIFT);
+	starY[i] = (uint16_t)(STARFIELD_TOP + prngBelow(prngStream(PrngStarfield), STARFIELD_BOTTOM - STARFIELD_TOP));
+	starSpeed[i] = (uint8_t)(1 + prngBelow(prngStream(PrngStarfield), STAR_MAX_SPEED));
+}
+
+/**
+  * @brief Returns the brightness of a star, faster stars are brighter.
+  * @param speed Speed of the star in quarter pixels per frame.
+  * @returns Index into starColors.
+  */
+static uint32_t starBrightness(uint8_t speed){
+	if(speed <= STAR_MAX_SPEED / 4){
+		return 0;
+	}else if(speed <= STAR_MAX_SPEED / 2){
+		return 1;
+	}
+	return 2;
+}
+
+/**
+  * @brief Scatters new stars over the field and clears the excluded rectangles.
+  *        Nothing is drawn until the first starfieldStep. The layout and respawns come from
+  *        the PrngStarfield stream, seed it for repeatable frames.
+  * @param None.
+  * @returns Void.
+  */
+void starfieldReset(void){
+	uint32_t i;
+#ifndef GLCD_SOFT
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+	for(i = 0; i < STARFIELD_STARS; i++){
+		spawnStar(i, STARFIELD_LEFT + prngBelow(prngStream(PrngStarfield), STARFIELD_RIGHT - STARFIELD_LEFT));
+		drawnX[i] = STAR_HIDDEN;
+		drawnY[i] = STAR_HIDDEN;
+	}
+	excludeCount = 0;
+	quota = STARFIELD_STARS;
+	cursor = 0;
+	lastCost = 0;
+}
+
+/**
+  * @brief Keeps stars out of a rectangle. Call after starfieldReset, before the first step.
+  * @param x,y Top left co-ordinates of the rectangle.
+  * @param width,height Size of the rectangle.
+  * @returns Void.
+  */
+void starfieldExclude(unsigned int x, unsigned int y, unsigned int width, unsigned int height){
+	if(excludeCount == STARFIELD_MAX_EXCLUDES){
+		return;
+	}
+	excludes[excludeCount].x = (uint16_t)x;
+	excludes[excludeCount].y = (uint16_t)y;
+	excludes[excludeCount].width = (uint16_t)width;
+	excludes[excludeCount].height = (uint16_t)height;
+	excludeCount++;
+}
+
+/**
+  * @brief Moves the next quota of stars one frame left, erasing and drawing only the pixels that changed,
+  *        then adjusts the quota to the frame budget.
+  * @param None.
+  * @returns Void.
+  */
+void starfieldStep(void){
+	static uint8_t moved[STARFIELD_STARS];
+	uint32_t movedCount = 0;
+	uint32_t start = starfieldClock();
+	uint32_t budget;
+	uint32_t i = cursor;
+	uint32_t n;
+	uint32_t x;
+	uint32_t brightness;
+
+	// Erase every moved star before drawing any, so no star erases another
+	GLCD_SetForegroundColor(LAYER_HUD_BACKGROUND);
+	for(n = 0; n < quota; n++, i = (i + 1 == STARFIELD_STARS) ? 0 : i + 1){
+		if(starX[i] < ((STARFIELD_LEFT << STAR_SUBPIXEL_SHIFT) + starSpeed[i])){
+			spawnStar(i, STARFIELD_RIGHT - 1);
+		}else{
+			starX[i] -= starSpeed[i];
+		}
+		x = starX[i] >> STAR_SUBPIXEL_SHIFT;
+		if(x == drawnX[i] && starY[i] == drawnY[i]){
+			continue;
+		}
+		if(drawnX[i] != STAR_HIDDEN){
+			starPixel(drawnX[i], drawnY[i]);
+		}
+		if(excluded(x, starY[i])){
+			drawnX[i] = STAR_HIDDEN;
+			continue;
+		}
+		drawnX[i] = (uint16_t)x;
+		drawnY[i] = starY[i];
+		moved[movedCount++] = (uint8_t)i;
+	}
+	cursor = i;
+
+	// One pass per brightness, so the colour is set three times a frame
+	for(brightness = 0; brightness < 3; brightness++){
+		GLCD_SetForegroundColor(starColors[brightness]);
+		for(n = 0; n < movedCount; n++){
+			i = moved[n];
+			if(starBrightness(starSpeed[i]) == brightness){
+				starPixel(drawnX[i], drawnY[i]);
+			}
+		}
+	}
+
+	lastCost = starfieldClock() - start;
+#ifdef GLCD_SOFT
+	budget = STARFIELD_BUDGET_US * STARFIELD_HOST_MHZ;
+#else
+	budget = STARFIELD_BUDGET_US * (SystemCoreClock / 1000000);
+#endif
+	if(lastCost > budget){
+		quota = (quota / 2 > STARFIELD_MIN_QUOTA) ? quota / 2 : STARFIELD_MIN_QUOTA;
+	}else if(lastCost < budget / 2 && quota < STARFIELD_STARS){
+		quota = (quota + STARFIELD_MIN_QUOTA < STARFIELD_STARS) ? quota + STARFIELD_MIN_QUOTA : STARFIELD_STARS;
+	}
+}
+
+/**
+  * @brief Returns the cost of the last frame.
+  * @param None.
+  * @returns Cycles, modelled cycles in the host build.
+  */
+uint32_t starfieldLastCost(void){
+	return lastCost;
+}
+
+/**
+  * @brief Returns the number of stars the next frame will move.
+  * @param None.
+  * @returns Stars per frame.
+  */
+uint32_t starfieldQuota(void){
+	return quota;
+}
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Changes the modelled cost of a pixel write, e.g. to push frames over budget in a test.
+  * @param cycles Cycles per pixel, STARFIELD_HOST_PIXEL_CYCLES by default.
+  * @returns Void.
+  */
+void starfieldSoftSetPixelCycles(uint32_t cycles){
+	hostPixelCycles = cycles;
+}
+#endif
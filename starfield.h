@@ -0,0 +1,55 @@
+/**
+  * @file starfield.h
+  * @brief Header file of the starfield.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef STARFIELD_H
+#define STARFIELD_H
+
+#include <stdint.h>
+
+/**
+  * @brief Number of stars in the field.
+  */
+#define STARFIELD_STARS 96
+
+/**
+  * @brief Drawing time one frame may use, in microseconds.
+  *        Frames over budget update fewer stars, so the field slows down instead of the screen.
+  */
+#define STARFIELD_BUDGET_US 1500
+
+/**
+  * @brief Most rectangles stars are kept out of.
+  */
+#define STARFIELD_MAX_EXCLUDES 4
+
+/**
+  * @brief Bounds of the field, inside the border drawn by drawBorders.
+  */
+#define STARFIELD_LEFT   15
+#define STARFIELD_TOP    15
+#define STARFIELD_RIGHT  465
+#define STARFIELD_BOTTOM 257
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Modelled cost of one pixel write and clock rate, standing in for the cycle counter on the host.
+  */
+#define STARFIELD_HOST_PIXEL_CYCLES 120
+#define STARFIELD_HOST_MHZ 216
+#endif
+
+void starfieldReset(void);
+void starfieldExclude(unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+void starfieldStep(void);
+uint32_t starfieldLastCost(void);
+uint32_t starfieldQuota(void);
+#ifdef GLCD_SOFT
+void starfieldSoftSetPixelCycles(uint32_t cycles);
+#endif
+
+#endif
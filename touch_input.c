@@ -0,0 +1,179 @@
+/**
+  * @file touch_input.c
+  * @brief Define functions that turn touch controller interrupts into touch events.
+  *        With GLCD_SOFT it also fakes the touch controller, so a host test can press and release the panel.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include "main.h"
+#include "touch_input.h"
+#include "events.h"
+#include "stack_watch.h"
+#include "trace.h"
+
+/**
+  * @brief GPIO port and pin of the FT5336 interrupt line (PI13 on the discovery board).
+  */
+#define TOUCH_INT_PORT GPIOI
+#define TOUCH_INT_PIN  GPIO_PIN_13
+
+/**
+  * @brief Signal flag set by the interrupt to wake the touch thread.
+  */
+#define TOUCH_SIGNAL 0x01
+
+#ifdef GLCD_SOFT
+/**
+  * @brief State the fake touch controller reports.
+  */
+static TOUCH_STATE softState;
+#endif
+
+/**
+  * @brief Thread function reading the touch controller after an interrupt.
+  */
+void touchTask(void const* argument);
+
+/**
+  * @brief Thread ID struct for the touch thread.
+  */
+osThreadId touchThread;
+
+/**
+  * @brief Defining thread configuration struct for the touch thread.
+  */
+osThreadDef(touchTask, osPriorityAboveNormal, 1, 0);
+
+/**
+  * @brief Configures the touch interrupt line and starts the touch thread.
+  *        Touch_Initialize and eventsInitialize must have been called before.
+  * @param None.
+  * @returns Void.
+  */
+void touchInputInitialize(void){
+	GPIO_InitTypeDef gpio;
+
+	touchThread = osThreadCreate(osThread(touchTask), NULL);
+	traceName(touchThread, "touch");
+
+	__HAL_RCC_GPIOI_CLK_ENABLE();
+	gpio.Mode = GPIO_MODE_IT_FALLING;
+	gpio.Pull = GPIO_NOPULL;
+	gpio.Speed = GPIO_SPEED_HIGH;
+	gpio.Pin = TOUCH_INT_PIN;
+	HAL_GPIO_Init(TOUCH_INT_PORT, &gpio);
+
+	HAL_NVIC_SetPriority(EXTI15_10_IRQn, 0x0F, 0);
+	HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+}
+
+/**
+  * @brief Interrupt handler for EXTI lines 10 to 15.
+  * @param None.
+  * @returns Void.
+  */
+ITCM_CODE void EXTI15_10_IRQHandler(void){
+	HAL_GPIO_EXTI_IRQHandler(TOUCH_INT_PIN);
+}
+
+/**
+  * @brief EXTI callback, wakes the touch thread when the controller signals new data.
+  * @param pin The GPIO pin that raised the interrupt.
+  * @returns Void.
+  */
+ITCM_CODE void HAL_GPIO_EXTI_Callback(uint16_t pin){
+	if(pin == TOUCH_INT_PIN){
+		osSignalSet(touchThread, TOUCH_SIGNAL);
+	}
+}
+
+/**
+  * @brief Touch thread function. Sleeps until the controller interrupts, then samples
+  *        the touch state until the finger is lifted, posting down/move/up events.
+  * @param Thread function default argument paramater.
+  * @returns Void.
+  */
+void touchTask(void const* argument){
+	TOUCH_STATE state;
+	bool wasPressed = false;
+	int lastX = 0;
+	int lastY = 0;
+
+	stackWatchAddCurrent("touch", STACK_WATCH_DEFAULT_SIZE);
+	for(;;){
+		osSignalWait(TOUCH_SIGNAL, osWaitForever);
+		for(;;){
+			Touch_GetState(&state);
+			if(state.pressed){
+				if(!wasPressed){
+					postTouchEvent(TouchDown, state.x, state.y);
+				}else if(state.x != lastX || state.y != lastY){
+					postTouchEvent(TouchMove, state.x, state.y);
+				}
+				wasPressed = true;
+				lastX = state.x;
+				lastY = state.y;
+			}else{
+				if(wasPressed){
+					postTouchEvent(TouchUp, lastX, lastY);
+				}
+				wasPressed = false;
+				break;
+			}
+			// The interrupt only marks the start of a touch, so follow it until release
+			osDelay(TOUCH_SAMPLE_MS);
+		}
+	}
+}
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Initialises the fake touch controller as not pressed.
+  * @param None.
+  * @returns 0.
+  */
+int32_t Touch_Initialize(void){
+	softState.pressed = 0;
+	softState.x = 0;
+	softState.y = 0;
+	return 0;
+}
+
+/**
+  * @brief Reads the fake touch controller.
+  * @param state Where the touch state is written.
+  * @returns 0.
+  */
+int32_t Touch_GetState(TOUCH_STATE* state){
+	*state = softState;
+	return 0;
+}
+
+/**
+  * @brief Puts a finger on the fake panel, or moves the finger already on it.
+  *        A new touch raises the interrupt line like the FT5336 does, a move is left for the touch thread to sample.
+  * @param x,y Co-ordinates of the finger.
+  * @returns Void.
+  */
+void touchSoftPress(int x, int y){
+	bool wasPressed = softState.pressed;
+
+	softState.x = x;
+	softState.y = y;
+	softState.pressed = 1;
+	if(!wasPressed){
+		EXTI15_10_IRQHandler();
+	}
+}
+
+/**
+  * @brief Lifts the finger from the fake panel.
+  * @param None.
+  * @returns Void.
+  */
+void touchSoftRelease(void){
+	softState.pressed = 0;
+}
+#endif
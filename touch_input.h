@@ -0,0 +1,41 @@
+/**
+  * @file touch_input.h
+  * @brief Header file of the touch_input.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+/**
+  * @brief Time between touch controller reads while a finger is on the screen, in ms.
+  */
+#define TOUCH_SAMPLE_MS 10
+
+/**
+  * @brief An enum containing the different kinds of touch events.
+  */
+enum touchType{
+	TouchDown,
+	TouchMove,
+	TouchUp
+};
+
+/**
+  * @brief A struct containing a decoded touch event.
+  */
+typedef struct{
+	enum touchType type;
+	int x;
+	int y;
+	}touchEvent;
+
+void touchInputInitialize(void);
+#ifdef GLCD_SOFT
+void touchSoftPress(int x, int y);
+void touchSoftRelease(void);
+#endif
+
+#endif
@@ -0,0 +1,527 @@
+/**
+  * @file trace.c
+  * @brief Define the kernel trace: the time each thread runs and a ring buffer of thread switches.
+  *        On the target the linker patches the RTX kernel entries, PendSV, SysTick and SVC, to call
+  *        traceKernelEntry first. Threads only change inside those handlers, so the time since the previous
+  *        entry belongs to the thread running now, and a different thread than last time means a switch
+  *        at the previous entry. A host build has no such handlers and calls traceSwitch as each switch happens.
+  *        Time is kept in microseconds, so it stays right when the governor changes the core clock.
+  *        The trace is written as CSV, or as Chrome trace JSON that chrome://tracing and Perfetto open;
+  *        the host build converts a CSV written by the board with traceConvertCSV.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdbool.h>
+#include <string.h>
+#include "trace.h"
+#include "platform.h"
+#ifdef GLCD_SOFT
+#include "cmsis_os_soft.h"
+#else
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief A struct containing a thread the trace has seen.
+  */
+typedef struct{
+	const void* id;
+	const char* name;
+	uint64_t micros;
+	uint64_t windowMicros;
+	}tracedThread;
+
+/**
+  * @brief A struct containing a thread switch: the time in microseconds and the thread that ran from then on.
+  */
+typedef struct{
+	uint32_t micros;
+	uint32_t thread;
+	}traceEvent;
+
+/**
+  * @brief The threads seen, in order of their first run. The last one collects every thread after the table is full.
+  */
+static tracedThread threads[TRACE_THREADS];
+static int threadCount = 0;
+
+/**
+  * @brief Ring buffer of thread switches and the number recorded, the newest is at (eventCount - 1) % TRACE_EVENTS.
+  */
+static traceEvent events[TRACE_EVENTS];
+static uint32_t eventCount = 0;
+
+/**
+  * @brief Set while the ring buffer is being written out, switches are then counted but not recorded.
+  */
+static volatile bool paused = false;
+
+/**
+  * @brief Index of the running thread, -1 before the first switch.
+  */
+static int current = -1;
+
+/**
+  * @brief Clock reading of the previous update, clock cycles not yet converted, and the time of the update.
+  */
+static uint32_t lastStamp = 0;
+static uint32_t carryCycles = 0;
+static uint64_t nowMicros = 0;
+
+/**
+  * @brief Time at the previous traceGetLoads.
+  */
+static uint64_t windowStart = 0;
+
+#ifdef GLCD_SOFT
+/**
+  * @brief Lock of the host build, whose threads may switch on any core.
+  */
+static volatile int hostLock = 0;
+#else
+/**
+  * @brief The running and the next thread of RTX, kept by the kernel.
+  */
+typedef struct{
+	void* run;
+	void* next;
+	}rtxTasks;
+extern rtxTasks os_tsk;
+#endif
+
+/**
+  * @brief Keeps the kernel entries and the other threads out of the trace state.
+  * @param None.
+  * @returns What traceUnlock needs.
+  */
+static uint32_t traceLock(void){
+#ifdef GLCD_SOFT
+	while(__sync_lock_test_and_set(&hostLock, 1)){
+	}
+	return 0;
+#else
+	uint32_t mask = __get_PRIMASK();
+	__disable_irq();
+	return mask;
+#endif
+}
+
+/**
+  * @brief Releases traceLock.
+  * @param mask The value traceLock returned.
+  * @returns Void.
+  */
+static void traceUnlock(uint32_t mask){
+#ifdef GLCD_SOFT
+	(void)mask;
+	__sync_lock_release(&hostLock);
+#else
+	__set_PRIMASK(mask);
+#endif
+}
+
+/**
+  * @brief Reads the trace clock: core cycles on the target, microseconds of osSoftMicros on the host.
+  *        With OS_SOFT_VIRTUAL_TIME that is the kernel's virtual time, in which each run of a thread is
+  *        charged its run cost, so the trace follows the simulated run, repeats with it and shares the CPU
+  *        between the threads and idle.
+  * @param None.
+  * @returns The reading.
+  */
+ITCM_CODE static uint32_t traceClock(void){
+#ifdef GLCD_SOFT
+	return osSoftMicros();
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+/**
+  * @brief Moves the trace time up to now.
+  * @param None.
+  * @returns Microseconds since the previous update.
+  */
+ITCM_CODE static uint32_t advance(void){
+	uint32_t now = traceClock();
+	uint32_t delta = now - lastStamp;
+#ifndef GLCD_SOFT
+	uint32_t cyclesPerMicro = SystemCoreClock / 1000000;
+#endif
+
+	lastStamp = now;
+#ifdef GLCD_SOFT
+	return delta;
+#else
+	carryCycles += delta;
+	delta = carryCycles / cyclesPerMicro;
+	carryCycles -= delta * cyclesPerMicro;
+	return delta;
+#endif
+}
+
+/**
+  * @brief Returns the table index of a thread, adding it on its first run.
+  * @param id The thread.
+  * @returns The index.
+  */
+ITCM_CODE static int lookup(const void* id){
+	int i;
+
+	if(current >= 0 && threads[current].id == id){
+		return current;
+	}
+	for(i = 0; i < threadCount; i++){
+		if(threads[i].id == id){
+			return i;
+		}
+	}
+	if(threadCount < TRACE_THREADS - 1){
+		threads[threadCount].id = id;
+		threads[threadCount].name = NULL;
+		return threadCount++;
+	}
+	if(threadCount == TRACE_THREADS - 1){
+		threads[threadCount].id = NULL;
+		threads[threadCount].name = "other";
+		threadCount++;
+	}
+	return TRACE_THREADS - 1;
+}
+
+/**
+  * @brief Records a thread switch.
+  * @param micros Time of the switch.
+  * @param index Table index of the thread that runs from then on.
+  * @returns Void.
+  */
+ITCM_CODE static void record(uint64_t micros, int index){
+	if(paused){
+		return;
+	}
+	events[eventCount % TRACE_EVENTS].micros = (uint32_t)micros;
+	events[eventCount % TRACE_EVENTS].thread = (uint32_t)index;
+	eventCount++;
+}
+
+/**
+  * @brief Clears the trace and starts its clock. Call before the kernel starts.
+  * @param None.
+  * @returns Void.
+  */
+void traceInitialize(void){
+	uint32_t mask = traceLock();
+	memset(threads, 0, sizeof(threads));
+	threadCount = 0;
+	eventCount = 0;
+	current = -1;
+	carryCycles = 0;
+	nowMicros = 0;
+	windowStart = 0;
+	lastStamp = traceClock();
+	traceUnlock(mask);
+}
+
+/**
+  * @brief Names a thread in the loads and the exported trace.
+  * @param thread The thread, its osThreadId on the target.
+  * @param name The name, kept by reference.
+  * @returns Void.
+  */
+void traceName(const void* thread, const char* name){
+	uint32_t mask = traceLock();
+	int index = lookup(thread);
+	if(threads[index].id == thread){
+		threads[index].name = name;
+	}
+	traceUnlock(mask);
+}
+
+/**
+  * @brief Records a switch to another thread as it happens, for builds without kernel entries to hook.
+  * @param next The thread that runs from now on.
+  * @returns Void.
+  */
+void traceSwitch(const void* next){
+	uint32_t mask = traceLock();
+	uint32_t micros = advance();
+	int index;
+
+	if(current >= 0){
+		threads[current].micros += micros;
+	}
+	nowMicros += micros;
+	index = lookup(next);
+	if(index != current){
+		record(nowMicros, index);
+		current = index;
+	}
+	traceUnlock(mask);
+}
+
+#ifndef GLCD_SOFT
+
+/**
+  * @brief Accounts the time since the previous kernel entry to the running thread. Called first by every
+  *        patched kernel entry, with the interrupted thread still current.
+  * @param None.
+  * @returns Void.
+  */
+ITCM_CODE void traceKernelEntry(void){
+	uint64_t previous = nowMicros;
+	uint32_t micros = advance();
+	int index;
+
+	nowMicros += micros;
+	// SVC calls made before the kernel runs
+	if(os_tsk.run == NULL){
+		return;
+	}
+	index = lookup(os_tsk.run);
+	threads[index].micros += micros;
+	if(index != current){
+		record(previous, index);
+		current = index;
+	}
+}
+
+/**
+  * @brief Names the idle demon. Called by os_idle_demon, which cannot make kernel calls.
+  * @param None.
+  * @returns Void.
+  */
+void traceNameIdle(void){
+	traceName(os_tsk.run, "idle");
+}
+
+// The patches are armcc inline assembler and armlink $Sub$$ names, other compilers go without them
+#if defined(TRACE_ENABLED) && defined(__CC_ARM)
+
+extern void $Super$$PendSV_Handler(void);
+extern void $Super$$SysTick_Handler(void);
+extern void $Super$$SVC_Handler(void);
+
+/**
+  * @brief Kernel entries of RTX, patched by the linker to call traceKernelEntry first.
+  *        Only r4 and lr are saved around the call: the kernel reads the arguments of an SVC from the
+  *        stacked frame, and needs the EXC_RETURN of the interrupted thread in lr.
+  */
+__asm void $Sub$$PendSV_Handler(void){
+	PRESERVE8
+	PUSH {r4, lr}
+	BL __cpp(traceKernelEntry)
+	POP {r4, lr}
+	B __cpp($Super$$PendSV_Handler)
+}
+
+__asm void $Sub$$SysTick_Handler(void){
+	PRESERVE8
+	PUSH {r4, lr}
+	BL __cpp(traceKernelEntry)
+	POP {r4, lr}
+	B __cpp($Super$$SysTick_Handler)
+}
+
+__asm void $Sub$$SVC_Handler(void){
+	PRESERVE8
+	PUSH {r4, lr}
+	BL __cpp(traceKernelEntry)
+	POP {r4, lr}
+	B __cpp($Super$$SVC_Handler)
+}
+
+#endif
+
+#endif
+
+/**
+  * @brief Returns the load of every thread since the previous call, for a diagnostics screen.
+  *        The idle demon is one of the threads, 100 less its load is the CPU load.
+  * @param loads Filled in, one per thread.
+  * @param max Entries loads has room for.
+  * @returns Number of entries filled in.
+  */
+int traceGetLoads(traceLoad* loads, int max){
+	uint32_t mask = traceLock();
+	uint64_t window = nowMicros - windowStart;
+	uint64_t used;
+	int i;
+
+	for(i = 0; i < threadCount && i < max; i++){
+		used = threads[i].micros - threads[i].windowMicros;
+		loads[i].name = threads[i].name;
+		loads[i].loadPercent = (window != 0) ? (uint32_t)(used * 100 / window) : 0;
+		loads[i].totalMicros = threads[i].micros;
+	}
+	for(i = 0; i < threadCount; i++){
+		threads[i].windowMicros = threads[i].micros;
+	}
+	windowStart = nowMicros;
+	traceUnlock(mask);
+	return (threadCount < max) ? threadCount : max;
+}
+
+/**
+  * @brief Writes the thread switches of a ring buffer as Chrome trace JSON, one complete event for each time
+  *        a thread ran and a name for each thread. Times are unwrapped from 32 bits, starting at 0.
+  * @param out The stream to write to.
+  * @param names Name of each thread, NULL for a thread without one.
+  * @param nameCount Number of threads.
+  * @param ring The ring buffer.
+  * @param first Ring position of the oldest switch.
+  * @param count Number of switches.
+  * @param end Time the last thread ran until.
+  * @returns Void.
+  */
+static void writeJSON(FILE* out, const char* const* names, int nameCount, const traceEvent* ring,
+		uint32_t first, uint32_t count, uint32_t end){
+	const traceEvent* e;
+	uint64_t start = 0;
+	uint32_t duration;
+	uint32_t i;
+	int t;
+
+	fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	for(t = 0; t < nameCount; t++){
+		if(names[t] != NULL){
+			fprintf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n", t, names[t]);
+		}else{
+			fprintf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread%d\"}},\n", t, t);
+		}
+	}
+	for(i = 0; i < count; i++){
+		e = &ring[(first + i) % TRACE_EVENTS];
+		duration = ((i + 1 < count) ? ring[(first + i + 1) % TRACE_EVENTS].micros : end) - e->micros;
+		if((int)e->thread < nameCount && names[e->thread] != NULL){
+			fprintf(out, "{\"name\":\"%s\"", names[e->thread]);
+		}else{
+			fprintf(out, "{\"name\":\"thread%u\"", (unsigned int)e->thread);
+		}
+		fprintf(out, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"dur\":%u},\n", (unsigned int)e->thread,
+				(unsigned long long)start, (unsigned int)duration);
+		start += duration;
+	}
+	// Closes the list without a trailing comma
+	fprintf(out, "{\"name\":\"end\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%llu}\n]}\n", (unsigned long long)start);
+}
+
+/**
+  * @brief Returns the ring position of the oldest recorded switch and the number recorded.
+  * @param count Set to the number of switches in the ring buffer.
+  * @returns The position.
+  */
+static uint32_t oldestEvent(uint32_t* count){
+	*count = (eventCount < TRACE_EVENTS) ? eventCount : TRACE_EVENTS;
+	return (eventCount < TRACE_EVENTS) ? 0 : eventCount % TRACE_EVENTS;
+}
+
+/**
+  * @brief Writes the threads and the recorded switches as CSV, the input of traceConvertCSV.
+  *        Recording pauses while it writes.
+  * @param out The stream to write to.
+  * @returns Void.
+  */
+void traceWriteCSV(FILE* out){
+	uint32_t first;
+	uint32_t count;
+	uint32_t i;
+	int t;
+
+	paused = true;
+	first = oldestEvent(&count);
+	fprintf(out, "kind,value,thread\n");
+	for(t = 0; t < threadCount; t++){
+		fprintf(out, "thread,%d,%s\n", t, (threads[t].name != NULL) ? threads[t].name : "");
+	}
+	for(i = 0; i < count; i++){
+		fprintf(out, "switch,%u,%u\n", (unsigned int)events[(first + i) % TRACE_EVENTS].micros,
+				(unsigned int)events[(first + i) % TRACE_EVENTS].thread);
+	}
+	fprintf(out, "end,%u,0\n", (unsigned int)nowMicros);
+	paused = false;
+}
+
+/**
+  * @brief Writes the threads and the recorded switches as Chrome trace JSON. Recording pauses while it writes.
+  * @param out The stream to write to.
+  * @returns Void.
+  */
+void traceWriteJSON(FILE* out){
+	const char* names[TRACE_THREADS];
+	uint32_t first;
+	uint32_t count;
+	int t;
+
+	paused = true;
+	for(t = 0; t < threadCount; t++){
+		names[t] = threads[t].name;
+	}
+	first = oldestEvent(&count);
+	writeJSON(out, names, threadCount, events, first, count, (uint32_t)nowMicros);
+	paused = false;
+}
+
+#ifdef GLCD_SOFT
+
+/**
+  * @brief Converts a CSV written by traceWriteCSV, on the board or the host, to Chrome trace JSON.
+  * @param in The CSV.
+  * @param out The stream to write the JSON to.
+  * @returns Number of switches converted, -1 if the input is not a trace.
+  */
+int traceConvertCSV(FILE* in, FILE* out){
+	static char nameText[TRACE_THREADS][32];
+	static traceEvent ring[TRACE_EVENTS];
+	const char* names[TRACE_THREADS];
+	char line[96];
+	unsigned int value;
+	unsigned int thread;
+	int index;
+	int nameCount = 0;
+	uint32_t count = 0;
+	uint32_t end = 0;
+	bool header = false;
+
+	while(fgets(line, sizeof(line), in) != NULL){
+		if(strncmp(line, "kind,", 5) == 0){
+			header = true;
+		}else if(sscanf(line, "thread,%d,", &index) == 1 && index >= 0 && index < TRACE_THREADS){
+			// The name is whatever follows the second comma
+			const char* name = strchr(strchr(line, ',') + 1, ',') + 1;
+			size_t length = strcspn(name, "\r\n");
+			if(length >= sizeof(nameText[index])){
+				length = sizeof(nameText[index]) - 1;
+			}
+			memcpy(nameText[index], name, length);
+			nameText[index][length] = '\0';
+			names[index] = (length > 0) ? nameText[index] : NULL;
+			if(index >= nameCount){
+				nameCount = index + 1;
+			}
+		}else if(sscanf(line, "switch,%u,%u", &value, &thread) == 2){
+			ring[count % TRACE_EVENTS].micros = value;
+			ring[count % TRACE_EVENTS].thread = thread;
+			count++;
+		}else if(sscanf(line, "end,%u", &value) == 1){
+			end = value;
+		}
+	}
+	if(!header){
+		return -1;
+	}
+	for(index = 0; index < nameCount; index++){
+		if(nameText[index][0] == '\0'){
+			names[index] = NULL;
+		}
+	}
+	if(count > TRACE_EVENTS){
+		writeJSON(out, names, nameCount, ring, count % TRACE_EVENTS, TRACE_EVENTS, end);
+		return TRACE_EVENTS;
+	}
+	writeJSON(out, names, nameCount, ring, 0, count, end);
+	return (int)count;
+}
+
+#endif
@@ -0,0 +1,51 @@
+/**
+  * @file trace.h
+  * @brief Header file of the trace.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+  * @brief Hook the kernel to account the time of each thread and record thread switches.
+  *        Comment out to leave the kernel entries untouched.
+  */
+#define TRACE_ENABLED
+
+/**
+  * @brief Threads that can be told apart, and thread switches kept in the ring buffer.
+  */
+#define TRACE_THREADS 10
+#define TRACE_EVENTS 512
+
+/**
+  * @brief A struct containing the load of one thread.
+  *        loadPercent covers the time since the previous traceGetLoads, totalMicros the time since traceInitialize.
+  */
+typedef struct{
+	const char* name;
+	uint32_t loadPercent;
+	uint64_t totalMicros;
+	}traceLoad;
+
+void traceInitialize(void);
+void traceName(const void* thread, const char* name);
+void traceSwitch(const void* next);
+#ifndef GLCD_SOFT
+void traceKernelEntry(void);
+void traceNameIdle(void);
+#endif
+int traceGetLoads(traceLoad* loads, int max);
+void traceWriteCSV(FILE* out);
+void traceWriteJSON(FILE* out);
+#ifdef GLCD_SOFT
+int traceConvertCSV(FILE* in, FILE* out);
+#endif
+
+#endif
@@ -0,0 +1,278 @@
+/**
+  * @file transitions.c
+  * @brief Define functions that animate the change from one screen to the next with the LTDC.
+  *        transitionBegin copies the shown screen to a snapshot and points layer 1 at it, so the next screen
+  *        is drawn off-screen. The transition then reveals the frame buffer on layer 2 by moving its window
+  *        or raising its alpha, one register update per frame. Define GLCD_SOFT when linking with glcd_soft.c
+  *        instead; transitionCompose then builds each frame the way the LTDC shows it.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <string.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+#include "layers.h"
+#include "dma2d.h"
+#include "transitions.h"
+#ifndef GLCD_SOFT
+#include "cmsis_os.h"
+#include "stm32f7xx_hal.h"
+#endif
+
+/**
+  * @brief The layers module owns both LTDC layers and the palette mode has no second palette,
+  *        so only the plain RGB565 mode animates through a snapshot.
+  */
+#if !defined(GLCD_LAYERS) && !defined(GLCD_L8)
+#define TRANSITION_SNAPSHOT
+#endif
+
+/**
+  * @brief The running transition, the number of frames it takes and the frames shown so far.
+  */
+static enum transitionType activeType = TransitionCut;
+static uint32_t frameCount = 0;
+static uint32_t frame = 0;
+static bool running = false;
+
+/**
+  * @brief Set from transitionBegin until the transition ends, while the display shows the snapshot.
+  */
+static bool frozen = false;
+
+#ifdef TRANSITION_SNAPSHOT
+
+/**
+  * @brief LTDC pixel format code of an RGB565 layer.
+  */
+#define LTDC_PIXEL_FORMAT_RGB565 2
+
+/**
+  * @brief LTDC blending factors: constant alpha, and one minus constant alpha.
+  */
+#define LTDC_BLEND_CA    4
+#define LTDC_BLEND_1_CA  5
+
+/**
+  * @brief Copy of the outgoing screen, placed in SDRAM behind the background layer of layers.c.
+  */
+#ifdef GLCD_SOFT
+static uint16_t snapshot_buf[GLCD_WIDTH * GLCD_HEIGHT];
+#else
+static uint16_t snapshot_buf[GLCD_WIDTH * GLCD_HEIGHT] __attribute__((section(".ARM.__at_0xC00A0000")));
+#endif
+
+/**
+  * @brief Returns the number of columns of the incoming screen shown in the current frame.
+  * @param None.
+  * @returns Columns, 0 to GLCD_WIDTH.
+  */
+static uint32_t shownColumns(void){
+	return GLCD_WIDTH * frame / frameCount;
+}
+
+#ifndef GLCD_SOFT
+/**
+  * @brief Applies the layer registers at the next vertical blank and waits for it,
+  *        so nothing is drawn into a buffer that is still shown.
+  * @param None.
+  * @returns Void.
+  */
+static void reloadAndWait(void){
+	LTDC->SRCR = LTDC_SRCR_VBR;
+	while(LTDC->SRCR & LTDC_SRCR_VBR){
+	}
+}
+
+/**
+  * @brief Sets the layer 2 window and alpha for the current frame.
+  * @param None.
+  * @returns Void.
+  */
+static void applyFrame(void){
+	uint32_t left = LTDC_Layer1->WHPCR & 0xFFF;
+	uint32_t columns = shownColumns();
+	uint32_t x = (activeType == TransitionSlide) ? GLCD_WIDTH - columns : 0;
+
+	if(activeType == TransitionFade){
+		LTDC_Layer2->CACR = 255 * frame / frameCount;
+		LTDC_Layer2->CR = LTDC_LxCR_LEN;
+	}else if(columns == 0){
+		LTDC_Layer2->CR = 0;
+	}else{
+		// A slide shows the first columns at the right edge, a wipe shows them in place
+		LTDC_Layer2->WHPCR = ((left + x + columns - 1) << 16) | (left + x);
+		LTDC_Layer2->CFBLR = ((uint32_t)(GLCD_WIDTH * 2) << 16) | (columns * 2 + 3);
+		LTDC_Layer2->CR = LTDC_LxCR_LEN;
+	}
+	LTDC->SRCR = LTDC_SRCR_VBR;
+}
+#endif
+
+/**
+  * @brief Blends two RGB565 colours channel by channel.
+  * @param top,below RGB565 colours.
+  * @param alpha Weight of the top colour, 0 to 255.
+  * @returns RGB565 colour.
+  */
+static uint16_t blend565(uint16_t top, uint16_t below, uint32_t alpha){
+	uint32_t r = (((top >> 11) & 0x1F) * alpha + ((below >> 11) & 0x1F) * (255 - alpha)) / 255;
+	uint32_t g = (((top >> 5) & 0x3F) * alpha + ((below >> 5) & 0x3F) * (255 - alpha)) / 255;
+	uint32_t b = ((top & 0x1F) * alpha + (below & 0x1F) * (255 - alpha)) / 255;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+#endif
+
+/**
+  * @brief Ends the running transition and shows the frame buffer alone.
+  * @param None.
+  * @returns Void.
+  */
+static void finish(void){
+	running = false;
+	frozen = false;
+#if defined(GLCD_LAYERS)
+	layerSetAlpha(LayerBackground, 255);
+	layerSetAlpha(LayerHud, 255);
+#elif defined(TRANSITION_SNAPSHOT) && !defined(GLCD_SOFT)
+	LTDC_Layer1->CFBAR = (uint32_t)glcdFrameBuffer();
+	LTDC_Layer2->CR = 0;
+	LTDC->SRCR = LTDC_SRCR_VBR;
+#endif
+}
+
+/**
+  * @brief Freezes the display on the current screen, so the next one can be drawn without being seen.
+  *        With GLCD_LAYERS the screen is faded out instead.
+  * @param None.
+  * @returns Void.
+  */
+void transitionBegin(void){
+#if defined(GLCD_LAYERS)
+	layerFade(0, LAYER_FADE_MS);
+#elif defined(TRANSITION_SNAPSHOT)
+	dma2dCopy(snapshot_buf, GLCD_WIDTH, glcdFrameBuffer(), GLCD_WIDTH, GLCD_WIDTH, GLCD_HEIGHT, 2);
+	dma2dWait();
+	frozen = true;
+#ifndef GLCD_SOFT
+	LTDC_Layer1->CFBAR = (uint32_t)snapshot_buf;
+	reloadAndWait();
+#endif
+#endif
+}
+
+/**
+  * @brief Starts revealing the screen drawn since transitionBegin. Nothing changes until the first transitionStep.
+  * @param type How the new screen replaces the old one.
+  * @param frames Number of frames the transition takes.
+  * @returns Void.
+  */
+void transitionStart(enum transitionType type, uint32_t frames){
+	activeType = type;
+	frameCount = (frames > 0) ? frames : 1;
+	frame = 0;
+	running = true;
+#ifdef TRANSITION_SNAPSHOT
+	if(type == TransitionCut){
+		frame = frameCount;
+	}
+#ifndef GLCD_SOFT
+	LTDC_Layer2->WHPCR = LTDC_Layer1->WHPCR;
+	LTDC_Layer2->WVPCR = LTDC_Layer1->WVPCR;
+	LTDC_Layer2->PFCR = LTDC_PIXEL_FORMAT_RGB565;
+	LTDC_Layer2->CFBAR = (uint32_t)glcdFrameBuffer();
+	LTDC_Layer2->CFBLR = LTDC_Layer1->CFBLR;
+	LTDC_Layer2->CFBLNR = LTDC_Layer1->CFBLNR;
+	LTDC_Layer2->BFCR = (LTDC_BLEND_CA << 8) | LTDC_BLEND_1_CA;
+	LTDC_Layer2->CACR = 255;
+	LTDC_Layer2->DCCR = 0;
+#endif
+#elif !defined(GLCD_LAYERS)
+	frame = frameCount;
+#endif
+}
+
+/**
+  * @brief Shows the next frame of the running transition.
+  * @param None.
+  * @returns true while the transition has frames left, false once the new screen is fully shown.
+  */
+bool transitionStep(void){
+	if(!running){
+		return false;
+	}
+	if(frame < frameCount){
+		frame++;
+	}
+	if(frame >= frameCount){
+		finish();
+		return false;
+	}
+#if defined(GLCD_LAYERS)
+	layerSetAlpha(LayerBackground, (uint8_t)(255 * frame / frameCount));
+	layerSetAlpha(LayerHud, (uint8_t)(255 * frame / frameCount));
+#elif defined(TRANSITION_SNAPSHOT) && !defined(GLCD_SOFT)
+	applyFrame();
+#endif
+	return true;
+}
+
+/**
+  * @brief Runs a whole transition, sleeping a frame between steps.
+  * @param type How the new screen replaces the old one.
+  * @returns Void.
+  */
+void transitionRun(enum transitionType type){
+	transitionStart(type, TRANSITION_FRAMES);
+	while(transitionStep()){
+#ifndef GLCD_SOFT
+		osDelay(TRANSITION_FRAME_MS);
+#endif
+	}
+}
+
+/**
+  * @brief Builds the image the display shows in the current frame.
+  * @param out GLCD_WIDTH * GLCD_HEIGHT RGB565 pixels to fill.
+  * @returns Void.
+  */
+void transitionCompose(uint16_t* out){
+#if defined(GLCD_LAYERS)
+	layersCompose(out);
+#elif defined(GLCD_L8)
+	glcdL8ToRGB565(out);
+#else
+	const uint16_t* screen = glcdFrameBuffer();
+	uint32_t columns;
+	uint32_t alpha;
+	uint32_t x;
+	uint32_t y;
+
+	if(!frozen){
+		memcpy(out, screen, GLCD_WIDTH * GLCD_HEIGHT * sizeof(uint16_t));
+		return;
+	}
+	if(!running){
+		memcpy(out, snapshot_buf, GLCD_WIDTH * GLCD_HEIGHT * sizeof(uint16_t));
+		return;
+	}
+	columns = shownColumns();
+	alpha = 255 * frame / frameCount;
+	memcpy(out, snapshot_buf, GLCD_WIDTH * GLCD_HEIGHT * sizeof(uint16_t));
+	for(y = 0; y < GLCD_HEIGHT; y++, out += GLCD_WIDTH, screen += GLCD_WIDTH){
+		if(activeType == TransitionFade){
+			for(x = 0; x < GLCD_WIDTH; x++){
+				out[x] = blend565(screen[x], out[x], alpha);
+			}
+		}else if(activeType == TransitionSlide){
+			memcpy(out + GLCD_WIDTH - columns, screen, columns * sizeof(uint16_t));
+		}else{
+			memcpy(out, screen, columns * sizeof(uint16_t));
+		}
+	}
+#endif
+}
@@ -0,0 +1,42 @@
+/**
+  * @file transitions.h
+  * @brief Header file of the transitions.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef TRANSITIONS_H
+#define TRANSITIONS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+  * @brief Time between two transition frames, in milliseconds.
+  */
+#define TRANSITION_FRAME_MS 16
+
+/**
+  * @brief Number of frames a transition takes.
+  */
+#define TRANSITION_FRAMES 12
+
+/**
+  * @brief An enum containing the ways one screen can replace another.
+  *        With GLCD_LAYERS every transition is a fade of both layers, with GLCD_L8 every transition is a cut.
+  */
+enum transitionType{
+	TransitionCut,
+	TransitionFade,
+	TransitionSlide,
+	TransitionWipe
+};
+
+void transitionBegin(void);
+void transitionStart(enum transitionType type, uint32_t frames);
+bool transitionStep(void);
+void transitionRun(enum transitionType type);
+void transitionCompose(uint16_t* out);
+
+#endif
@@ -0,0 +1,318 @@
+/**
+  * @file widgets.c
+  * @brief Define functions that keep the buttons, labels and numbers of the current screen.
+  *        Only widgets changed since the last widgetsDraw are drawn again, and touches are matched to buttons
+  *        through a grid of cells, so a lookup only checks the few buttons overlapping one cell.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#include <string.h>
+#include "GLCD_Config.h"
+#include "Board_GLCD.h"
+#include "glcd_l8.h"
+#include "mirror.h"
+#include "glyph_atlas.h"
+#include "score_font.h"
+#include "widgets.h"
+
+/**
+  * @brief Size of the hit-test grid in cells.
+  */
+#define WIDGET_GRID_COLUMNS ((GLCD_WIDTH + WIDGET_CELL_SIZE - 1) / WIDGET_CELL_SIZE)
+#define WIDGET_GRID_ROWS    ((GLCD_HEIGHT + WIDGET_CELL_SIZE - 1) / WIDGET_CELL_SIZE)
+
+/**
+  * @brief Widgets of the current screen, in the order they were added.
+  */
+static widget widgets[WIDGET_MAX];
+static unsigned int widgetCount = 0;
+
+/**
+  * @brief Buttons overlapping each grid cell, and how many there are.
+  */
+static uint8_t cellButtons[WIDGET_GRID_ROWS][WIDGET_GRID_COLUMNS][WIDGET_CELL_SLOTS];
+static uint8_t cellCount[WIDGET_GRID_ROWS][WIDGET_GRID_COLUMNS];
+
+/**
+  * @brief Returns the next free widget with its common fields set, or NULL if the screen is full.
+  * @param type Kind of widget.
+  * @param x,y,width,height Area of the widget.
+  * @param font Font of the widget's text.
+  * @returns The widget.
+  */
+static widget* newWidget(enum widgetType type, unsigned int x, unsigned int y,
+		unsigned int width, unsigned int height, GLCD_FONT* font){
+	widget* w;
+	if(widgetCount == WIDGET_MAX || x + width > GLCD_WIDTH || y + height > GLCD_HEIGHT){
+		return NULL;
+	}
+	w = &widgets[widgetCount];
+	memset(w, 0, sizeof(*w));
+	w->type = type;
+	w->x = (uint16_t)x;
+	w->y = (uint16_t)y;
+	w->width = (uint16_t)width;
+	w->height = (uint16_t)height;
+	w->font = font;
+	w->dirty = true;
+	return w;
+}
+
+/**
+  * @brief Adds the widget just created by newWidget to every grid cell it overlaps.
+  * @param None.
+  * @returns 0 on success, -1 if a cell already holds WIDGET_CELL_SLOTS buttons.
+  */
+static int indexWidget(void){
+	const widget* w = &widgets[widgetCount];
+	unsigned int firstColumn = w->x / WIDGET_CELL_SIZE;
+	unsigned int lastColumn = (w->x + w->width - 1) / WIDGET_CELL_SIZE;
+	unsigned int firstRow = w->y / WIDGET_CELL_SIZE;
+	unsigned int lastRow = (w->y + w->height - 1) / WIDGET_CELL_SIZE;
+	unsigned int row;
+	unsigned int column;
+
+	// Check first, so a failed add leaves the index unchanged
+	for(row = firstRow; row <= lastRow; row++){
+		for(column = firstColumn; column <= lastColumn; column++){
+			if(cellCount[row][column] == WIDGET_CELL_SLOTS){
+				return -1;
+			}
+		}
+	}
+	for(row = firstRow; row <= lastRow; row++){
+		for(column = firstColumn; column <= lastColumn; column++){
+			cellButtons[row][column][cellCount[row][column]++] = (uint8_t)widgetCount;
+		}
+	}
+	return 0;
+}
+
+/**
+  * @brief Removes every widget, for example when another screen is entered. Nothing is erased from the screen.
+  * @param None.
+  * @returns Void.
+  */
+void widgetsClear(void){
+	widgetCount = 0;
+	memset(cellCount, 0, sizeof(cellCount));
+}
+
+/**
+  * @brief Adds a button: a filled rectangle with centred text that widgetHit reports.
+  * @param x,y Top left co-ordinates of the button.
+  * @param width,height Size of the button.
+  * @param text Text shown on the button, kept by reference.
+  * @param font Font of the text.
+  * @param foreground Colour of the text.
+  * @param background Colour of the button.
+  * @returns Id of the button, -1 if it does not fit on the screen or in the grid.
+  */
+int widgetAddButton(unsigned int x, unsigned int y, unsigned int width, unsigned int height,
+		const char* text, GLCD_FONT* font, uint16_t foreground, uint16_t background){
+	widget* w = newWidget(WidgetButton, x, y, width, height, font);
+	if(w == NULL || width == 0 || height == 0 || indexWidget() != 0){
+		return -1;
+	}
+	w->text = text;
+	w->foreground = foreground;
+	w->background = background;
+	return (int)widgetCount++;
+}
+
+/**
+  * @brief Adds a line of text.
+  * @param x,y Top left co-ordinates of the text.
+  * @param text The text, kept by reference.
+  * @param font Font of the text.
+  * @param foreground,background Colours of the text.
+  * @returns Id of the label, -1 if the screen is full.
+  */
+int widgetAddLabel(unsigned int x, unsigned int y, const char* text, GLCD_FONT* font,
+		uint16_t foreground, uint16_t background){
+	widget* w = newWidget(WidgetLabel, x, y, strlen(text) * font->width, font->height, font);
+	if(w == NULL){
+		return -1;
+	}
+	w->text = text;
+	w->foreground = foreground;
+	w->background = background;
+	return (int)widgetCount++;
+}
+
+/**
+  * @brief Adds a number field. Its digits are drawn from the glyph atlas, so the atlas sets its colours
+  *        and font should be the font the atlas was built from.
+  * @param x,y Top left co-ordinates of the field.
+  * @param digits Number of characters in the field, including a minus sign.
+  * @param font Font the atlas was built from, sets the character size.
+  * @param value The number shown first.
+  * @returns Id of the field, -1 if the screen is full or the field is too wide.
+  */
+int widgetAddNumber(unsigned int x, unsigned int y, unsigned int digits, GLCD_FONT* font, int value){
+	widget* w;
+	if(digits == 0 || digits > FORMAT_MAX_WIDTH){
+		return -1;
+	}
+	w = newWidget(WidgetNumber, x, y, digits * font->width, font->height, font);
+	if(w == NULL){
+		return -1;
+	}
+	w->digits = (uint8_t)digits;
+	w->value = value;
+	return (int)widgetCount++;
+}
+
+/**
+  * @brief Adds a number field drawn in the large anti-aliased score font.
+  * @param x,y Top left co-ordinates of the field.
+  * @param digits Number of characters in the field, including a minus sign.
+  * @param foreground,background Colours of the digits.
+  * @param value The number shown first.
+  * @returns Id of the field, -1 if the screen is full or the field is too wide.
+  */
+int widgetAddScore(unsigned int x, unsigned int y, unsigned int digits,
+		uint16_t foreground, uint16_t background, int value){
+	widget* w;
+	if(digits == 0 || digits > FORMAT_MAX_WIDTH){
+		return -1;
+	}
+	w = newWidget(WidgetScore, x, y, digits * SCORE_FONT_WIDTH, SCORE_FONT_HEIGHT, NULL);
+	if(w == NULL){
+		return -1;
+	}
+	w->digits = (uint8_t)digits;
+	w->foreground = foreground;
+	w->background = background;
+	w->value = value;
+	return (int)widgetCount++;
+}
+
+/**
+  * @brief Changes the text of a button or label and marks it for redrawing.
+  * @param id The widget.
+  * @param text The new text, kept by reference.
+  * @returns Void.
+  */
+void widgetSetText(int id, const char* text){
+	if(id < 0 || id >= (int)widgetCount || widgets[id].type == WidgetNumber || widgets[id].type == WidgetScore){
+		return;
+	}
+	widgets[id].text = text;
+	widgets[id].dirty = true;
+}
+
+/**
+  * @brief Changes the value of a number or score field. Only the digits that change are drawn again.
+  * @param id The widget.
+  * @param value The new number.
+  * @returns Void.
+  */
+void widgetSetValue(int id, int value){
+	if(id < 0 || id >= (int)widgetCount || (widgets[id].type != WidgetNumber && widgets[id].type != WidgetScore)
+			|| widgets[id].value == value){
+		return;
+	}
+	widgets[id].value = value;
+	widgets[id].dirty = true;
+}
+
+/**
+  * @brief Draws the characters of a number or score field that differ from the ones on screen.
+  * @param w The field.
+  * @returns Void.
+  */
+static void drawNumber(widget* w){
+	char next[FORMAT_MAX_WIDTH + 1];
+	char digit[2] = {'\0', '\0'};
+	uint32_t changed;
+	unsigned int i;
+
+	formatSigned(next, w->digits, w->value);
+	changed = formatChanges(w->shown, next, w->digits);
+	for(i = 0; i < w->digits; i++){
+		if(changed & (1u << i)){
+			digit[0] = next[i];
+			if(w->type == WidgetScore){
+				scoreFontDrawString(w->x + i * SCORE_FONT_WIDTH, w->y, digit, w->foreground, w->background);
+			}else{
+				atlasDrawString(w->x + i * w->font->width, w->y, digit);
+			}
+		}
+	}
+}
+
+/**
+  * @brief Draws every widget changed since the last call.
+  * @param None.
+  * @returns Void.
+  */
+void widgetsDraw(void){
+	unsigned int i;
+	unsigned int textWidth;
+	widget* w;
+
+	for(i = 0; i < widgetCount; i++){
+		w = &widgets[i];
+		if(!w->dirty){
+			continue;
+		}
+		w->dirty = false;
+		switch(w->type){
+			case WidgetButton:
+				textWidth = strlen(w->text) * w->font->width;
+				GLCD_SetForegroundColor(w->background);
+				GLCD_DrawBargraph(w->x, w->y, w->width, w->height, 100);
+				GLCD_SetFont(w->font);
+				GLCD_SetForegroundColor(w->foreground);
+				GLCD_SetBackgroundColor(w->background);
+				GLCD_DrawString(w->x + (w->width > textWidth ? (w->width - textWidth) / 2 : 0),
+						w->y + (w->height - w->font->height) / 2, w->text);
+				break;
+			case WidgetLabel:
+				textWidth = strlen(w->text) * w->font->width;
+				// Clear what a longer previous text left behind
+				if(textWidth < w->width){
+					GLCD_SetForegroundColor(w->background);
+					GLCD_DrawBargraph(w->x + textWidth, w->y, w->width - textWidth, w->height, 100);
+				}
+				w->width = (uint16_t)textWidth;
+				GLCD_SetFont(w->font);
+				GLCD_SetForegroundColor(w->foreground);
+				GLCD_SetBackgroundColor(w->background);
+				GLCD_DrawString(w->x, w->y, w->text);
+				break;
+			case WidgetNumber:
+			case WidgetScore:
+				drawNumber(w);
+				break;
+		}
+	}
+}
+
+/**
+  * @brief Finds the button under a touch. Later buttons are on top of earlier ones.
+  * @param x,y Co-ordinates of the touch.
+  * @returns Id of the button, -1 if there is none.
+  */
+int widgetHit(int x, int y){
+	unsigned int row;
+	unsigned int column;
+	int slot;
+	const widget* w;
+
+	if(x < 0 || y < 0 || x >= GLCD_WIDTH || y >= GLCD_HEIGHT){
+		return -1;
+	}
+	row = (unsigned int)y / WIDGET_CELL_SIZE;
+	column = (unsigned int)x / WIDGET_CELL_SIZE;
+	for(slot = cellCount[row][column] - 1; slot >= 0; slot--){
+		w = &widgets[cellButtons[row][column][slot]];
+		if(x >= w->x && x < w->x + w->width && y >= w->y && y < w->y + w->height){
+			return cellButtons[row][column][slot];
+		}
+	}
+	return -1;
+}
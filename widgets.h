@@ -0,0 +1,75 @@
+/**
+  * @file widgets.h
+  * @brief Header file of the widgets.c source file.
+  * @author Nicholas Chan
+  * @author Niklas Henderson
+  * @date 19/10/2026.
+  */
+
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Board_GLCD.h"
+#include "number_format.h"
+
+/**
+  * @brief Most widgets on one screen.
+  */
+#define WIDGET_MAX 16
+
+/**
+  * @brief Side of one square cell of the hit-test grid, in pixels.
+  */
+#define WIDGET_CELL_SIZE 32
+
+/**
+  * @brief Most buttons that may overlap one grid cell.
+  */
+#define WIDGET_CELL_SLOTS 4
+
+/**
+  * @brief An enum containing the kinds of widget.
+  */
+enum widgetType{
+	WidgetButton,
+	WidgetLabel,
+	WidgetNumber,
+	WidgetScore
+};
+
+/**
+  * @brief A struct containing one widget. Buttons and labels show text, numbers show value
+  *        right-aligned in digits characters drawn from the glyph atlas, scores the same in the score font.
+  */
+typedef struct{
+	enum widgetType type;
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+	GLCD_FONT* font;
+	uint16_t foreground;
+	uint16_t background;
+	const char* text;
+	int value;
+	uint8_t digits;
+	bool dirty;
+	char shown[FORMAT_MAX_WIDTH + 1];
+	}widget;
+
+void widgetsClear(void);
+int widgetAddButton(unsigned int x, unsigned int y, unsigned int width, unsigned int height,
+		const char* text, GLCD_FONT* font, uint16_t foreground, uint16_t background);
+int widgetAddLabel(unsigned int x, unsigned int y, const char* text, GLCD_FONT* font,
+		uint16_t foreground, uint16_t background);
+int widgetAddNumber(unsigned int x, unsigned int y, unsigned int digits, GLCD_FONT* font, int value);
+int widgetAddScore(unsigned int x, unsigned int y, unsigned int digits,
+		uint16_t foreground, uint16_t background, int value);
+void widgetSetText(int id, const char* text);
+void widgetSetValue(int id, int value);
+void widgetsDraw(void);
+int widgetHit(int x, int y);
+
+#endif